@@ -700,7 +700,8 @@ static void block_idct (
 /*-----------------------------------------------------------------------*/
 
 static JRESULT mcu_load (
-	JDEC* jd		/* Pointer to the decompressor object */
+	JDEC* jd,		/* Pointer to the decompressor object */
+	int skip		/* Only advance the stream, the MCU is not output */
 )
 {
 	int32_t *tmp = (int32_t*)jd->workbuf;	/* Block working buffer for de-quantize and IDCT */
@@ -758,7 +759,7 @@ static JRESULT mcu_load (
 				}
 			} while (++z < 64);		/* Next AC element */
 
-			if (JD_FORMAT != 2 || !cmp) {	/* C components may not be processed if in grayscale output */
+			if (!skip && (JD_FORMAT != 2 || !cmp)) {	/* Skipped MCUs and C components in grayscale output need no IDCT */
 				if (z == 1 || (JD_USE_SCALE && jd->scale == 3)) {	/* If no AC element or scale ratio is 1/8, IDCT can be ommited and the block is filled with DC value */
 					d = (jd_yuv_t)((*tmp / 256) + 128);
 					if (JD_FASTDECODE >= 1) {
@@ -935,8 +936,17 @@ static JRESULT mcu_output (
 		}
 	}
 
-	/* Convert RGB888 to RGB565 if needed */
-	if (JD_FORMAT == 1) {
+	/* Convert RGB888 to 8-bit luma if requested */
+	if (JD_FORMAT != 2 && jd->gray) {
+		uint8_t *s = (uint8_t*)jd->workbuf;
+		uint8_t *d = s;
+		unsigned int n = rx * ry;
+
+		do {
+			*d++ = (uint8_t)((s[0] * 77 + s[1] * 150 + s[2] * 29) >> 8);
+			s += 3;
+		} while (--n);
+	} else if (JD_FORMAT == 1) {	/* Convert RGB888 to RGB565 if needed */
 		uint8_t *s = (uint8_t*)jd->workbuf;
 		uint16_t w, *d = (uint16_t*)s;
 		unsigned int n = rx * ry;
@@ -1124,9 +1134,29 @@ JRESULT jd_decomp (
 	int (*outfunc)(JDEC*, void*, JRECT*),	/* RGB output function */
 	uint8_t scale							/* Output de-scaling factor (0 to 3) */
 )
+{
+	return jd_decomp_rect(jd, outfunc, scale, 0);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Start to decompress a region of the JPEG picture                      */
+/*-----------------------------------------------------------------------*/
+/* MCUs outside of the region (in output pixels) are only read through,  */
+/* not transformed or output, and decoding ends below the region.        */
+
+JRESULT jd_decomp_rect (
+	JDEC* jd,								/* Initialized decompression object */
+	int (*outfunc)(JDEC*, void*, JRECT*),	/* RGB output function */
+	uint8_t scale,							/* Output de-scaling factor (0 to 3) */
+	const JRECT* roi						/* Output region, inclusive (0:Whole picture) */
+)
 {
 	unsigned int x, y, mx, my;
 	uint16_t rst, rsc;
+	int skip;
 	JRESULT rc;
 
 
@@ -1140,14 +1170,17 @@ JRESULT jd_decomp (
 
 	rc = JDR_OK;
 	for (y = 0; y < jd->height; y += my) {		/* Vertical loop of MCUs */
+		if (roi && (y >> scale) > roi->bottom) break;	/* Rest of the picture is below the region */
 		for (x = 0; x < jd->width; x += mx) {	/* Horizontal loop of MCUs */
 			if (jd->nrst && rst++ == jd->nrst) {	/* Process restart interval if enabled */
 				rc = restart(jd, rsc++);
 				if (rc != JDR_OK) return rc;
 				rst = 1;
 			}
-			rc = mcu_load(jd);					/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
+			skip = roi && (((x + mx) >> scale) <= roi->left || (x >> scale) > roi->right || ((y + my) >> scale) <= roi->top);
+			rc = mcu_load(jd, skip);			/* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
 			if (rc != JDR_OK) return rc;
+			if (skip) continue;
 			rc = mcu_output(jd, outfunc, x, y);	/* Output the MCU (YCbCr to RGB, scaling and output) */
 			if (rc != JDR_OK) return rc;
 		}
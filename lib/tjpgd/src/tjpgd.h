@@ -86,6 +86,7 @@ struct JDEC {
 	size_t sz_pool;				/* Size of momory pool (bytes available) */
 	size_t (*infunc)(JDEC*, uint8_t*, size_t);	/* Pointer to jpeg stream input function */
 	void* device;				/* Pointer to I/O device identifiler for the session */
+	uint8_t gray;				/* Output 8-bit luma instead of RGB565 (set after jd_prepare, CircuitPython extension) */
 };
 
 
@@ -93,6 +94,7 @@ struct JDEC {
 /* TJpgDec API functions */
 JRESULT jd_prepare (JDEC* jd, size_t (*infunc)(JDEC*,uint8_t*,size_t), void* pool, size_t sz_pool, void* dev);
 JRESULT jd_decomp (JDEC* jd, int (*outfunc)(JDEC*,void*,JRECT*), uint8_t scale);
+JRESULT jd_decomp_rect (JDEC* jd, int (*outfunc)(JDEC*,void*,JRECT*), uint8_t scale, const JRECT* roi);
 
 
 #ifdef __cplusplus
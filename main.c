@@ -84,6 +84,10 @@
 #include "shared-module/keypad/__init__.h"
 #endif
 
+#if CIRCUITPY_AUDIOCORE
+#include "shared-module/audiocore/effect.h"
+#endif
+
 #if CIRCUITPY_AUDIOFILEWRITER
 #include "shared-module/audiofilewriter/AudioFileWriter.h"
 #endif
@@ -425,6 +429,11 @@ static void cleanup_after_vm(mp_obj_t exception) {
     reset_port();
     reset_board();
 
+    // After reset_port() so that no audio output is still pulling effect blocks.
+    #if CIRCUITPY_AUDIOCORE
+    audiocore_effect_reset();
+    #endif
+
     // Free the heap last because other modules may reference heap memory and need to shut down.
     filesystem_flush();
 
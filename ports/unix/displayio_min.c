@@ -4,6 +4,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "py/enum.h"
 #include "py/obj.h"
 #include "py/runtime.h"
@@ -11,7 +13,9 @@
 #include "shared-bindings/displayio/__init__.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/CompressedBitmap.h"
 #include "shared-bindings/displayio/Palette.h"
+#include "shared-bindings/displayio/TileGrid.h"
 
 MAKE_ENUM_VALUE(displayio_colorspace_type, displayio_colorspace, RGB888, DISPLAYIO_COLORSPACE_RGB888);
 MAKE_ENUM_VALUE(displayio_colorspace_type, displayio_colorspace, RGB565, DISPLAYIO_COLORSPACE_RGB565);
@@ -59,12 +63,104 @@ static MP_DEFINE_CONST_DICT(displayio_colorspace_locals_dict, displayio_colorspa
 MAKE_PRINTER(displayio, displayio_colorspace);
 MAKE_ENUM_TYPE(displayio, ColorSpace, displayio_colorspace);
 
+// Stand-ins for the parts of a display refresh that a TileGrid takes part in, so
+// that the refresh can be tested without a display.
+// (no docstrings so that the debug functions are not shown on docs.circuitpython.org)
+
+// A TileGrid only has a place on the screen once it is in a Group, so one that
+// isn't is put at the origin, as a display's root Group would.
+static displayio_tilegrid_t *validate_tilegrid(mp_obj_t tilegrid_in) {
+    displayio_tilegrid_t *tilegrid = MP_OBJ_TO_PTR(mp_arg_validate_type(tilegrid_in, &displayio_tilegrid_type, MP_QSTR_tilegrid));
+    if (tilegrid->absolute_transform == NULL) {
+        displayio_tilegrid_update_transform(tilegrid, &null_transform);
+    }
+    return tilegrid;
+}
+
+// Fill the area x1, y1, x2, y2 of a bitmap from the TileGrid, leaving the pixels it
+// doesn't cover as they are. A 16 bit bitmap is filled as RGB565 and a 32 bit one as
+// RGB888. Others are filled as grayscale or, when grayscale is False, in the colorspace
+// of a color display of that depth. Returns whether the TileGrid covered the whole area.
+static mp_obj_t displayio_fill_area(size_t n_args, const mp_obj_t *args) {
+    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(mp_arg_validate_type(args[0], &displayio_bitmap_type, MP_QSTR_bitmap));
+    displayio_tilegrid_t *tilegrid = validate_tilegrid(args[1]);
+    displayio_area_t area = {
+        .x1 = mp_arg_validate_int_range(mp_obj_get_int(args[2]), 0, bitmap->width - 1, MP_QSTR_x1),
+        .y1 = mp_arg_validate_int_range(mp_obj_get_int(args[3]), 0, bitmap->height - 1, MP_QSTR_y1),
+    };
+    area.x2 = mp_arg_validate_int_range(mp_obj_get_int(args[4]), area.x1 + 1, bitmap->width, MP_QSTR_x2);
+    area.y2 = mp_arg_validate_int_range(mp_obj_get_int(args[5]), area.y1 + 1, bitmap->height, MP_QSTR_y2);
+    uint8_t depth = bitmap->bits_per_value;
+    bool grayscale = depth < 16 && (n_args < 7 || mp_obj_is_true(args[6]));
+    // Palettes and ColorConverters cache conversions by colorspace, so each kind
+    // is kept in one place, as a display's is.
+    static _displayio_colorspace_t colorspaces[6][2];
+    _displayio_colorspace_t *colorspace = &colorspaces[__builtin_ctz(depth)][grayscale];
+    *colorspace = (_displayio_colorspace_t) {
+        .depth = depth,
+        .bytes_per_cell = depth > 8 ? depth / 8 : 1,
+        .grayscale = grayscale,
+        .grayscale_bit = depth < 8 ? 8 - depth : 0,
+        .pixels_in_byte_share_row = true,
+    };
+
+    int width = area.x2 - area.x1;
+    size_t pixels = width * (area.y2 - area.y1);
+    size_t mask_words = (pixels + 31) / 32;
+    size_t buffer_words = (pixels * depth + 31) / 32;
+    uint32_t *mask = m_new(uint32_t, mask_words);
+    uint32_t *buffer = m_new(uint32_t, buffer_words);
+    memset(mask, 0, mask_words * sizeof(uint32_t));
+    memset(buffer, 0, buffer_words * sizeof(uint32_t));
+    bool full_coverage = displayio_tilegrid_fill_area(tilegrid, colorspace, &area, mask, buffer);
+    for (size_t i = 0; i < pixels; i++) {
+        if (!(mask[i / 32] & (1u << (i % 32)))) {
+            continue;
+        }
+        uint32_t value;
+        if (depth == 32) {
+            value = buffer[i];
+        } else if (depth == 16) {
+            value = ((uint16_t *)buffer)[i];
+        } else {
+            uint8_t pixels_per_byte = 8 / depth;
+            value = (((uint8_t *)buffer)[i / pixels_per_byte] >> ((i % pixels_per_byte) * depth)) & ((1 << depth) - 1);
+        }
+        common_hal_displayio_bitmap_set_pixel(bitmap, area.x1 + i % width, area.y1 + i / width, value);
+    }
+    m_del(uint32_t, mask, mask_words);
+    m_del(uint32_t, buffer, buffer_words);
+    return mp_obj_new_bool(full_coverage);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(displayio_fill_area_obj, 6, 7, displayio_fill_area);
+
+// The areas a display would refresh for the TileGrid, as (x1, y1, x2, y2) tuples.
+// The TileGrid's changes are then cleared, as at the end of a refresh.
+static mp_obj_t displayio_refresh_areas(mp_obj_t tilegrid_in) {
+    displayio_tilegrid_t *tilegrid = validate_tilegrid(tilegrid_in);
+    mp_obj_t areas = mp_obj_new_list(0, NULL);
+    for (const displayio_area_t *area = displayio_tilegrid_get_refresh_areas(tilegrid, NULL); area != NULL; area = area->next) {
+        mp_obj_t coords[] = {
+            MP_OBJ_NEW_SMALL_INT(area->x1), MP_OBJ_NEW_SMALL_INT(area->y1),
+            MP_OBJ_NEW_SMALL_INT(area->x2), MP_OBJ_NEW_SMALL_INT(area->y2),
+        };
+        mp_obj_list_append(areas, mp_obj_new_tuple(MP_ARRAY_SIZE(coords), coords));
+    }
+    displayio_tilegrid_finish_refresh(tilegrid);
+    return areas;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(displayio_refresh_areas_obj, displayio_refresh_areas);
+
 static const mp_rom_map_elem_t displayio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_displayio) },
     { MP_ROM_QSTR(MP_QSTR_Bitmap), MP_ROM_PTR(&displayio_bitmap_type) },
     { MP_ROM_QSTR(MP_QSTR_Colorspace), MP_ROM_PTR(&displayio_colorspace_type) },
     { MP_ROM_QSTR(MP_QSTR_ColorConverter), MP_ROM_PTR(&displayio_colorconverter_type) },
+    { MP_ROM_QSTR(MP_QSTR_CompressedBitmap), MP_ROM_PTR(&displayio_compressedbitmap_type) },
     { MP_ROM_QSTR(MP_QSTR_Palette), MP_ROM_PTR(&displayio_palette_type) },
+    { MP_ROM_QSTR(MP_QSTR_TileGrid), MP_ROM_PTR(&displayio_tilegrid_type) },
+    { MP_ROM_QSTR(MP_QSTR_fill_area), MP_ROM_PTR(&displayio_fill_area_obj) },
+    { MP_ROM_QSTR(MP_QSTR_refresh_areas), MP_ROM_PTR(&displayio_refresh_areas_obj) },
 };
 static MP_DEFINE_CONST_DICT(displayio_module_globals, displayio_module_globals_table);
 
@@ -22,6 +22,9 @@ SRC_C += $(SRC_QRIO)
 CFLAGS += -DCIRCUITPY_QRIO=1
 $(BUILD)/lib/quirc/lib/%.o: CFLAGS += -Wno-shadow -Wno-sign-compare -include shared-module/qrio/quirc_alloc.h
 
+SRC_C += lib/AnimatedGIF/gif.c
+$(BUILD)/lib/AnimatedGIF/gif.o: CFLAGS += -DCIRCUITPY
+
 SRC_C += lib/tjpgd/src/tjpgd.c
 $(BUILD)/lib/tjpgd/src/tjpgd.o: CFLAGS += -Wno-shadow -Wno-cast-align
 
@@ -33,6 +36,7 @@ SRC_BITMAP := \
 	shared-bindings/aesio/__init__.c \
 	shared-bindings/audiocore/__init__.c \
 	shared-bindings/audiocore/RawSample.c \
+	shared-bindings/audiocore/StreamingSample.c \
 	shared-bindings/audiocore/WaveFile.c \
 	shared-bindings/audiodelays/Echo.c \
 	shared-bindings/audiodelays/Chorus.c \
@@ -50,6 +54,9 @@ SRC_BITMAP := \
 	shared-bindings/audiomixer/__init__.c \
 	shared-bindings/audiomixer/Mixer.c \
 	shared-bindings/audiomixer/MixerVoice.c \
+	shared-bindings/audiospeed/__init__.c \
+	shared-bindings/audiospeed/Resampler.c \
+	shared-bindings/audiospeed/SpeedChanger.c \
 	shared-bindings/audiomp3/__init__.c \
 	shared-bindings/audiomp3/MP3Decoder.c \
 	shared-bindings/bitmapfilter/__init__.c \
@@ -57,8 +64,14 @@ SRC_BITMAP := \
 	shared-bindings/codeop/__init__.c \
 	shared-bindings/displayio/Bitmap.c \
 	shared-bindings/displayio/ColorConverter.c \
+	shared-bindings/displayio/CompressedBitmap.c \
+	shared-bindings/displayio/OnDiskBitmap.c \
 	shared-bindings/displayio/Palette.c \
+	shared-bindings/displayio/TileGrid.c \
 	shared-bindings/floppyio/__init__.c \
+	shared-bindings/gifio/__init__.c \
+	shared-bindings/gifio/GifWriter.c \
+	shared-bindings/gifio/OnDiskGif.c \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
 	shared-bindings/locale/__init__.c \
@@ -70,6 +83,7 @@ SRC_BITMAP := \
 	shared-bindings/synthio/LFO.c \
 	shared-bindings/synthio/Note.c \
 	shared-bindings/synthio/Biquad.c \
+	shared-bindings/synthio/Instrument.c \
 	shared-bindings/synthio/Synthesizer.c \
 	shared-bindings/traceback/__init__.c \
 	shared-bindings/util.c \
@@ -83,7 +97,9 @@ SRC_BITMAP := \
 	shared-module/aesio/__init__.c \
 	shared-module/audiocore/__init__.c \
 	shared-module/audiocore/RawSample.c \
+	shared-module/audiocore/StreamingSample.c \
 	shared-module/audiocore/WaveFile.c \
+	shared-module/audiocore/effect.c \
 	shared-module/audiodelays/Echo.c \
 	shared-module/audiodelays/Chorus.c \
 	shared-module/audiodelays/PitchShift.c \
@@ -101,13 +117,22 @@ SRC_BITMAP := \
 	shared-module/audiomp3/MP3Decoder.c \
 	shared-module/audiomixer/Mixer.c \
 	shared-module/audiomixer/MixerVoice.c \
+	shared-module/audiospeed/__init__.c \
+	shared-module/audiospeed/Resampler.c \
+	shared-module/audiospeed/SpeedChanger.c \
 	shared-module/bitmapfilter/__init__.c \
 	shared-module/bitmaptools/__init__.c \
 	shared-module/displayio/area.c \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
+	shared-module/displayio/CompressedBitmap.c \
+	shared-module/displayio/OnDiskBitmap.c \
 	shared-module/displayio/Palette.c \
+	shared-module/displayio/TileGrid.c \
 	shared-module/floppyio/__init__.c \
+	shared-module/gifio/__init__.c \
+	shared-module/gifio/GifWriter.c \
+	shared-module/gifio/OnDiskGif.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
 	shared-module/rainbowio/__init__.c \
@@ -118,6 +143,7 @@ SRC_BITMAP := \
 	shared-module/synthio/LFO.c \
 	shared-module/synthio/Note.c \
 	shared-module/synthio/Biquad.c \
+	shared-module/synthio/Instrument.c \
 	shared-module/synthio/Synthesizer.c \
 	shared-bindings/vectorio/Circle.c \
 	shared-module/vectorio/Circle.c \
@@ -157,6 +183,7 @@ CFLAGS += \
 	-DCIRCUITPY_AUDIODELAYS=1 \
 	-DCIRCUITPY_AUDIOFILTERS=1 \
 	-DCIRCUITPY_AUDIOMIXER=1 \
+	-DCIRCUITPY_AUDIOSPEED=1 \
 	-DCIRCUITPY_AUDIOMP3=1 \
 	-DCIRCUITPY_AUDIOCORE_DEBUG=1 \
 	-DCIRCUITPY_BITMAPTOOLS=1 \
@@ -174,6 +201,7 @@ CFLAGS += \
 	-DCIRCUITPY_SYNTHIO_MAX_CHANNELS=14 \
 	-DCIRCUITPY_TRACEBACK=1 \
 	-DCIRCUITPY_VECTORIO=1 \
+	-DCIRCUITPY_VECTORIO_DEBUG=1 \
 	-DCIRCUITPY_ZLIB=1
 
 # CIRCUITPY-CHANGE: test native base classes.
@@ -708,7 +708,9 @@ SRC_SHARED_MODULE_ALL = \
 	aesio/aes.c \
 	atexit/__init__.c \
 	audiocore/RawSample.c \
+	audiocore/StreamingSample.c \
 	audiocore/WaveFile.c \
+	audiocore/effect.c \
 	audiocore/__init__.c \
 	audiospeed/Resampler.c \
 	audiospeed/SpeedChanger.c \
@@ -754,6 +756,7 @@ SRC_SHARED_MODULE_ALL = \
 	canio/RemoteTransmissionRequest.c \
 	displayio/Bitmap.c \
 	displayio/ColorConverter.c \
+	displayio/CompressedBitmap.c \
 	displayio/Group.c \
 	displayio/OnDiskBitmap.c \
 	displayio/Palette.c \
@@ -823,6 +826,7 @@ SRC_SHARED_MODULE_ALL = \
 	supervisor/__init__.c \
 	supervisor/StatusBar.c \
 	synthio/Biquad.c \
+	synthio/Instrument.c \
 	synthio/LFO.c \
 	synthio/Math.c \
 	synthio/MidiTrack.c \
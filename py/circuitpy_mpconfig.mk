@@ -306,6 +306,11 @@ CFLAGS += -DCIRCUITPY_BITMAPTOOLS=$(CIRCUITPY_BITMAPTOOLS)
 CFLAGS += -DCIRCUITPY_FRAMEBUFFERIO=$(CIRCUITPY_FRAMEBUFFERIO)
 CFLAGS += -DCIRCUITPY_VECTORIO=$(CIRCUITPY_VECTORIO)
 
+ifndef CIRCUITPY_VECTORIO_DEBUG
+CIRCUITPY_VECTORIO_DEBUG ?= 0
+endif
+CFLAGS += -DCIRCUITPY_VECTORIO_DEBUG=$(CIRCUITPY_VECTORIO_DEBUG)
+
 CIRCUITPY_DUALBANK ?= 0
 CFLAGS += -DCIRCUITPY_DUALBANK=$(CIRCUITPY_DUALBANK)
 
@@ -0,0 +1,181 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "shared-bindings/audiocore/StreamingSample.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+//| class StreamingSample:
+//|     """Audio written from Python while it plays"""
+//|
+//|     def __init__(
+//|         self,
+//|         buffer_size: int = 4096,
+//|         *,
+//|         channel_count: int = 1,
+//|         sample_rate: int = 8000,
+//|         bits_per_sample: int = 16,
+//|         samples_signed: bool = True,
+//|     ) -> None:
+//|         """Create a sample that plays the audio given to `write` as it arrives.
+//|
+//|         Written audio is kept in a ring buffer. Playback reads blocks straight from it,
+//|         without copying, and returns each block to the writer once it has been played.
+//|         When nothing has been written in time, silence plays and `underruns` goes up.
+//|
+//|         :param int buffer_size: The size of the ring buffer in bytes. Up to a quarter of it is played at a time.
+//|         :param int channel_count: The number of channels in the written audio. For two channels, the samples alternate.
+//|         :param int sample_rate: The sample rate of the written audio
+//|         :param int bits_per_sample: The bits per sample of the written audio, 8 or 16
+//|         :param bool samples_signed: Whether the written samples are signed
+//|
+//|         Playing a sine wave computed in Python::
+//|
+//|           import array
+//|           import audiocore
+//|           import audiopwmio
+//|           import board
+//|           import math
+//|
+//|           period = array.array("h", [int(math.sin(math.pi * 2 * i / 20) * 20000) for i in range(20)])
+//|           stream = audiocore.StreamingSample(sample_rate=8000)
+//|           stream.write(period)
+//|           pwm = audiopwmio.PWMAudioOut(board.D12)
+//|           pwm.play(stream)
+//|           while True:
+//|               # Only write whole periods, so the wave stays continuous
+//|               if stream.fill_level + len(period) * 2 <= 4096:
+//|                   stream.write(period)"""
+//|         ...
+//|
+static mp_obj_t audioio_streamingsample_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_buffer_size, ARG_channel_count, ARG_sample_rate, ARG_bits_per_sample, ARG_samples_signed };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer_size, MP_ARG_INT, {.u_int = 4096} },
+        { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 8000} },
+        { MP_QSTR_bits_per_sample, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 16} },
+        { MP_QSTR_samples_signed, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t channel_count = mp_arg_validate_int_range(args[ARG_channel_count].u_int, 1, 2, MP_QSTR_channel_count);
+    mp_int_t sample_rate = mp_arg_validate_int_min(args[ARG_sample_rate].u_int, 1, MP_QSTR_sample_rate);
+    mp_int_t bits_per_sample = args[ARG_bits_per_sample].u_int;
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bits_per_sample must be 8 or 16"));
+    }
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4 * channel_count * bits_per_sample / 8, MP_QSTR_buffer_size);
+
+    audioio_streamingsample_obj_t *self = mp_obj_malloc(audioio_streamingsample_obj_t, &audioio_streamingsample_type);
+    common_hal_audioio_streamingsample_construct(self, buffer_size, bits_per_sample,
+        args[ARG_samples_signed].u_bool, channel_count, sample_rate);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the StreamingSample and releases its buffer for reuse."""
+//|         ...
+//|
+static mp_obj_t audioio_streamingsample_deinit(mp_obj_t self_in) {
+    audioio_streamingsample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioio_streamingsample_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audioio_streamingsample_deinit_obj, audioio_streamingsample_deinit);
+
+//|     def __enter__(self) -> StreamingSample:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def write(self, buffer: ReadableBuffer) -> int:
+//|         """Add as much of ``buffer`` to the ring buffer as fits, in whole frames, without waiting.
+//|         Returns the number of bytes added. Call again later with the rest of the buffer."""
+//|         ...
+//|
+static mp_obj_t audioio_streamingsample_write(mp_obj_t self_in, mp_obj_t buffer) {
+    audioio_streamingsample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_READ);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audioio_streamingsample_write(self, bufinfo.buf, bufinfo.len));
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(audioio_streamingsample_write_obj, audioio_streamingsample_write);
+
+//|     sample_rate: int
+//|     """32 bit value that dictates how quickly samples are played in Hertz (cycles per second)."""
+//|
+//|     fill_level: int
+//|     """The number of bytes written that have not finished playing. (read only)"""
+//|
+static mp_obj_t audioio_streamingsample_obj_get_fill_level(mp_obj_t self_in) {
+    audioio_streamingsample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return mp_obj_new_int_from_uint(common_hal_audioio_streamingsample_get_fill_level(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_streamingsample_get_fill_level_obj, audioio_streamingsample_obj_get_fill_level);
+
+MP_PROPERTY_GETTER(audioio_streamingsample_fill_level_obj,
+    (mp_obj_t)&audioio_streamingsample_get_fill_level_obj);
+
+//|     underruns: int
+//|     """The number of times playback ran out of written audio and played silence. (read only)"""
+//|
+//|
+static mp_obj_t audioio_streamingsample_obj_get_underruns(mp_obj_t self_in) {
+    audioio_streamingsample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return mp_obj_new_int_from_uint(common_hal_audioio_streamingsample_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_streamingsample_get_underruns_obj, audioio_streamingsample_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audioio_streamingsample_underruns_obj,
+    (mp_obj_t)&audioio_streamingsample_get_underruns_obj);
+
+static const mp_rom_map_elem_t audioio_streamingsample_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_streamingsample_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&audioio_streamingsample_write_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_fill_level), MP_ROM_PTR(&audioio_streamingsample_fill_level_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audioio_streamingsample_underruns_obj) },
+    AUDIOSAMPLE_FIELDS,
+};
+static MP_DEFINE_CONST_DICT(audioio_streamingsample_locals_dict, audioio_streamingsample_locals_dict_table);
+
+static const audiosample_p_t audioio_streamingsample_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .reset_buffer = (audiosample_reset_buffer_fun)audioio_streamingsample_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audioio_streamingsample_get_buffer,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audioio_streamingsample_type,
+    MP_QSTR_StreamingSample,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audioio_streamingsample_make_new,
+    locals_dict, &audioio_streamingsample_locals_dict,
+    protocol, &audioio_streamingsample_proto
+    );
@@ -0,0 +1,20 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/audiocore/StreamingSample.h"
+
+extern const mp_obj_type_t audioio_streamingsample_type;
+
+void common_hal_audioio_streamingsample_construct(audioio_streamingsample_obj_t *self,
+    uint32_t buffer_size, uint8_t bits_per_sample, bool samples_signed,
+    uint8_t channel_count, uint32_t sample_rate);
+
+void common_hal_audioio_streamingsample_deinit(audioio_streamingsample_obj_t *self);
+size_t common_hal_audioio_streamingsample_write(audioio_streamingsample_obj_t *self, const uint8_t *data, size_t len);
+uint32_t common_hal_audioio_streamingsample_get_fill_level(audioio_streamingsample_obj_t *self);
+uint32_t common_hal_audioio_streamingsample_get_underruns(audioio_streamingsample_obj_t *self);
@@ -14,6 +14,7 @@
 extern const mp_obj_type_t audioio_wavefile_type;
 
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
-    pyb_file_obj_t *file, uint8_t *buffer, size_t buffer_size);
+    pyb_file_obj_t *file, uint8_t *buffer, size_t buffer_size, uint8_t buffer_count);
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self);
+uint32_t common_hal_audioio_wavefile_get_underruns(audioio_wavefile_obj_t *self);
@@ -270,6 +270,7 @@ static const audiosample_p_t audiodelays_chorus_proto = {
     MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
     .reset_buffer = (audiosample_reset_buffer_fun)audiodelays_chorus_reset_buffer,
     .get_buffer = (audiosample_get_buffer_fun)audiodelays_chorus_get_buffer,
+    .get_block = (audiosample_get_block_fun)audiodelays_chorus_get_block,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
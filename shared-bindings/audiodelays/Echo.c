@@ -295,6 +295,7 @@ static const audiosample_p_t audiodelays_echo_proto = {
     MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
     .reset_buffer = (audiosample_reset_buffer_fun)audiodelays_echo_reset_buffer,
     .get_buffer = (audiosample_get_buffer_fun)audiodelays_echo_get_buffer,
+    .get_block = (audiosample_get_block_fun)audiodelays_echo_get_block,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
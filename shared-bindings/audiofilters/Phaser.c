@@ -288,6 +288,7 @@ static const audiosample_p_t audiofilters_phaser_proto = {
     MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
     .reset_buffer = (audiosample_reset_buffer_fun)audiofilters_phaser_reset_buffer,
     .get_buffer = (audiosample_get_buffer_fun)audiofilters_phaser_get_buffer,
+    .get_block = (audiosample_get_block_fun)audiofilters_phaser_get_block,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
@@ -260,6 +260,7 @@ static const audiosample_p_t audiofreeverb_freeverb_proto = {
     MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
     .reset_buffer = (audiosample_reset_buffer_fun)audiofreeverb_freeverb_reset_buffer,
     .get_buffer = (audiosample_get_buffer_fun)audiofreeverb_freeverb_get_buffer,
+    .get_block = (audiosample_get_block_fun)audiofreeverb_freeverb_get_block,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
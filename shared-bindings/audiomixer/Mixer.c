@@ -166,7 +166,10 @@ MP_PROPERTY_GETTER(audiomixer_mixer_voice_obj,
 //|
 //|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
 //|
-//|         The sample must match the Mixer's encoding settings given in the constructor.
+//|         The sample must match the Mixer's encoding settings, other than ``sample_rate``, given in the constructor.
+//|         When `audiospeed` is available, a sample with a different ``sample_rate`` is
+//|         wrapped in an `audiospeed.Resampler` with `audiospeed.Quality.LINEAR`
+//|         automatically. Pass an `audiospeed.Resampler` to choose another quality.
 //|
 //|         :return: The mixer object itself. Can be used for chaining, ie:
 //|           ``audio.play(mixer.play(sample))``.
@@ -42,7 +42,10 @@ static mp_obj_t audiomixer_mixervoice_make_new(const mp_obj_type_t *type, size_t
 //|
 //|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
 //|
-//|         The sample must match the `audiomixer.Mixer`'s encoding settings given in the constructor.
+//|         The sample must match the `audiomixer.Mixer`'s encoding settings, other than ``sample_rate``, given in the constructor.
+//|         When `audiospeed` is available, a sample with a different ``sample_rate`` is
+//|         wrapped in an `audiospeed.Resampler` with `audiospeed.Quality.LINEAR`
+//|         automatically. Pass an `audiospeed.Resampler` to choose another quality.
 //|         """
 //|         ...
 //|
@@ -25,11 +25,20 @@
 //|         https://learn.adafruit.com/Memory-saving-tips-for-CircuitPython/reducing-memory-fragmentation
 //|     """
 //|
-//|     def __init__(self, file: Union[str, typing.BinaryIO], buffer: WriteableBuffer) -> None:
+//|     def __init__(
+//|         self,
+//|         file: Union[str, typing.BinaryIO],
+//|         buffer: Optional[WriteableBuffer] = None,
+//|         *,
+//|         cache_ms: int = 0,
+//|         gapless: bool = False,
+//|     ) -> None:
 //|         """Load a .mp3 file for playback with `audioio.AudioOut` or `audiobusio.I2SOut`.
 //|
 //|         :param Union[str, typing.BinaryIO] file: The name of a mp3 file (preferred) or an already opened mp3 file
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: Optional pre-allocated buffer, that will be split and used for buffering the data. The buffer is split into two parts for decoded data and the remainder is used for pre-decoded data. When playing from a socket, a larger buffer can help reduce playback glitches at the expense of increased memory usage.
+//|         :param int cache_ms: Keep at least this many milliseconds from the start of the file decoded in memory. When the file loops, the start is played from memory while the decoder resumes reading after it, so looping doesn't stall on a slow file system. The cache is filled the first time the start is played. Each frame of a 44.1kHz stereo file uses about 4.6kB.
+//|         :param bool gapless: Use the encoder delay and padding stored by LAME and FFmpeg in the first frame to play only the original audio, so a file loops without a gap. Files without this information play as normal.
 //|
 //|         Playback of mp3 audio is CPU intensive, and the
 //|         exact limit depends on many factors such as the particular
@@ -73,6 +82,7 @@
 //|                 decoder.file = stream
 //|
 //|         If the stream is played with ``loop = True``, the loop will start at the beginning.
+//|         To move around in a seekable file, use `seek`.
 //|
 //|         It is possible to stream an mp3 from a socket, including a secure socket.
 //|         The MP3Decoder may change the timeout and non-blocking status of the socket.
@@ -83,9 +93,17 @@
 //|         ...
 //|
 
-static mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
-    mp_arg_check_num(n_args, n_kw, 1, 2, false);
-    mp_obj_t stream = args[0];
+static mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_file, ARG_buffer, ARG_cache_ms, ARG_gapless };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_buffer, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_cache_ms, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_gapless, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_obj_t stream = args[ARG_file].u_obj;
 
     if (mp_obj_is_str(stream)) {
         stream = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), stream, MP_ROM_QSTR(MP_QSTR_rb));
@@ -98,15 +116,17 @@ static mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_ar
     }
     uint8_t *buffer = NULL;
     size_t buffer_size = 0;
-    if (n_args >= 2) {
+    if (args[ARG_buffer].u_obj != mp_const_none) {
         mp_buffer_info_t bufinfo;
-        mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+        mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
         buffer = bufinfo.buf;
         buffer_size = bufinfo.len;
     }
 
+    mp_int_t cache_ms = mp_arg_validate_int_min(args[ARG_cache_ms].u_int, 0, MP_QSTR_cache_ms);
+
     audiomp3_mp3file_obj_t *self = mp_obj_malloc_with_finaliser(audiomp3_mp3file_obj_t, &audiomp3_mp3file_type);
-    common_hal_audiomp3_mp3file_construct(self, stream, buffer, buffer_size);
+    common_hal_audiomp3_mp3file_construct(self, stream, buffer, buffer_size, cache_ms, args[ARG_gapless].u_bool);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -177,6 +197,25 @@ static mp_obj_t audiomp3_mp3file_obj_open(mp_obj_t self_in, mp_obj_t path) {
 }
 MP_DEFINE_CONST_FUN_OBJ_2(audiomp3_mp3file_open_obj, audiomp3_mp3file_obj_open);
 
+//|     def seek(self, position: int) -> None:
+//|         """Move playback to ``position``, counted in the same units as `samples_decoded`.
+//|         The position is rounded down to the start of an mp3 frame.
+//|
+//|         The offsets of frames are remembered as the file is played, so seeking
+//|         back, or to a point that was already passed, doesn't read the whole file
+//|         again. Raises `OSError` if the file can't seek, such as when playing
+//|         from a socket."""
+//|         ...
+//|
+static mp_obj_t audiomp3_mp3file_obj_seek(mp_obj_t self_in, mp_obj_t position) {
+    audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t pos = mp_arg_validate_int_min(mp_obj_get_int(position), 0, MP_QSTR_position);
+    common_hal_audiomp3_mp3file_seek(self, pos);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiomp3_mp3file_seek_obj, audiomp3_mp3file_obj_seek);
+
 MP_PROPERTY_GETSET(audiomp3_mp3file_file_obj,
     (mp_obj_t)&audiomp3_mp3file_get_file_obj,
     (mp_obj_t)&audiomp3_mp3file_set_file_obj);
@@ -223,6 +262,7 @@ MP_PROPERTY_GETTER(audiomp3_mp3file_samples_decoded_obj,
 static const mp_rom_map_elem_t audiomp3_mp3file_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&audiomp3_mp3file_open_obj) },
+    { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&audiomp3_mp3file_seek_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiomp3_mp3file_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&audiomp3_mp3file_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
@@ -7,8 +7,10 @@
 #include <stdint.h>
 
 #include "shared/runtime/context_manager_helpers.h"
+#include "py/enum.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
+#include "shared-bindings/audiospeed/__init__.h"
 #include "shared-bindings/audiospeed/Resampler.h"
 #include "shared-bindings/audiocore/__init__.h"
 #include "shared-bindings/util.h"
@@ -17,10 +19,15 @@
 //| class Resampler:
 //|     """Wraps an audio sample to match it to the destination sample rate."""
 //|
-//|     def __init__(self) -> None:
+//|     def __init__(self, source: circuitpython_typing.AudioSample, *, quality: Quality = Quality.LINEAR) -> None:
 //|         """Create a Resampler that wraps ``source``.
 //|
 //|         :param audiosample source: The audio source to resample.
+//|         :param Quality quality: How output frames between source frames are computed.
+//|
+//|         `audiomixer.MixerVoice.play` wraps samples whose sample rate differs from
+//|         the mixer's in a Resampler automatically, so one only needs to be created
+//|         to choose a different quality.
 //|
 //|         Playing a wave file through a mixer with half the sample rate::
 //|
@@ -45,9 +52,10 @@
 //|
 static mp_obj_t audiospeed_resampler_make_new(const mp_obj_type_t *type,
     size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_source };
+    enum { ARG_source, ARG_quality };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_source, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_quality, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = (void *)&audiospeed_quality_LINEAR_obj } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -55,9 +63,10 @@ static mp_obj_t audiospeed_resampler_make_new(const mp_obj_type_t *type,
     // Validate source implements audiosample protocol
     mp_obj_t source = args[ARG_source].u_obj;
     audiosample_check(source);
+    audiospeed_quality_t quality = cp_enum_value(&audiospeed_quality_type, args[ARG_quality].u_obj, MP_QSTR_quality);
 
     audiospeed_resampler_obj_t *self = mp_obj_malloc(audiospeed_resampler_obj_t, &audiospeed_resampler_type);
-    common_hal_audiospeed_resampler_construct(self, source);
+    common_hal_audiospeed_resampler_construct(self, source, quality);
     return MP_OBJ_FROM_PTR(self);
 }
 
@@ -85,6 +94,28 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiospeed_resampler_get_rate_obj, audiospeed_resample
 MP_PROPERTY_GETTER(audiospeed_resampler_rate_obj,
     (mp_obj_t)&audiospeed_resampler_get_rate_obj);
 
+//|     quality: Quality
+//|     """How output frames between source frames are computed. Can be changed during playback."""
+//|
+static mp_obj_t audiospeed_resampler_obj_get_quality(mp_obj_t self_in) {
+    audiospeed_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base.base);
+    return cp_enum_find(&audiospeed_quality_type, common_hal_audiospeed_resampler_get_quality(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiospeed_resampler_get_quality_obj, audiospeed_resampler_obj_get_quality);
+
+static mp_obj_t audiospeed_resampler_obj_set_quality(mp_obj_t self_in, mp_obj_t quality_obj) {
+    audiospeed_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base.base);
+    common_hal_audiospeed_resampler_set_quality(self, cp_enum_value(&audiospeed_quality_type, quality_obj, MP_QSTR_quality));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiospeed_resampler_set_quality_obj, audiospeed_resampler_obj_set_quality);
+
+MP_PROPERTY_GETSET(audiospeed_resampler_quality_obj,
+    (mp_obj_t)&audiospeed_resampler_get_quality_obj,
+    (mp_obj_t)&audiospeed_resampler_set_quality_obj);
+
 static const mp_rom_map_elem_t audiospeed_resampler_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiospeed_resampler_deinit_obj) },
@@ -93,6 +124,7 @@ static const mp_rom_map_elem_t audiospeed_resampler_locals_dict_table[] = {
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_rate), MP_ROM_PTR(&audiospeed_resampler_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_quality), MP_ROM_PTR(&audiospeed_resampler_quality_obj) },
     AUDIOSAMPLE_FIELDS,
 };
 static MP_DEFINE_CONST_DICT(audiospeed_resampler_locals_dict, audiospeed_resampler_locals_dict_table);
@@ -6,13 +6,16 @@
 
 #pragma once
 
+#include "shared-bindings/audiospeed/__init__.h"
 #include "shared-module/audiospeed/Resampler.h"
 
 extern const mp_obj_type_t audiospeed_resampler_type;
 
-void common_hal_audiospeed_resampler_construct(audiospeed_resampler_obj_t *self, mp_obj_t source);
+void common_hal_audiospeed_resampler_construct(audiospeed_resampler_obj_t *self, mp_obj_t source, audiospeed_quality_t quality);
 void common_hal_audiospeed_resampler_deinit(audiospeed_resampler_obj_t *self);
 
 mp_obj_t common_hal_audiospeed_resampler_get_rate(audiospeed_resampler_obj_t *self);
+audiospeed_quality_t common_hal_audiospeed_resampler_get_quality(audiospeed_resampler_obj_t *self);
+void common_hal_audiospeed_resampler_set_quality(audiospeed_resampler_obj_t *self, audiospeed_quality_t quality);
 
 void audiospeed_resampler_set_sample_rate(audiospeed_resampler_obj_t *self, uint32_t sample_rate);
@@ -6,16 +6,52 @@
 
 #include <stdint.h>
 
+#include "py/enum.h"
 #include "py/obj.h"
 #include "py/runtime.h"
 
+#include "shared-bindings/audiospeed/__init__.h"
 #include "shared-bindings/audiospeed/Resampler.h"
 #include "shared-bindings/audiospeed/SpeedChanger.h"
 
 //| """Audio processing tools"""
+//|
+
+MAKE_ENUM_VALUE(audiospeed_quality_type, audiospeed_quality, NEAREST, AUDIOSPEED_QUALITY_NEAREST);
+MAKE_ENUM_VALUE(audiospeed_quality_type, audiospeed_quality, LINEAR, AUDIOSPEED_QUALITY_LINEAR);
+MAKE_ENUM_VALUE(audiospeed_quality_type, audiospeed_quality, CUBIC, AUDIOSPEED_QUALITY_CUBIC);
+MAKE_ENUM_VALUE(audiospeed_quality_type, audiospeed_quality, SINC, AUDIOSPEED_QUALITY_SINC);
+
+//| class Quality:
+//|     """How a `Resampler` computes output frames that fall between source frames"""
+//|
+//|     NEAREST: Quality
+//|     """Repeat or skip source frames. This is the fastest, but produces the most aliasing"""
+//|     LINEAR: Quality
+//|     """Interpolate linearly between the two nearest frames"""
+//|     CUBIC: Quality
+//|     """Interpolate with a cubic curve through the four nearest frames"""
+//|     SINC: Quality
+//|     """Filter with an 8 tap windowed-sinc kernel, which also removes frequencies
+//|     above the output's Nyquist frequency when downsampling. This is the slowest
+//|     but cleanest"""
+//|
+MAKE_ENUM_MAP(audiospeed_quality) {
+    MAKE_ENUM_MAP_ENTRY(audiospeed_quality, NEAREST),
+    MAKE_ENUM_MAP_ENTRY(audiospeed_quality, LINEAR),
+    MAKE_ENUM_MAP_ENTRY(audiospeed_quality, CUBIC),
+    MAKE_ENUM_MAP_ENTRY(audiospeed_quality, SINC),
+};
+
+static MP_DEFINE_CONST_DICT(audiospeed_quality_locals_dict, audiospeed_quality_locals_table);
+
+MAKE_PRINTER(audiospeed, audiospeed_quality);
+
+MAKE_ENUM_TYPE(audiospeed, Quality, audiospeed_quality);
 
 static const mp_rom_map_elem_t audiospeed_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiospeed) },
+    { MP_ROM_QSTR(MP_QSTR_Quality), MP_ROM_PTR(&audiospeed_quality_type) },
     { MP_ROM_QSTR(MP_QSTR_Resampler), MP_ROM_PTR(&audiospeed_resampler_type) },
     { MP_ROM_QSTR(MP_QSTR_SpeedChanger), MP_ROM_PTR(&audiospeed_speedchanger_type) },
 };
@@ -5,3 +5,14 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+
+#include "py/enum.h"
+#include "py/obj.h"
+
+extern const mp_obj_type_t audiospeed_quality_type;
+
+typedef enum {
+    AUDIOSPEED_QUALITY_NEAREST, AUDIOSPEED_QUALITY_LINEAR, AUDIOSPEED_QUALITY_CUBIC, AUDIOSPEED_QUALITY_SINC,
+} audiospeed_quality_t;
+
+extern const cp_enum_obj_t audiospeed_quality_LINEAR_obj;
@@ -143,6 +143,7 @@ static void validate_clip_region(displayio_bitmap_t *bitmap, mp_obj_t clip0_tupl
 //|     angle: float,
 //|     scale: float,
 //|     skip_index: int,
+//|     bilinear: bool = False,
 //| ) -> None:
 //|     """Inserts the source bitmap region into the destination bitmap with rotation
 //|     (angle), scale and clipping (both on source and destination bitmaps).
@@ -174,7 +175,11 @@ static void validate_clip_region(displayio_bitmap_t *bitmap, mp_obj_t clip0_tupl
 //|     :param float scale: Scaling factor. Defaults to None which gets treated as 1.0 or same
 //|            as original source size.
 //|     :param int skip_index: Bitmap palette index in the source that will not be copied,
-//|            set to None to copy all pixels"""
+//|            set to None to copy all pixels
+//|     :param bool bilinear: Blend the four source pixels nearest each destination pixel,
+//|            which smooths scaled and rotated images. Both bitmaps must hold 16-bit RGB565
+//|            values. Where one of the four is ``skip_index``, the nearest pixel is copied
+//|            as it would be without blending. Defaults to False, which copies the nearest pixel"""
 //|     ...
 //|
 //|
@@ -182,7 +187,7 @@ static mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args
     enum {ARG_dest_bitmap, ARG_source_bitmap,
           ARG_ox, ARG_oy, ARG_dest_clip0, ARG_dest_clip1,
           ARG_px, ARG_py, ARG_source_clip0, ARG_source_clip1,
-          ARG_angle, ARG_scale, ARG_skip_index};
+          ARG_angle, ARG_scale, ARG_skip_index, ARG_bilinear};
 
     static const mp_arg_t allowed_args[] = {
         {MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ},
@@ -201,6 +206,7 @@ static mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args
         {MP_QSTR_angle, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} }, // None convert to 0.0
         {MP_QSTR_scale, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} }, // None convert to 1.0
         {MP_QSTR_skip_index, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        {MP_QSTR_bilinear, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -262,6 +268,12 @@ static mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args
         skip_index_none = false;
     }
 
+    bool bilinear = args[ARG_bilinear].u_bool;
+    if (bilinear) {
+        mp_arg_validate_int(source->bits_per_value, 16, MP_QSTR_bits_per_value);
+        mp_arg_validate_int(destination->bits_per_value, 16, MP_QSTR_bits_per_value);
+    }
+
     common_hal_bitmaptools_rotozoom(destination, ox, oy,
         dest_clip0_x, dest_clip0_y,
         dest_clip1_x, dest_clip1_y,
@@ -270,7 +282,7 @@ static mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args
         source_clip1_x, source_clip1_y,
         angle,
         scale,
-        skip_index, skip_index_none);
+        skip_index, skip_index_none, bilinear);
 
     return mp_const_none;
 }
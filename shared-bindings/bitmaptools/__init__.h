@@ -35,7 +35,7 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     int16_t source_clip1_x, int16_t source_clip1_y,
     mp_float_t angle,
     mp_float_t scale,
-    uint32_t skip_index, bool skip_index_none);
+    uint32_t skip_index, bool skip_index_none, bool bilinear);
 
 void common_hal_bitmaptools_fill_region(displayio_bitmap_t *destination,
     int16_t x1, int16_t y1,
@@ -67,6 +67,8 @@
 //|         native_frames_per_second: int = 60,
 //|         backlight_on_high: bool = True,
 //|         SH1107_addressing: bool = False,
+//|         backlight_pwm_frequency: int = 50000,
+//|         retained_framebuffer: bool = False,
 //|     ) -> None:
 //|         r"""Create a Display object on the given display bus (`FourWire`, `paralleldisplaybus.ParallelBus` or `I2CDisplayBus`).
 //|
@@ -123,6 +125,7 @@
 //|         :param bool backlight_on_high: If True, pulling the backlight pin high turns the backlight on.
 //|         :param bool SH1107_addressing: Special quirk for SH1107, use upper/lower column set and page set
 //|         :param int backlight_pwm_frequency: The frequency to use to drive the PWM for backlight brightness control. Default is 50000.
+//|         :param bool retained_framebuffer: Keep a full copy of the display's pixels (in PSRAM when available) and only send the parts of each refresh that actually changed. See `retained_framebuffer`.
 //|         """
 //|         ...
 //|
@@ -135,7 +138,7 @@ static mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
            ARG_backlight_pin, ARG_brightness_command,
            ARG_brightness, ARG_single_byte_bounds, ARG_data_as_commands,
            ARG_auto_refresh, ARG_native_frames_per_second, ARG_backlight_on_high,
-           ARG_SH1107_addressing, ARG_backlight_pwm_frequency };
+           ARG_SH1107_addressing, ARG_backlight_pwm_frequency, ARG_retained_framebuffer };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_display_bus, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_init_sequence, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -162,7 +165,8 @@ static mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
         { MP_QSTR_native_frames_per_second, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 60} },
         { MP_QSTR_backlight_on_high, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
         { MP_QSTR_SH1107_addressing, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
-        { MP_QSTR_backlight_pwm_frequency, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 50000} }
+        { MP_QSTR_backlight_pwm_frequency, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 50000} },
+        { MP_QSTR_retained_framebuffer, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -187,6 +191,10 @@ static mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
     if (sh1107_addressing && color_depth != 1) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be 1 when %q is True"), MP_QSTR_color_depth, MP_QSTR_SH1107_addressing);
     }
+    const bool retained_framebuffer = args[ARG_retained_framebuffer].u_bool;
+    if (retained_framebuffer) {
+        mp_arg_validate_int_min(color_depth, 8, MP_QSTR_color_depth);
+    }
 
     primary_display_t *disp = allocate_display_or_raise();
     busdisplay_busdisplay_obj_t *self = &disp->display;
@@ -214,6 +222,7 @@ static mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
         sh1107_addressing,
         args[ARG_backlight_pwm_frequency].u_int
         );
+    common_hal_busdisplay_busdisplay_set_retained_framebuffer(self, retained_framebuffer);
 
     return self;
 }
@@ -309,6 +318,32 @@ MP_PROPERTY_GETSET(busdisplay_busdisplay_auto_refresh_obj,
     (mp_obj_t)&busdisplay_busdisplay_get_auto_refresh_obj,
     (mp_obj_t)&busdisplay_busdisplay_set_auto_refresh_obj);
 
+//|     retained_framebuffer: bool
+//|     """True when a full copy of the display's pixels is kept in RAM (PSRAM when available).
+//|     Each refresh is then compared against it in 16x16 pixel tiles and only tiles that
+//|     changed are sent over the bus. This trades RAM for much less bus traffic when small,
+//|     scattered parts of the screen change. Requires a `color_depth` of at least 8."""
+static mp_obj_t busdisplay_busdisplay_obj_get_retained_framebuffer(mp_obj_t self_in) {
+    busdisplay_busdisplay_obj_t *self = native_display(self_in);
+    return mp_obj_new_bool(common_hal_busdisplay_busdisplay_get_retained_framebuffer(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busdisplay_busdisplay_get_retained_framebuffer_obj, busdisplay_busdisplay_obj_get_retained_framebuffer);
+
+static mp_obj_t busdisplay_busdisplay_obj_set_retained_framebuffer(mp_obj_t self_in, mp_obj_t retained) {
+    busdisplay_busdisplay_obj_t *self = native_display(self_in);
+    bool enable = mp_obj_is_true(retained);
+    if (enable) {
+        mp_arg_validate_int_min(self->core.colorspace.depth, 8, MP_QSTR_color_depth);
+    }
+    common_hal_busdisplay_busdisplay_set_retained_framebuffer(self, enable);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(busdisplay_busdisplay_set_retained_framebuffer_obj, busdisplay_busdisplay_obj_set_retained_framebuffer);
+
+MP_PROPERTY_GETSET(busdisplay_busdisplay_retained_framebuffer_obj,
+    (mp_obj_t)&busdisplay_busdisplay_get_retained_framebuffer_obj,
+    (mp_obj_t)&busdisplay_busdisplay_set_retained_framebuffer_obj);
+
 //|     brightness: float
 //|     """The brightness of the display as a float. 0.0 is off and 1.0 is full brightness."""
 static mp_obj_t busdisplay_busdisplay_obj_get_brightness(mp_obj_t self_in) {
@@ -486,6 +521,7 @@ static const mp_rom_map_elem_t busdisplay_busdisplay_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_fill_row), MP_ROM_PTR(&busdisplay_busdisplay_fill_row_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_auto_refresh), MP_ROM_PTR(&busdisplay_busdisplay_auto_refresh_obj) },
+    { MP_ROM_QSTR(MP_QSTR_retained_framebuffer), MP_ROM_PTR(&busdisplay_busdisplay_retained_framebuffer_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_brightness), MP_ROM_PTR(&busdisplay_busdisplay_brightness_obj) },
 
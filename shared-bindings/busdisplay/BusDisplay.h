@@ -36,6 +36,9 @@ uint16_t common_hal_busdisplay_busdisplay_get_height(busdisplay_busdisplay_obj_t
 uint16_t common_hal_busdisplay_busdisplay_get_rotation(busdisplay_busdisplay_obj_t *self);
 void common_hal_busdisplay_busdisplay_set_rotation(busdisplay_busdisplay_obj_t *self, int rotation);
 
+bool common_hal_busdisplay_busdisplay_get_retained_framebuffer(busdisplay_busdisplay_obj_t *self);
+void common_hal_busdisplay_busdisplay_set_retained_framebuffer(busdisplay_busdisplay_obj_t *self, bool retained);
+
 bool common_hal_busdisplay_busdisplay_get_dither(busdisplay_busdisplay_obj_t *self);
 void common_hal_busdisplay_busdisplay_set_dither(busdisplay_busdisplay_obj_t *self, bool dither);
 
@@ -30,21 +30,36 @@
 //|     `bitmaptools.arrayblit` can also be useful to move data efficiently
 //|     into a Bitmap."""
 //|
-//|     def __init__(self, width: int, height: int, value_count: int) -> None:
+//|     def __init__(self, width: int, height: int, value_count: int, *, tiled: bool = False) -> None:
 //|         """Create a Bitmap object with the given fixed size. Each pixel stores a value that is used to
 //|         index into a corresponding palette. This enables differently colored sprites to share the
 //|         underlying Bitmap. value_count is used to minimize the memory used to store the Bitmap.
 //|
+//|         A tiled Bitmap stores its values in 8×8 blocks instead of in rows, so values above and below
+//|         each other are close together in memory. This makes a Bitmap that is read a column at a time
+//|         faster, such as one shown on a display rotated by 90 or 270 degrees, or through a transposed
+//|         `TileGrid`, when it is stored in PSRAM. Its buffer holds the blocks one row of blocks at a
+//|         time, and `bitmapfilter` can't be used on it.
+//|
 //|         :param int width: The number of values wide
 //|         :param int height: The number of values high
-//|         :param int value_count: The number of possible pixel values."""
+//|         :param int value_count: The number of possible pixel values.
+//|         :param bool tiled: Whether to store the values in blocks"""
 //|         ...
 //|
 static mp_obj_t displayio_bitmap_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    mp_arg_check_num(n_args, n_kw, 3, 3, false);
-    uint32_t width = mp_arg_validate_int_range(mp_obj_get_int(all_args[0]), 0, 32767, MP_QSTR_width);
-    uint32_t height = mp_arg_validate_int_range(mp_obj_get_int(all_args[1]), 0, 32767, MP_QSTR_height);
-    uint32_t value_count = mp_arg_validate_int_range(mp_obj_get_int(all_args[2]), 1, 65536, MP_QSTR_value_count);
+    enum { ARG_width, ARG_height, ARG_value_count, ARG_tiled };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_width, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_height, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_value_count, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_tiled, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    uint32_t width = mp_arg_validate_int_range(args[ARG_width].u_int, 0, 32767, MP_QSTR_width);
+    uint32_t height = mp_arg_validate_int_range(args[ARG_height].u_int, 0, 32767, MP_QSTR_height);
+    uint32_t value_count = mp_arg_validate_int_range(args[ARG_value_count].u_int, 1, 65536, MP_QSTR_value_count);
     uint32_t bits = 1;
 
     while ((value_count - 1) >> bits) {
@@ -56,7 +71,11 @@ static mp_obj_t displayio_bitmap_make_new(const mp_obj_type_t *type, size_t n_ar
     }
 
     displayio_bitmap_t *self = mp_obj_malloc(displayio_bitmap_t, &displayio_bitmap_type);
-    common_hal_displayio_bitmap_construct(self, width, height, bits);
+    if (args[ARG_tiled].u_bool) {
+        common_hal_displayio_bitmap_construct_tiled(self, width, height, bits);
+    } else {
+        common_hal_displayio_bitmap_construct(self, width, height, bits);
+    }
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -97,7 +116,6 @@ MP_PROPERTY_GETTER(displayio_bitmap_height_obj,
 
 //|     bits_per_value: int
 //|     """Bits per Pixel of the bitmap. (read only)"""
-//|
 static mp_obj_t displayio_bitmap_obj_get_bits_per_value(mp_obj_t self_in) {
     displayio_bitmap_t *self = MP_OBJ_TO_PTR(self_in);
 
@@ -110,6 +128,21 @@ MP_DEFINE_CONST_FUN_OBJ_1(displayio_bitmap_get_bits_per_value_obj, displayio_bit
 MP_PROPERTY_GETTER(displayio_bitmap_bits_per_value_obj,
     (mp_obj_t)&displayio_bitmap_get_bits_per_value_obj);
 
+//|     tiled: bool
+//|     """Whether the values are stored in 8×8 blocks instead of in rows. (read only)"""
+//|
+static mp_obj_t displayio_bitmap_obj_get_tiled(mp_obj_t self_in) {
+    displayio_bitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_displayio_bitmap_get_tiled(self));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_bitmap_get_tiled_obj, displayio_bitmap_obj_get_tiled);
+
+MP_PROPERTY_GETTER(displayio_bitmap_tiled_obj,
+    (mp_obj_t)&displayio_bitmap_get_tiled_obj);
+
 
 //|     def __getitem__(self, index: Union[Tuple[int, int], int]) -> int:
 //|         """Returns the value at the given index. The index can either be an x,y tuple or an int equal
@@ -261,6 +294,7 @@ static const mp_rom_map_elem_t displayio_bitmap_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_bitmap_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_bitmap_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_bits_per_value), MP_ROM_PTR(&displayio_bitmap_bits_per_value_obj) },
+    { MP_ROM_QSTR(MP_QSTR_tiled), MP_ROM_PTR(&displayio_bitmap_tiled_obj) },
     { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&displayio_bitmap_fill_obj) },
     { MP_ROM_QSTR(MP_QSTR_dirty), MP_ROM_PTR(&displayio_bitmap_dirty_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&displayio_bitmap_deinit_obj) },
@@ -24,7 +24,7 @@
 //|         """Create a ColorConverter object to convert color formats.
 //|
 //|         :param Colorspace colorspace: The source colorspace, one of the Colorspace constants
-//|         :param bool dither: Adds random noise to dither the output image"""
+//|         :param bool dither: Applies an ordered dither to the output image"""
 //|         ...
 //|
 
@@ -58,8 +58,57 @@ static mp_obj_t displayio_colorconverter_obj_convert(mp_obj_t self_in, mp_obj_t
 }
 MP_DEFINE_CONST_FUN_OBJ_2(displayio_colorconverter_convert_obj, displayio_colorconverter_obj_convert);
 
+//|     def convert_row(
+//|         self, source: ReadableBuffer, dest: WriteableBuffer, *, x: int = 0, y: int = 0
+//|     ) -> None:
+//|         """Converts every color in ``source`` to RGB565 according to the Colorspace and stores
+//|         the results in ``dest``. This is much faster than calling `convert` for each color.
+//|
+//|         :param ReadableBuffer source: Colors to convert, with 8, 16 or 32 bit elements
+//|         :param WriteableBuffer dest: Buffer with 16 bit elements, at least as long as ``source``
+//|         :param int x: Horizontal position of the first color, used when dithering
+//|         :param int y: Vertical position of the row, used when dithering
+//|
+//|         The transparent color is not treated specially."""
+//|         ...
+//|
+static mp_obj_t displayio_colorconverter_obj_convert_row(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_source, ARG_dest, ARG_x, ARG_y };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_source, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_dest, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_x, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_y, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    displayio_colorconverter_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t source;
+    mp_get_buffer_raise(args[ARG_source].u_obj, &source, MP_BUFFER_READ);
+    size_t source_itemsize = mp_binary_get_size('@', source.typecode, NULL);
+    if (source_itemsize != 1 && source_itemsize != 2 && source_itemsize != 4) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_source);
+    }
+
+    mp_buffer_info_t dest;
+    mp_get_buffer_raise(args[ARG_dest].u_obj, &dest, MP_BUFFER_WRITE);
+    if (mp_binary_get_size('@', dest.typecode, NULL) != 2) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_dest);
+    }
+
+    size_t count = source.len / source_itemsize;
+    mp_arg_validate_length_min(dest.len / 2, count, MP_QSTR_dest);
+    mp_int_t x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, 0xffff, MP_QSTR_x);
+    mp_int_t y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, 0xffff, MP_QSTR_y);
+
+    common_hal_displayio_colorconverter_convert_row(self, source.buf, source_itemsize, dest.buf, count, x, y);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(displayio_colorconverter_convert_row_obj, 1, displayio_colorconverter_obj_convert_row);
+
 //|     dither: bool
-//|     """When `True` the ColorConverter dithers the output by adding random noise when
+//|     """When `True` the ColorConverter dithers the output with a 4x4 ordered pattern when
 //|     truncating to display bitdepth"""
 //|
 static mp_obj_t displayio_colorconverter_obj_get_dither(mp_obj_t self_in) {
@@ -113,6 +162,7 @@ MP_DEFINE_CONST_FUN_OBJ_2(displayio_colorconverter_make_opaque_obj, displayio_co
 
 static const mp_rom_map_elem_t displayio_colorconverter_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_convert), MP_ROM_PTR(&displayio_colorconverter_convert_obj) },
+    { MP_ROM_QSTR(MP_QSTR_convert_row), MP_ROM_PTR(&displayio_colorconverter_convert_row_obj) },
     { MP_ROM_QSTR(MP_QSTR_dither), MP_ROM_PTR(&displayio_colorconverter_dither_obj) },
     { MP_ROM_QSTR(MP_QSTR_make_transparent), MP_ROM_PTR(&displayio_colorconverter_make_transparent_obj) },
     { MP_ROM_QSTR(MP_QSTR_make_opaque), MP_ROM_PTR(&displayio_colorconverter_make_opaque_obj) },
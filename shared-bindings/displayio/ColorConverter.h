@@ -15,6 +15,7 @@ extern const mp_obj_type_t displayio_colorconverter_type;
 
 void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t *self, bool dither, displayio_colorspace_t input_colorspace);
 void common_hal_displayio_colorconverter_convert(displayio_colorconverter_t *colorconverter, const _displayio_colorspace_t *colorspace, uint32_t input_color, uint32_t *output_color);
+void common_hal_displayio_colorconverter_convert_row(displayio_colorconverter_t *self, const void *input, size_t input_itemsize, uint16_t *output, uint32_t count, uint16_t x, uint16_t y);
 uint32_t displayio_colorconverter_convert_pixel(displayio_colorspace_t colorspace, uint32_t pixel);
 
 void common_hal_displayio_colorconverter_set_dither(displayio_colorconverter_t *self, bool dither);
@@ -0,0 +1,210 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/displayio/CompressedBitmap.h"
+
+#include <stdint.h>
+
+#include "py/runtime.h"
+#include "py/objproperty.h"
+
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/util.h"
+
+//| class CompressedBitmap:
+//|     """A read-only bitmap whose rows are stored run-length encoded. Values are decoded as they
+//|     are displayed, so a large background with areas of flat color takes a fraction of the
+//|     memory of a `Bitmap` and is much faster to show than an `OnDiskBitmap`.
+//|
+//|     Read-only data is used where it is, without copying. A file in ROMFS, opened in binary
+//|     mode, or a bytes object in a frozen module stays in flash.
+//|
+//|     .. code-block:: Python
+//|
+//|       import board
+//|       import displayio
+//|
+//|       # Once, to make the data
+//|       background = displayio.Bitmap(320, 240, 65536)
+//|       ...
+//|       with open("/background.rle", "wb") as f:
+//|           f.write(displayio.CompressedBitmap.compress(background))
+//|
+//|       # Then, with background.rle in ROMFS, to show it
+//|       background = displayio.CompressedBitmap(open("/rom/background.rle", "rb"))
+//|       converter = displayio.ColorConverter(input_colorspace=displayio.Colorspace.RGB565)
+//|       board.DISPLAY.root_group = displayio.Group()
+//|       board.DISPLAY.root_group.append(displayio.TileGrid(background, pixel_shader=converter))"""
+//|
+//|     def __init__(self, data: ReadableBuffer) -> None:
+//|         """Create a CompressedBitmap from data made by `compress`.
+//|
+//|         Each row starts at an entry in an index, so any row can be read without decoding the
+//|         ones before it. Reading along a row decodes each of its runs once. Reading back along a
+//|         row, as a TileGrid with ``flip_x`` does, decodes the row once into a buffer of one row.
+//|         A transposed TileGrid reads down columns, and then each value is found by decoding its
+//|         row from the start, which is much slower.
+//|
+//|         Data that can be changed, such as a `bytearray`, is copied first, so that the packets
+//|         checked here stay valid.
+//|
+//|         :param ReadableBuffer data: The compressed values"""
+//|         ...
+//|
+static mp_obj_t displayio_compressedbitmap_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_data };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t data = args[ARG_data].u_obj;
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    // get_pixel trusts the packets the constructor checked, so data that can
+    // still be changed, or resized, is copied.
+    mp_buffer_info_t writable;
+    if (mp_get_buffer(data, &writable, MP_BUFFER_WRITE)) {
+        data = mp_obj_new_bytes(bufinfo.buf, bufinfo.len);
+        mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    }
+
+    displayio_compressedbitmap_t *self = mp_obj_malloc(displayio_compressedbitmap_t, &displayio_compressedbitmap_type);
+    common_hal_displayio_compressedbitmap_construct(self, data, bufinfo.buf, bufinfo.len);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     width: int
+//|     """Width of the bitmap. (read only)"""
+static mp_obj_t displayio_compressedbitmap_obj_get_width(mp_obj_t self_in) {
+    displayio_compressedbitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_compressedbitmap_get_width(self));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_compressedbitmap_get_width_obj, displayio_compressedbitmap_obj_get_width);
+
+MP_PROPERTY_GETTER(displayio_compressedbitmap_width_obj,
+    (mp_obj_t)&displayio_compressedbitmap_get_width_obj);
+
+//|     height: int
+//|     """Height of the bitmap. (read only)"""
+static mp_obj_t displayio_compressedbitmap_obj_get_height(mp_obj_t self_in) {
+    displayio_compressedbitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_compressedbitmap_get_height(self));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_compressedbitmap_get_height_obj, displayio_compressedbitmap_obj_get_height);
+
+MP_PROPERTY_GETTER(displayio_compressedbitmap_height_obj,
+    (mp_obj_t)&displayio_compressedbitmap_get_height_obj);
+
+//|     bits_per_value: int
+//|     """Bits per Pixel of the bitmap. (read only)"""
+//|
+static mp_obj_t displayio_compressedbitmap_obj_get_bits_per_value(mp_obj_t self_in) {
+    displayio_compressedbitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_compressedbitmap_get_bits_per_value(self));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_compressedbitmap_get_bits_per_value_obj, displayio_compressedbitmap_obj_get_bits_per_value);
+
+MP_PROPERTY_GETTER(displayio_compressedbitmap_bits_per_value_obj,
+    (mp_obj_t)&displayio_compressedbitmap_get_bits_per_value_obj);
+
+//|     def __getitem__(self, index: Union[Tuple[int, int], int]) -> int:
+//|         """Returns the value at the given index. The index can either be an x,y tuple or an int equal
+//|         to ``y * width + x``.
+//|
+//|         This allows you to::
+//|
+//|           print(bitmap[0,1])"""
+//|         ...
+//|
+static mp_obj_t compressedbitmap_subscr(mp_obj_t self_in, mp_obj_t index_obj, mp_obj_t value_obj) {
+    if (value_obj != MP_OBJ_SENTINEL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+    displayio_compressedbitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    if (mp_obj_is_type(index_obj, &mp_type_slice)) {
+        mp_raise_NotImplementedError(MP_ERROR_TEXT("Slices not supported"));
+    }
+
+    uint16_t x = 0;
+    uint16_t y = 0;
+    if (mp_obj_is_small_int(index_obj)) {
+        mp_int_t i = MP_OBJ_SMALL_INT_VALUE(index_obj);
+        int total_length = self->width * self->height;
+        if (i < 0 || i >= total_length) {
+            mp_raise_IndexError_varg(MP_ERROR_TEXT("%q must be %d-%d"), MP_QSTR_index, 0, total_length - 1);
+        }
+
+        x = i % self->width;
+        y = i / self->width;
+    } else {
+        mp_obj_t *items;
+        mp_obj_get_array_fixed_n(index_obj, 2, &items);
+        mp_int_t x_in = mp_obj_get_int(items[0]);
+        if (x_in < 0 || x_in >= self->width) {
+            mp_raise_IndexError_varg(MP_ERROR_TEXT("%q must be %d-%d"), MP_QSTR_x, 0, self->width - 1);
+        }
+        mp_int_t y_in = mp_obj_get_int(items[1]);
+        if (y_in < 0 || y_in >= self->height) {
+            mp_raise_IndexError_varg(MP_ERROR_TEXT("%q must be %d-%d"), MP_QSTR_y, 0, self->height - 1);
+        }
+        x = x_in;
+        y = y_in;
+    }
+
+    return mp_obj_new_int_from_uint(common_hal_displayio_compressedbitmap_get_pixel(self, x, y));
+}
+
+//|     @staticmethod
+//|     def compress(bitmap: Bitmap) -> bytes:
+//|         """Return the values of ``bitmap`` run-length encoded, for use with `CompressedBitmap`.
+//|
+//|         Each run of up to 128 equal values is stored as a single value. Values are stored in
+//|         whole bytes, so a bitmap of less than 8 bits per value with few runs may get larger.
+//|
+//|         :param Bitmap bitmap: The bitmap to compress"""
+//|         ...
+//|
+//|
+static mp_obj_t displayio_compressedbitmap_compress(mp_obj_t bitmap_in) {
+    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(mp_arg_validate_type(bitmap_in, &displayio_bitmap_type, MP_QSTR_bitmap));
+    if (common_hal_displayio_bitmap_deinited(bitmap)) {
+        raise_deinited_error();
+    }
+
+    vstr_t vstr;
+    vstr_init_len(&vstr, common_hal_displayio_compressedbitmap_compress(bitmap, NULL));
+    common_hal_displayio_compressedbitmap_compress(bitmap, (uint8_t *)vstr.buf);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(displayio_compressedbitmap_compress_fun_obj, displayio_compressedbitmap_compress);
+static MP_DEFINE_CONST_STATICMETHOD_OBJ(displayio_compressedbitmap_compress_obj, MP_ROM_PTR(&displayio_compressedbitmap_compress_fun_obj));
+
+static const mp_rom_map_elem_t displayio_compressedbitmap_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_bits_per_value), MP_ROM_PTR(&displayio_compressedbitmap_bits_per_value_obj) },
+    { MP_ROM_QSTR(MP_QSTR_compress), MP_ROM_PTR(&displayio_compressedbitmap_compress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_compressedbitmap_height_obj) },
+    { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_compressedbitmap_width_obj) },
+};
+static MP_DEFINE_CONST_DICT(displayio_compressedbitmap_locals_dict, displayio_compressedbitmap_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    displayio_compressedbitmap_type,
+    MP_QSTR_CompressedBitmap,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, displayio_compressedbitmap_make_new,
+    locals_dict, &displayio_compressedbitmap_locals_dict,
+    subscr, compressedbitmap_subscr
+    );
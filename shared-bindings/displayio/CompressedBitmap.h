@@ -0,0 +1,26 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/displayio/Bitmap.h"
+#include "shared-module/displayio/CompressedBitmap.h"
+
+extern const mp_obj_type_t displayio_compressedbitmap_type;
+
+void common_hal_displayio_compressedbitmap_construct(displayio_compressedbitmap_t *self, mp_obj_t data_obj,
+    const uint8_t *data, size_t len);
+
+uint32_t common_hal_displayio_compressedbitmap_get_pixel(displayio_compressedbitmap_t *self,
+    int16_t x, int16_t y);
+
+uint16_t common_hal_displayio_compressedbitmap_get_height(displayio_compressedbitmap_t *self);
+uint16_t common_hal_displayio_compressedbitmap_get_width(displayio_compressedbitmap_t *self);
+uint32_t common_hal_displayio_compressedbitmap_get_bits_per_value(displayio_compressedbitmap_t *self);
+
+// Writes the compressed form of bitmap to buf and returns its length. With a
+// NULL buf only the length is returned.
+size_t common_hal_displayio_compressedbitmap_compress(displayio_bitmap_t *bitmap, uint8_t *buf);
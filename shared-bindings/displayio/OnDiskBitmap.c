@@ -47,10 +47,12 @@
 //|       while True:
 //|           pass"""
 //|
-//|     def __init__(self, file: Union[str, typing.BinaryIO]) -> None:
+//|     def __init__(self, file: Union[str, typing.BinaryIO], *, cache_size: int = 2048) -> None:
 //|         """Create an OnDiskBitmap object with the given file.
 //|
 //|         :param file file: The name of the bitmap file.  For backwards compatibility, a file opened in binary mode may also be passed.
+//|         :param int cache_size: Number of bytes of pixel data to read from the file at once and keep in RAM.
+//|           Whole rows are read when they fit. 0 reads each pixel separately.
 //|
 //|         Older versions of CircuitPython required a file opened in binary
 //|         mode. CircuitPython 7.0 modified OnDiskBitmap so that it takes a
@@ -60,18 +62,25 @@
 //|         ...
 //|
 static mp_obj_t displayio_ondiskbitmap_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    mp_arg_check_num(n_args, n_kw, 1, 1, false);
-    mp_obj_t arg = all_args[0];
+    enum { ARG_file, ARG_cache_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_cache_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 2048} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_obj_t arg = args[ARG_file].u_obj;
+    mp_int_t cache_size = mp_arg_validate_int_min(args[ARG_cache_size].u_int, 0, MP_QSTR_cache_size);
 
     if (mp_obj_is_str(arg)) {
         arg = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), arg, MP_ROM_QSTR(MP_QSTR_rb));
     }
-    if (!mp_obj_is_type(arg, &mp_type_fileio)) {
+    if (!mp_obj_is_type(arg, &mp_type_vfs_fat_fileio)) {
         mp_raise_TypeError(MP_ERROR_TEXT("file must be a file opened in byte mode"));
     }
 
     displayio_ondiskbitmap_t *self = mp_obj_malloc(displayio_ondiskbitmap_t, &displayio_ondiskbitmap_type);
-    common_hal_displayio_ondiskbitmap_construct(self, MP_OBJ_TO_PTR(arg));
+    common_hal_displayio_ondiskbitmap_construct(self, MP_OBJ_TO_PTR(arg), cache_size);
 
     return MP_OBJ_FROM_PTR(self);
 }
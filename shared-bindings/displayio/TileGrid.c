@@ -15,6 +15,7 @@
 #include "py/runtime.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/CompressedBitmap.h"
 #include "shared-bindings/displayio/OnDiskBitmap.h"
 #include "shared-bindings/displayio/Palette.h"
 #if CIRCUITPY_TILEPALETTEMAPPER
@@ -47,7 +48,7 @@ void displayio_tilegrid_validate_pixel_shader(mp_obj_t pixel_shader) {
 //|
 //|     def __init__(
 //|         self,
-//|         bitmap: Union[Bitmap, OnDiskBitmap],
+//|         bitmap: Union[Bitmap, OnDiskBitmap, CompressedBitmap],
 //|         *,
 //|         pixel_shader: Union[ColorConverter, Palette, tilepalettemapper.TilePaletteMapper],
 //|         width: int = 1,
@@ -67,7 +68,7 @@ void displayio_tilegrid_validate_pixel_shader(mp_obj_t pixel_shader) {
 //|
 //|         tile_width and tile_height match the height of the bitmap by default.
 //|
-//|         :param Bitmap,OnDiskBitmap bitmap: The bitmap storing one or more tiles.
+//|         :param Bitmap,OnDiskBitmap,CompressedBitmap bitmap: The bitmap storing one or more tiles.
 //|         :param ColorConverter,Palette,tilepalettemapper.TilePaletteMapper pixel_shader: The pixel shader that produces colors from values
 //|         :param int width: Width of the grid in tiles.
 //|         :param int height: Height of the grid in tiles.
@@ -105,6 +106,10 @@ static mp_obj_t displayio_tilegrid_make_new(const mp_obj_type_t *type, size_t n_
         displayio_ondiskbitmap_t *bmp = MP_OBJ_TO_PTR(bitmap);
         bitmap_width = bmp->width;
         bitmap_height = bmp->height;
+    } else if (mp_obj_is_type(bitmap, &displayio_compressedbitmap_type)) {
+        displayio_compressedbitmap_t *bmp = MP_OBJ_TO_PTR(bitmap);
+        bitmap_width = bmp->width;
+        bitmap_height = bmp->height;
     } else {
         mp_raise_TypeError_varg(MP_ERROR_TEXT("unsupported %q type"), MP_QSTR_bitmap);
     }
@@ -352,7 +357,7 @@ MP_PROPERTY_GETSET(displayio_tilegrid_pixel_shader_obj,
     (mp_obj_t)&displayio_tilegrid_get_pixel_shader_obj,
     (mp_obj_t)&displayio_tilegrid_set_pixel_shader_obj);
 
-//|     bitmap: Union[Bitmap, OnDiskBitmap]
+//|     bitmap: Union[Bitmap, OnDiskBitmap, CompressedBitmap]
 //|     """The bitmap of the tilegrid."""
 //|
 static mp_obj_t displayio_tilegrid_obj_get_bitmap(mp_obj_t self_in) {
@@ -374,6 +379,10 @@ static mp_obj_t displayio_tilegrid_obj_set_bitmap(mp_obj_t self_in, mp_obj_t bit
         displayio_ondiskbitmap_t *bmp = MP_OBJ_TO_PTR(bitmap);
         new_bitmap_width = bmp->width;
         new_bitmap_height = bmp->height;
+    } else if (mp_obj_is_type(bitmap, &displayio_compressedbitmap_type)) {
+        displayio_compressedbitmap_t *bmp = MP_OBJ_TO_PTR(bitmap);
+        new_bitmap_width = bmp->width;
+        new_bitmap_height = bmp->height;
     } else {
         mp_raise_TypeError_varg(MP_ERROR_TEXT("unsupported %q type"), MP_QSTR_bitmap);
     }
@@ -388,6 +397,11 @@ static mp_obj_t displayio_tilegrid_obj_set_bitmap(mp_obj_t self_in, mp_obj_t bit
         if (old_bmp->width != new_bitmap_width || old_bmp->height != new_bitmap_height) {
             mp_raise_ValueError(MP_ERROR_TEXT("New bitmap must be same size as old bitmap"));
         }
+    } else if (mp_obj_is_type(self->bitmap, &displayio_compressedbitmap_type)) {
+        displayio_compressedbitmap_t *old_bmp = MP_OBJ_TO_PTR(self->bitmap);
+        if (old_bmp->width != new_bitmap_width || old_bmp->height != new_bitmap_height) {
+            mp_raise_ValueError(MP_ERROR_TEXT("New bitmap must be same size as old bitmap"));
+        }
     }
 
     common_hal_displayio_tilegrid_set_bitmap(self, bitmap);
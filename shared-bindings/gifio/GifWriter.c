@@ -101,6 +101,11 @@ MP_DEFINE_CONST_FUN_OBJ_1(gifio_gifwriter_deinit_obj, gifio_gifwriter_deinit);
 //|     def add_frame(self, bitmap: ReadableBuffer, delay: float = 0.1) -> None:
 //|         """Add a frame to the GIF.
 //|
+//|         After the first frame, only the rectangle that changed since the previous
+//|         frame is stored, with the unchanged pixels in it transparent. The file is
+//|         written in chunks the size of a filesystem cluster, so the last frames may
+//|         only reach the file when the GifWriter is closed.
+//|
 //|         :param bitmap: The frame data
 //|         :param delay: The frame delay in seconds.  The GIF format rounds this to the nearest 1/100 second, and the largest permitted value is 655 seconds.
 //|         """
@@ -74,9 +74,20 @@
 //|           time.sleep(max(0, next_delay - overhead))
 //|           next_delay = odg.next_frame()
 //|
-//|           display_bus.send(42, struct.pack(">hh", 0, odg.bitmap.width - 1))
-//|           display_bus.send(43, struct.pack(">hh", 0, odg.bitmap.height - 1))
-//|           display_bus.send(44, odg.bitmap)
+//|           # Only send the rows that changed
+//|           x1, y1, x2, y2 = odg.dirty_area
+//|           if y1 == y2:
+//|               continue
+//|           # Rows of a 16 bit Bitmap are padded to a multiple of 32 bits, so with an
+//|           # odd width each row holds one more pixel than the image is wide
+//|           pixels = memoryview(odg.bitmap)
+//|           stride = len(pixels) // odg.bitmap.height
+//|           display_bus.send(42, struct.pack(">hh", 0, stride - 1))
+//|           display_bus.send(43, struct.pack(">hh", y1, y2 - 1))
+//|           display_bus.send(44, pixels[y1 * stride : y2 * stride])
+//|
+//|     When ``use_palette`` is False, the frames are decoded straight into RGB565_SWAPPED
+//|     through a lookup table, so no conversion is needed on the way to the display.
 //|
 //|       # The following optional code will free the OnDiskGif and allocated resources
 //|       # after use. This may be required before loading a new GIF in situations
@@ -117,7 +128,7 @@ static mp_obj_t gifio_ondiskgif_make_new(const mp_obj_type_t *type, size_t n_arg
         filename = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), filename, MP_ROM_QSTR(MP_QSTR_rb));
     }
 
-    if (!mp_obj_is_type(filename, &mp_type_fileio)) {
+    if (!mp_obj_is_type(filename, &mp_type_vfs_fat_fileio)) {
         mp_raise_TypeError(MP_ERROR_TEXT("file must be a file opened in byte mode"));
     }
 
@@ -215,6 +226,31 @@ static mp_obj_t gifio_ondiskgif_obj_next_frame(mp_obj_t self_in) {
 
 MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_next_frame_obj, gifio_ondiskgif_obj_next_frame);
 
+//|     dirty_area: Tuple[int, int, int, int]
+//|     """The area ``(x1, y1, x2, y2)`` of the bitmap changed by the last `next_frame`, with
+//|     ``x2`` and ``y2`` exclusive. It covers the new frame and the area the frame before it
+//|     was cleared from, if its disposal method asked for that. Only this area needs to be
+//|     sent to a display. (read only)"""
+static mp_obj_t gifio_ondiskgif_obj_get_dirty_area(mp_obj_t self_in) {
+    gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(self_in);
+
+    check_for_deinit(self);
+    displayio_area_t area;
+    common_hal_gifio_ondiskgif_get_dirty_area(self, &area);
+    mp_obj_t elems[] = {
+        MP_OBJ_NEW_SMALL_INT(area.x1),
+        MP_OBJ_NEW_SMALL_INT(area.y1),
+        MP_OBJ_NEW_SMALL_INT(area.x2),
+        MP_OBJ_NEW_SMALL_INT(area.y2),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(elems), elems);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_get_dirty_area_obj, gifio_ondiskgif_obj_get_dirty_area);
+
+MP_PROPERTY_GETTER(gifio_ondiskgif_dirty_area_obj,
+    (mp_obj_t)&gifio_ondiskgif_get_dirty_area_obj);
+
 
 //|     duration: float
 //|     """Returns the total duration of the GIF in seconds. (read only)"""
@@ -294,6 +330,7 @@ static const mp_rom_map_elem_t gifio_ondiskgif_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_palette), MP_ROM_PTR(&gifio_ondiskgif_palette_obj) },
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&gifio_ondiskgif_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_next_frame), MP_ROM_PTR(&gifio_ondiskgif_next_frame_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dirty_area), MP_ROM_PTR(&gifio_ondiskgif_dirty_area_obj) },
     { MP_ROM_QSTR(MP_QSTR_duration), MP_ROM_PTR(&gifio_ondiskgif_duration_obj) },
     { MP_ROM_QSTR(MP_QSTR_frame_count), MP_ROM_PTR(&gifio_ondiskgif_frame_count_obj) },
     { MP_ROM_QSTR(MP_QSTR_min_delay), MP_ROM_PTR(&gifio_ondiskgif_min_delay_obj) },
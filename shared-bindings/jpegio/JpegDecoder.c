@@ -108,11 +108,15 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 //|         """Decode JPEG data
 //|
 //|         The bitmap must be large enough to contain the decoded image.
-//|         The pixel data is stored in the `displayio.Colorspace.RGB565_SWAPPED` colorspace.
+//|         The pixel data is stored in the `displayio.Colorspace.RGB565_SWAPPED` colorspace,
+//|         or as 8-bit grayscale (luma) when the bitmap has 8 bits per value.
 //|
 //|         The image is optionally downscaled by a factor of ``2**scale``.
 //|         Scaling by a factor of 8 (scale=3) is particularly efficient in terms of decoding time.
 //|
+//|         Only the part of the image that is copied is fully decoded, and decoding
+//|         stops below it, so cropping a small region out of a large image is fast.
+//|
 //|         The remaining parameters are as for `bitmaptools.blit`.
 //|         Because JPEG is a lossy data format, chroma keying based on the "source
 //|         index" is not reliable, because the same original RGB value might end
@@ -195,9 +199,98 @@ static mp_obj_t jpegio_jpegdecoder_decode(size_t n_args, const mp_obj_t *pos_arg
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(jpegio_jpegdecoder_decode_obj, 1, jpegio_jpegdecoder_decode);
 
+//|     def decode_rows(
+//|         self,
+//|         bitmap: displayio.Bitmap,
+//|         rows_ready: Callable[[int, int], None],
+//|         scale: int = 0,
+//|         *,
+//|         x1: int = 0,
+//|         y1: int = 0,
+//|         x2: Optional[int] = None,
+//|         y2: Optional[int] = None,
+//|     ) -> None:
+//|         """Decode JPEG data a band of rows at a time, without a bitmap for the whole image
+//|
+//|         The image, or the region ``x1``, ``y1``, ``x2``, ``y2`` of it (after scaling),
+//|         is decoded into the top left of ``bitmap``. Each time the bitmap is
+//|         full, ``rows_ready(y, height)`` is called: the first ``height`` rows of
+//|         the bitmap hold rows ``y`` to ``y + height - 1`` of the region. They can
+//|         then be sent on, for instance to a display bus, before the bitmap is
+//|         reused for the next rows.
+//|
+//|         The bitmap must be at least as wide as the region, and at least as tall
+//|         as one row of JPEG blocks (16 pixels, divided by ``2**scale``). As in
+//|         `decode`, the pixels are RGB565_SWAPPED, or grayscale when the bitmap
+//|         has 8 bits per value. RGB565_SWAPPED is the byte order displays expect,
+//|         so the bitmap's buffer can be written to the display as it is when the
+//|         bitmap's width is even.
+//|
+//|         Streaming an image to a display without `displayio`::
+//|
+//|           band = displayio.Bitmap(240, 16, 65536)
+//|           decoder.open("/sd/example.jpg")
+//|
+//|           def rows_ready(y, height):
+//|               bus.send(0x2A, struct.pack(">HH", 0, 239))
+//|               bus.send(0x2B, struct.pack(">HH", y, y + height - 1))
+//|               bus.send(0x2C, memoryview(band)[: 240 * height])
+//|
+//|           decoder.decode_rows(band, rows_ready)
+//|
+//|         After a call to ``decode_rows``, you must ``open`` a new JPEG. This is also the
+//|         case when ``rows_ready`` raises an exception, which stops decoding. The decoder
+//|         can't be used from inside ``rows_ready``.
+//|
+//|         :param Bitmap bitmap: The buffer that rows are decoded into
+//|         :param Callable rows_ready: Called with the first row and the number of rows each time rows are ready
+//|         :param int scale: Scale factor from 0 to 3, inclusive.
+//|         :param int x1: Minimum x-value of the region to decode
+//|         :param int y1: Minimum y-value of the region to decode
+//|         :param int x2: Maximum x-value (exclusive) of the region to decode
+//|         :param int y2: Maximum y-value (exclusive) of the region to decode
+//|         """
+//|
+//|
+static mp_obj_t jpegio_jpegdecoder_decode_rows(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    jpegio_jpegdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    enum { ARG_bitmap, ARG_rows_ready, ARG_scale, ARGS_X1_Y1_X2_Y2 };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_bitmap, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = mp_const_none } },
+        { MP_QSTR_rows_ready, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = mp_const_none } },
+        { MP_QSTR_scale, MP_ARG_INT, {.u_int = 0 } },
+        ALLOWED_ARGS_X1_Y1_X2_Y2(MP_ARG_KW_ONLY, MP_ARG_KW_ONLY),
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t bitmap_in = args[ARG_bitmap].u_obj;
+    mp_arg_validate_type(bitmap_in, &displayio_bitmap_type, MP_QSTR_bitmap);
+    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(bitmap_in);
+
+    mp_obj_t rows_ready = args[ARG_rows_ready].u_obj;
+    if (!mp_obj_is_callable(rows_ready)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("object not callable"));
+    }
+
+    int scale = args[ARG_scale].u_int;
+    mp_arg_validate_int_range(scale, 0, 3, MP_QSTR_scale);
+
+    int width = common_hal_jpegio_jpegdecoder_get_width(self) >> scale;
+    int height = common_hal_jpegio_jpegdecoder_get_height(self) >> scale;
+    bitmaptools_rect_t lim = bitmaptools_validate_coord_range_pair(&args[ARG_x1], width, height);
+
+    common_hal_jpegio_jpegdecoder_decode_rows(self, bitmap, scale, &lim, rows_ready);
+
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(jpegio_jpegdecoder_decode_rows_obj, 1, jpegio_jpegdecoder_decode_rows);
+
 static const mp_rom_map_elem_t jpegio_jpegdecoder_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&jpegio_jpegdecoder_open_obj) },
     { MP_ROM_QSTR(MP_QSTR_decode), MP_ROM_PTR(&jpegio_jpegdecoder_decode_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decode_rows), MP_ROM_PTR(&jpegio_jpegdecoder_decode_rows_obj) },
 };
 static MP_DEFINE_CONST_DICT(jpegio_jpegdecoder_locals_dict, jpegio_jpegdecoder_locals_dict_table);
 
@@ -25,3 +25,9 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     bitmaptools_rect_t *lim,
     uint32_t skip_source_index, bool skip_source_index_none,
     uint32_t skip_dest_index, bool skip_dest_index_none);
+void common_hal_jpegio_jpegdecoder_decode_rows(
+    jpegio_jpegdecoder_obj_t *self,
+    displayio_bitmap_t *bitmap, int scale,
+    bitmaptools_rect_t *lim, mp_obj_t callback);
+uint16_t common_hal_jpegio_jpegdecoder_get_width(jpegio_jpegdecoder_obj_t *self);
+uint16_t common_hal_jpegio_jpegdecoder_get_height(jpegio_jpegdecoder_obj_t *self);
@@ -13,26 +13,43 @@
 #include "py/enum.h"
 
 //| class QRDecoder:
-//|     def __init__(self, width: int, height: int) -> None:
+//|     def __init__(
+//|         self, width: int, height: int, *, scale: int = 1, binarize: bool = False
+//|     ) -> None:
 //|         """Construct a QRDecoder object
 //|
+//|         Each image is converted to greyscale in a single pass before it is searched.
+//|         A ``scale`` above 1 averages each ``scale``×``scale`` block of pixels into one, so
+//|         there is less to search. This suits a camera that is close to the code. With
+//|         ``binarize``, each pixel is also turned black or white against the pixels around
+//|         it. Then images with nothing that looks like the corner of a QR code are
+//|         rejected at once, without the full search.
+//|
 //|         :param int width: The pixel width of the image to decode
 //|         :param int height: The pixel height of the image to decode
+//|         :param int scale: How many image pixels across and down make one searched pixel, 1 to 8
+//|         :param bool binarize: Whether to threshold the image and skip images without QR codes
 //|         """
 //|         ...
 //|
 
 static mp_obj_t qrio_qrdecoder_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args_in) {
-    enum { ARG_width, ARG_height };
+    enum { ARG_width, ARG_height, ARG_scale, ARG_binarize };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_width, MP_ARG_INT | MP_ARG_REQUIRED, {.u_int = 0} },
         { MP_QSTR_height, MP_ARG_INT | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_scale, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+        { MP_QSTR_binarize, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, args_in, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
+    mp_int_t scale = mp_arg_validate_int_range(args[ARG_scale].u_int, 1, 8, MP_QSTR_scale);
+    mp_int_t width = mp_arg_validate_int_min(args[ARG_width].u_int, scale, MP_QSTR_width);
+    mp_int_t height = mp_arg_validate_int_min(args[ARG_height].u_int, scale, MP_QSTR_height);
+
     qrio_qrdecoder_obj_t *self = mp_obj_malloc(qrio_qrdecoder_obj_t, &qrio_qrdecoder_type_obj);
-    shared_module_qrio_qrdecoder_construct(self, args[ARG_width].u_int, args[ARG_height].u_int);
+    shared_module_qrio_qrdecoder_construct(self, width, height, scale, args[ARG_binarize].u_bool);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -53,7 +70,8 @@ static void verify_buffer_size(qrio_qrdecoder_obj_t *self, mp_obj_t *buffer, siz
 //|     def decode(
 //|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
 //|     ) -> List[QRInfo]:
-//|         """Decode zero or more QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`."""
+//|         """Decode zero or more QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`.
+//|         Only the `roi` of the image is searched."""
 //|
 static mp_obj_t qrio_qrdecoder_decode(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
@@ -79,7 +97,8 @@ MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_decode_obj, 1, qrio_qrdecoder_decode);
 //|     def find(
 //|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
 //|     ) -> List[QRPosition]:
-//|         """Find all visible QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`."""
+//|         """Find all visible QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`.
+//|         Only the `roi` of the image is searched, and the positions are in image pixels."""
 //|
 static mp_obj_t qrio_qrdecoder_find(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
@@ -112,7 +131,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(qrio_qrdecoder_get_width_obj, qrio_qrdecoder_get_width
 
 static mp_obj_t qrio_qrdecoder_set_width(mp_obj_t self_in, mp_obj_t width_in) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    int width = mp_obj_get_int(width_in);
+    int width = mp_arg_validate_int_min(mp_obj_get_int(width_in), shared_module_qrio_qrdecoder_get_scale(self), MP_QSTR_width);
     shared_module_qrio_qrdecoder_set_width(self, width);
     return mp_const_none;
 }
@@ -124,8 +143,6 @@ MP_PROPERTY_GETSET(qrio_qrdecoder_width_obj,
 
 //|     height: int
 //|     """The height of image the decoder expects"""
-//|
-//|
 static mp_obj_t qrio_qrdecoder_get_height(mp_obj_t self_in) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
     return mp_obj_new_int(shared_module_qrio_qrdecoder_get_height(self));
@@ -134,7 +151,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(qrio_qrdecoder_get_height_obj, qrio_qrdecoder_get_heig
 
 static mp_obj_t qrio_qrdecoder_set_height(mp_obj_t self_in, mp_obj_t height_in) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    int height = mp_obj_get_int(height_in);
+    int height = mp_arg_validate_int_min(mp_obj_get_int(height_in), shared_module_qrio_qrdecoder_get_scale(self), MP_QSTR_height);
     shared_module_qrio_qrdecoder_set_height(self, height);
     return mp_const_none;
 }
@@ -144,10 +161,81 @@ MP_PROPERTY_GETSET(qrio_qrdecoder_height_obj,
     (mp_obj_t)&qrio_qrdecoder_get_height_obj,
     (mp_obj_t)&qrio_qrdecoder_set_height_obj);
 
+//|     scale: int
+//|     """How many image pixels across and down make one searched pixel (read only)"""
+static mp_obj_t qrio_qrdecoder_get_scale(mp_obj_t self_in) {
+    qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int(shared_module_qrio_qrdecoder_get_scale(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(qrio_qrdecoder_get_scale_obj, qrio_qrdecoder_get_scale);
+
+MP_PROPERTY_GETTER(qrio_qrdecoder_scale_obj,
+    (mp_obj_t)&qrio_qrdecoder_get_scale_obj);
+
+//|     roi: Tuple[int, int, int, int]
+//|     """The part of the image that is searched, as ``(x1, y1, x2, y2)`` with ``x2`` and ``y2``
+//|     just past its right and bottom edges. Setting it to ``None`` searches the whole image.
+//|     It is also reset when `width` or `height` change."""
+static mp_obj_t qrio_qrdecoder_get_roi(mp_obj_t self_in) {
+    qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return shared_module_qrio_qrdecoder_get_roi(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(qrio_qrdecoder_get_roi_obj, qrio_qrdecoder_get_roi);
+
+static mp_obj_t qrio_qrdecoder_set_roi(mp_obj_t self_in, mp_obj_t roi_in) {
+    qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (roi_in == mp_const_none) {
+        shared_module_qrio_qrdecoder_reset_roi(self);
+        return mp_const_none;
+    }
+    mp_obj_t *items;
+    mp_obj_get_array_fixed_n(roi_in, 4, &items);
+    int width = shared_module_qrio_qrdecoder_get_width(self);
+    int height = shared_module_qrio_qrdecoder_get_height(self);
+    int scale = shared_module_qrio_qrdecoder_get_scale(self);
+    mp_int_t x1 = mp_arg_validate_int_range(mp_obj_get_int(items[0]), 0, width - scale, MP_QSTR_x1);
+    mp_int_t y1 = mp_arg_validate_int_range(mp_obj_get_int(items[1]), 0, height - scale, MP_QSTR_y1);
+    mp_int_t x2 = mp_arg_validate_int_range(mp_obj_get_int(items[2]), x1 + scale, width, MP_QSTR_x2);
+    mp_int_t y2 = mp_arg_validate_int_range(mp_obj_get_int(items[3]), y1 + scale, height, MP_QSTR_y2);
+    shared_module_qrio_qrdecoder_set_roi(self, x1, y1, x2, y2);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(qrio_qrdecoder_set_roi_obj, qrio_qrdecoder_set_roi);
+
+MP_PROPERTY_GETSET(qrio_qrdecoder_roi_obj,
+    (mp_obj_t)&qrio_qrdecoder_get_roi_obj,
+    (mp_obj_t)&qrio_qrdecoder_set_roi_obj);
+
+//|     track: bool
+//|     """Whether to follow codes from one image to the next. When `decode` or `find` sees a
+//|     code, `roi` is set to the area around it, so the next image is searched only there.
+//|     When no code is seen, the whole image is searched again."""
+//|
+//|
+static mp_obj_t qrio_qrdecoder_get_track(mp_obj_t self_in) {
+    qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(shared_module_qrio_qrdecoder_get_track(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(qrio_qrdecoder_get_track_obj, qrio_qrdecoder_get_track);
+
+static mp_obj_t qrio_qrdecoder_set_track(mp_obj_t self_in, mp_obj_t track_in) {
+    qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    shared_module_qrio_qrdecoder_set_track(self, mp_obj_is_true(track_in));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(qrio_qrdecoder_set_track_obj, qrio_qrdecoder_set_track);
+
+MP_PROPERTY_GETSET(qrio_qrdecoder_track_obj,
+    (mp_obj_t)&qrio_qrdecoder_get_track_obj,
+    (mp_obj_t)&qrio_qrdecoder_set_track_obj);
+
 static const mp_rom_map_elem_t qrio_qrdecoder_locals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_QRDecoder) },
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&qrio_qrdecoder_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&qrio_qrdecoder_height_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scale), MP_ROM_PTR(&qrio_qrdecoder_scale_obj) },
+    { MP_ROM_QSTR(MP_QSTR_roi), MP_ROM_PTR(&qrio_qrdecoder_roi_obj) },
+    { MP_ROM_QSTR(MP_QSTR_track), MP_ROM_PTR(&qrio_qrdecoder_track_obj) },
     { MP_ROM_QSTR(MP_QSTR_decode), MP_ROM_PTR(&qrio_qrdecoder_decode_obj) },
     { MP_ROM_QSTR(MP_QSTR_find), MP_ROM_PTR(&qrio_qrdecoder_find_obj) },
 };
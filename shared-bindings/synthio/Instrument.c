@@ -0,0 +1,157 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/synthio/Instrument.h"
+#include "shared-bindings/util.h"
+#include "shared-module/synthio/Instrument.h"
+
+//| class Instrument:
+//|     def __init__(
+//|         self,
+//|         samples: ReadableBuffer,
+//|         zones: Sequence[Tuple[int, int, float, int, int, int]],
+//|         *,
+//|         sample_rate: int,
+//|         envelope: Optional[Envelope] = None,
+//|     ) -> None:
+//|         """A bank of recorded samples shared by many `Note` objects.
+//|
+//|         A note that has an ``instrument`` plays the zone of the instrument that
+//|         covers the MIDI key nearest its frequency, pitched up or down from the zone's
+//|         root key. Each zone plays from ``start`` to ``loop_end`` and then repeats the
+//|         part from ``loop_start`` to ``loop_end`` until the note ends.
+//|
+//|         The sample data is used where it is, not copied, and the zones and envelope are
+//|         stored once, however many notes use the instrument.
+//|
+//|         :param ReadableBuffer samples: The sample data, as signed 16 bit values. Either an array of type ``'h'``,
+//|           or bytes that hold little-endian 16 bit values, such as data stored in flash
+//|         :param Sequence zones: Up to 255 zones, each a tuple
+//|           ``(low_key, high_key, root_key, start, loop_start, loop_end)``. The zone plays the MIDI
+//|           keys from ``low_key`` to ``high_key`` inclusive, and sounds at its recorded pitch for
+//|           ``root_key``, from 0 to 127, which can be fractional to tune it. The positions count samples from the
+//|           start of ``samples``, and a zone can span up to 32767 samples. Where zones overlap, the
+//|           first one listed plays
+//|         :param int sample_rate: The sample rate the samples were recorded at, up to 131072
+//|         :param Optional[Envelope] envelope: The envelope of notes that do not have their own envelope
+//|
+//|         Playing a looped sample across an octave::
+//|
+//|           import array
+//|           import synthio
+//|
+//|           samples = array.array("h", ...)  # recorded at 22050Hz, of middle C
+//|           instrument = synthio.Instrument(samples, [(54, 66, 60, 0, 1000, 2000)], sample_rate=22050)
+//|           synth = synthio.Synthesizer(sample_rate=22050)
+//|           synth.press(synthio.Note(synthio.midi_to_hz(62), instrument=instrument))
+//|         """
+//|
+static mp_obj_t synthio_instrument_make_new(const mp_obj_type_t *type_in, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_samples, ARG_zones, ARG_sample_rate, ARG_envelope };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_samples, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_zones, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY | MP_ARG_REQUIRED },
+        { MP_QSTR_envelope, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t sample_rate = mp_arg_validate_int_range(args[ARG_sample_rate].u_int, 1, SYNTHIO_INSTRUMENT_MAX_SAMPLE_RATE, MP_QSTR_sample_rate);
+
+    synthio_instrument_obj_t *self = mp_obj_malloc(synthio_instrument_obj_t, &synthio_instrument_type);
+    common_hal_synthio_instrument_construct(self, args[ARG_samples].u_obj, args[ARG_zones].u_obj,
+        sample_rate, args[ARG_envelope].u_obj);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def zone_for_key(self, key: int) -> Optional[int]:
+//|         """The index of the zone that plays the MIDI key ``key``, or `None` if no zone does"""
+//|         ...
+//|
+static mp_obj_t synthio_instrument_zone_for_key(mp_obj_t self_in, mp_obj_t key) {
+    synthio_instrument_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_instrument_zone_for_key(self, mp_obj_get_int(key));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_instrument_zone_for_key_obj, synthio_instrument_zone_for_key);
+
+//|     samples: ReadableBuffer
+//|     """The sample data (read-only)"""
+//|
+static mp_obj_t synthio_instrument_get_samples(mp_obj_t self_in) {
+    synthio_instrument_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_instrument_get_samples(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_instrument_get_samples_obj, synthio_instrument_get_samples);
+
+MP_PROPERTY_GETTER(synthio_instrument_samples_obj,
+    (mp_obj_t)&synthio_instrument_get_samples_obj);
+
+//|     sample_rate: int
+//|     """The sample rate the samples were recorded at (read-only)"""
+//|
+static mp_obj_t synthio_instrument_get_sample_rate(mp_obj_t self_in) {
+    synthio_instrument_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_synthio_instrument_get_sample_rate(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_instrument_get_sample_rate_obj, synthio_instrument_get_sample_rate);
+
+MP_PROPERTY_GETTER(synthio_instrument_sample_rate_obj,
+    (mp_obj_t)&synthio_instrument_get_sample_rate_obj);
+
+//|     zone_count: int
+//|     """The number of zones (read-only)"""
+//|
+static mp_obj_t synthio_instrument_get_zone_count(mp_obj_t self_in) {
+    synthio_instrument_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_instrument_get_zone_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_instrument_get_zone_count_obj, synthio_instrument_get_zone_count);
+
+MP_PROPERTY_GETTER(synthio_instrument_zone_count_obj,
+    (mp_obj_t)&synthio_instrument_get_zone_count_obj);
+
+//|     envelope: Optional[Envelope]
+//|     """The envelope of notes that play this instrument and do not have their own envelope.
+//|     If `None`, the synthesizer's envelope is used."""
+//|
+//|
+static mp_obj_t synthio_instrument_get_envelope(mp_obj_t self_in) {
+    synthio_instrument_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_instrument_get_envelope(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_instrument_get_envelope_obj, synthio_instrument_get_envelope);
+
+static mp_obj_t synthio_instrument_set_envelope(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_instrument_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_instrument_set_envelope(self, arg);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_instrument_set_envelope_obj, synthio_instrument_set_envelope);
+
+MP_PROPERTY_GETSET(synthio_instrument_envelope_obj,
+    (mp_obj_t)&synthio_instrument_get_envelope_obj,
+    (mp_obj_t)&synthio_instrument_set_envelope_obj);
+
+static const mp_rom_map_elem_t synthio_instrument_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_zone_for_key), MP_ROM_PTR(&synthio_instrument_zone_for_key_obj) },
+    { MP_ROM_QSTR(MP_QSTR_samples), MP_ROM_PTR(&synthio_instrument_samples_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&synthio_instrument_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_zone_count), MP_ROM_PTR(&synthio_instrument_zone_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_envelope), MP_ROM_PTR(&synthio_instrument_envelope_obj) },
+};
+static MP_DEFINE_CONST_DICT(synthio_instrument_locals_dict, synthio_instrument_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    synthio_instrument_type,
+    MP_QSTR_Instrument,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, synthio_instrument_make_new,
+    locals_dict, &synthio_instrument_locals_dict
+    );
@@ -0,0 +1,23 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef struct synthio_instrument_obj synthio_instrument_obj_t;
+extern const mp_obj_type_t synthio_instrument_type;
+
+void common_hal_synthio_instrument_construct(synthio_instrument_obj_t *self,
+    mp_obj_t samples, mp_obj_t zones, uint32_t sample_rate, mp_obj_t envelope);
+
+mp_obj_t common_hal_synthio_instrument_get_samples(synthio_instrument_obj_t *self);
+uint32_t common_hal_synthio_instrument_get_sample_rate(synthio_instrument_obj_t *self);
+mp_int_t common_hal_synthio_instrument_get_zone_count(synthio_instrument_obj_t *self);
+mp_obj_t common_hal_synthio_instrument_zone_for_key(synthio_instrument_obj_t *self, mp_int_t key);
+
+mp_obj_t common_hal_synthio_instrument_get_envelope(synthio_instrument_obj_t *self);
+void common_hal_synthio_instrument_set_envelope(synthio_instrument_obj_t *self, mp_obj_t envelope);
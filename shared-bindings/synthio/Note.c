@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 
+#include "py/enum.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
 #include "shared-bindings/util.h"
@@ -14,6 +15,22 @@
 #include "shared-bindings/synthio/Note.h"
 #include "shared-module/synthio/Note.h"
 
+MAKE_ENUM_VALUE(synthio_interpolation_type, synthio_interpolation, NONE, SYNTHIO_INTERPOLATION_NONE);
+MAKE_ENUM_VALUE(synthio_interpolation_type, synthio_interpolation, LINEAR, SYNTHIO_INTERPOLATION_LINEAR);
+MAKE_ENUM_VALUE(synthio_interpolation_type, synthio_interpolation, CUBIC, SYNTHIO_INTERPOLATION_CUBIC);
+
+MAKE_ENUM_MAP(synthio_interpolation) {
+    MAKE_ENUM_MAP_ENTRY(synthio_interpolation, NONE),
+    MAKE_ENUM_MAP_ENTRY(synthio_interpolation, LINEAR),
+    MAKE_ENUM_MAP_ENTRY(synthio_interpolation, CUBIC),
+};
+
+static MP_DEFINE_CONST_DICT(synthio_interpolation_locals_dict, synthio_interpolation_locals_table);
+
+MAKE_PRINTER(synthio, synthio_interpolation);
+
+MAKE_ENUM_TYPE(synthio, Interpolation, synthio_interpolation);
+
 static const mp_arg_t note_properties[] = {
     { MP_QSTR_frequency, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = NULL } },
     { MP_QSTR_panning, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(0) } },
@@ -29,7 +46,21 @@ static const mp_arg_t note_properties[] = {
     { MP_QSTR_ring_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
     { MP_QSTR_ring_waveform_loop_start, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(0) } },
     { MP_QSTR_ring_waveform_loop_end, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(SYNTHIO_WAVEFORM_SIZE) } },
+    { MP_QSTR_interpolation, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = (void *)&synthio_interpolation_NONE_obj } },
+    { MP_QSTR_instrument, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
 };
+
+//| class Interpolation:
+//|     """How a note's waveform is sampled between its stored values"""
+//|
+//|     NONE: Interpolation
+//|     """Use the nearest stored value. This is the fastest, but produces the most aliasing"""
+//|     LINEAR: Interpolation
+//|     """Interpolate linearly between the two nearest values"""
+//|     CUBIC: Interpolation
+//|     """Interpolate with a cubic curve through the four nearest values. This is the slowest but smoothest"""
+//|
+//|
 //| class Note:
 //|     def __init__(
 //|         self,
@@ -48,10 +79,14 @@ static const mp_arg_t note_properties[] = {
 //|         ring_waveform: Optional[ReadableBuffer] = None,
 //|         ring_waveform_loop_start: BlockInput = 0,
 //|         ring_waveform_loop_end: BlockInput = waveform_max_length,
+//|         interpolation: Interpolation = Interpolation.NONE,
+//|         instrument: Optional[Instrument] = None,
 //|     ) -> None:
 //|         """Construct a Note object, with a frequency in Hz, and optional panning, waveform, envelope, tremolo (volume change) and bend (frequency change).
 //|
 //|         If waveform or envelope are `None` the synthesizer object's default waveform or envelope are used.
+//|         If instrument is given, the note plays the instrument's samples instead of a waveform, and
+//|         uses the instrument's envelope when its own envelope is `None`.
 //|
 //|         If the same Note object is played on multiple Synthesizer objects, the result is undefined.
 //|         """
@@ -376,6 +411,48 @@ MP_PROPERTY_GETSET(synthio_note_ring_waveform_loop_end_obj,
 
 
 
+//|     interpolation: Interpolation
+//|     """How the waveform and ring waveform are sampled between their stored values.
+//|
+//|     Interpolation reduces the aliasing heard with short waveforms and low notes at the
+//|     cost of some speed."""
+//|
+static mp_obj_t synthio_note_get_interpolation(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return cp_enum_find(&synthio_interpolation_type, common_hal_synthio_note_get_interpolation(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_interpolation_obj, synthio_note_get_interpolation);
+
+static mp_obj_t synthio_note_set_interpolation(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_interpolation(self, cp_enum_value(&synthio_interpolation_type, arg, MP_QSTR_interpolation));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_interpolation_obj, synthio_note_set_interpolation);
+MP_PROPERTY_GETSET(synthio_note_interpolation_obj,
+    (mp_obj_t)&synthio_note_get_interpolation_obj,
+    (mp_obj_t)&synthio_note_set_interpolation_obj);
+
+//|     instrument: Optional[Instrument]
+//|     """The instrument this note plays, in place of its waveform. The instrument's zone is chosen
+//|     from the note's frequency when the note is pressed."""
+//|
+static mp_obj_t synthio_note_get_instrument(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_note_get_instrument_obj(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_instrument_obj, synthio_note_get_instrument);
+
+static mp_obj_t synthio_note_set_instrument(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_instrument(self, arg);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_instrument_obj, synthio_note_set_instrument);
+MP_PROPERTY_GETSET(synthio_note_instrument_obj,
+    (mp_obj_t)&synthio_note_get_instrument_obj,
+    (mp_obj_t)&synthio_note_set_instrument_obj);
+
 static void note_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     (void)kind;
     properties_print_helper(print, self_in, note_properties, MP_ARRAY_SIZE(note_properties));
@@ -396,6 +473,8 @@ static const mp_rom_map_elem_t synthio_note_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_ring_waveform), MP_ROM_PTR(&synthio_note_ring_waveform_obj) },
     { MP_ROM_QSTR(MP_QSTR_ring_waveform_loop_start), MP_ROM_PTR(&synthio_note_ring_waveform_loop_start_obj) },
     { MP_ROM_QSTR(MP_QSTR_ring_waveform_loop_end), MP_ROM_PTR(&synthio_note_ring_waveform_loop_end_obj) },
+    { MP_ROM_QSTR(MP_QSTR_interpolation), MP_ROM_PTR(&synthio_note_interpolation_obj) },
+    { MP_ROM_QSTR(MP_QSTR_instrument), MP_ROM_PTR(&synthio_note_instrument_obj) },
 };
 static MP_DEFINE_CONST_DICT(synthio_note_locals_dict, synthio_note_locals_dict_table);
 
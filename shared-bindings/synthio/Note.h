@@ -12,6 +12,11 @@
 typedef struct synthio_note_obj synthio_note_obj_t;
 extern const mp_obj_type_t synthio_note_type;
 typedef enum synthio_bend_mode_e synthio_bend_mode_t;
+extern const mp_obj_type_t synthio_interpolation_type;
+
+typedef enum {
+    SYNTHIO_INTERPOLATION_NONE, SYNTHIO_INTERPOLATION_LINEAR, SYNTHIO_INTERPOLATION_CUBIC,
+} synthio_interpolation_t;
 
 mp_float_t common_hal_synthio_note_get_frequency(synthio_note_obj_t *self);
 void common_hal_synthio_note_set_frequency(synthio_note_obj_t *self, mp_float_t value);
@@ -52,5 +57,11 @@ void common_hal_synthio_note_set_ring_waveform_loop_start(synthio_note_obj_t *se
 mp_obj_t common_hal_synthio_note_get_ring_waveform_loop_end(synthio_note_obj_t *self);
 void common_hal_synthio_note_set_ring_waveform_loop_end(synthio_note_obj_t *self, mp_obj_t value);
 
+synthio_interpolation_t common_hal_synthio_note_get_interpolation(synthio_note_obj_t *self);
+void common_hal_synthio_note_set_interpolation(synthio_note_obj_t *self, synthio_interpolation_t value);
+
 mp_obj_t common_hal_synthio_note_get_envelope_obj(synthio_note_obj_t *self);
 void common_hal_synthio_note_set_envelope(synthio_note_obj_t *self, mp_obj_t value);
+
+mp_obj_t common_hal_synthio_note_get_instrument_obj(synthio_note_obj_t *self);
+void common_hal_synthio_note_set_instrument(synthio_note_obj_t *self, mp_obj_t value);
@@ -16,6 +16,8 @@
 #include "shared-bindings/synthio/Biquad.h"
 #include "shared-bindings/synthio/Synthesizer.h"
 #include "shared-bindings/synthio/LFO.h"
+#include "shared-bindings/synthio/Note.h"
+#include "shared-module/synthio/block.h"
 #include "shared-bindings/synthio/__init__.h"
 #include "shared-bindings/audiocore/__init__.h"
 
@@ -35,6 +37,7 @@
 //|         channel_count: int = 1,
 //|         waveform: Optional[ReadableBuffer] = None,
 //|         envelope: Optional[Envelope] = None,
+//|         polyphony: Optional[int] = None,
 //|     ) -> None:
 //|         """Create a synthesizer object.
 //|
@@ -48,25 +51,30 @@
 //|         :param int channel_count: The number of output channels (1=mono, 2=stereo)
 //|         :param ReadableBuffer waveform: A single-cycle waveform. Default is a 50% duty cycle square wave. If specified, must be a ReadableBuffer of type 'h' (signed 16 bit)
 //|         :param Optional[Envelope] envelope: An object that defines the loudness of a note over time. The default envelope, `None` provides no ramping, voices turn instantly on and off.
+//|         :param Optional[int] polyphony: The number of notes that can sound at once, from 1 to 255. The default, `None`, uses `max_polyphony`. Each voice uses a little RAM. When every voice is busy, pressing another note takes over a voice: a released note first, otherwise the quietest and then the oldest playing note.
 //|         """
 //|
 static mp_obj_t synthio_synthesizer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_sample_rate, ARG_channel_count, ARG_waveform, ARG_envelope };
+    enum { ARG_sample_rate, ARG_channel_count, ARG_waveform, ARG_envelope, ARG_polyphony };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 11025} },
         { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
         { MP_QSTR_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
         { MP_QSTR_envelope, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
+        { MP_QSTR_polyphony, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
+    mp_int_t polyphony = args[ARG_polyphony].u_obj == mp_const_none ? CIRCUITPY_SYNTHIO_MAX_CHANNELS : mp_obj_get_int(args[ARG_polyphony].u_obj);
+
     synthio_synthesizer_obj_t *self = mp_obj_malloc(synthio_synthesizer_obj_t, &synthio_synthesizer_type);
     common_hal_synthio_synthesizer_construct(self,
         args[ARG_sample_rate].u_int,
         args[ARG_channel_count].u_int,
         args[ARG_waveform].u_obj,
-        args[ARG_envelope].u_obj);
+        args[ARG_envelope].u_obj,
+        polyphony);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -180,6 +188,75 @@ static mp_obj_t synthio_synthesizer_release_all(mp_obj_t self_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_release_all_obj, synthio_synthesizer_release_all);
 
+//|     def press_at(self, note: Union[int, Note], time: int) -> None:
+//|         """Turn a note on when `sample_time` reaches ``time``.
+//|
+//|         The output is split at ``time`` so that the note starts on exactly that sample,
+//|         however the audio is buffered. A ``time`` that has already passed takes effect
+//|         at the start of the next buffer.
+//|
+//|         :param Union[int, Note] note: The note to press
+//|         :param int time: The sample number to press it at"""
+//|
+static mp_obj_t synthio_synthesizer_press_at(mp_obj_t self_in, mp_obj_t note, mp_obj_t time) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_press_at(self, note, (uint32_t)mp_obj_int_get_truncated(time));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(synthio_synthesizer_press_at_obj, synthio_synthesizer_press_at);
+
+//|     def release_at(self, note: Union[int, Note], time: int) -> None:
+//|         """Turn a note off when `sample_time` reaches ``time``. See `press_at`.
+//|
+//|         :param Union[int, Note] note: The note to release
+//|         :param int time: The sample number to release it at"""
+//|
+static mp_obj_t synthio_synthesizer_release_at(mp_obj_t self_in, mp_obj_t note, mp_obj_t time) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_release_at(self, note, (uint32_t)mp_obj_int_get_truncated(time));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(synthio_synthesizer_release_at_obj, synthio_synthesizer_release_at);
+
+//|     def set_at(self, target: Union[Note, BlockInput], name: str, value: object, time: int) -> None:
+//|         """Set a property of a `Note`, `LFO` or `Math` object when `sample_time` reaches ``time``.
+//|         See `press_at`.
+//|
+//|         A value the property does not accept is ignored when the time comes.
+//|
+//|         :param Union[Note, BlockInput] target: The object to change
+//|         :param str name: The name of the property, such as ``"rate"``
+//|         :param object value: The new value of the property
+//|         :param int time: The sample number to change it at"""
+//|
+static mp_obj_t synthio_synthesizer_set_at(size_t n_args, const mp_obj_t *args) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    check_for_deinit(self);
+    mp_obj_t target = args[1];
+    if (!synthio_obj_is_block(target) && !mp_obj_is_type(target, &synthio_note_type)) {
+        mp_raise_TypeError_varg(MP_ERROR_TEXT("%q must be of type %q or %q, not %q"),
+            MP_QSTR_target, MP_QSTR_Note, MP_QSTR_BlockInput, mp_obj_get_type(target)->name);
+    }
+    qstr attr = mp_obj_str_get_qstr(args[2]);
+    common_hal_synthio_synthesizer_set_at(self, target, attr, args[3], (uint32_t)mp_obj_int_get_truncated(args[4]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(synthio_synthesizer_set_at_obj, 5, 5, synthio_synthesizer_set_at);
+
+//|     def cancel_events(self) -> None:
+//|         """Forget the presses, releases and changes scheduled with `press_at`, `release_at` and `set_at`
+//|         that have not happened yet"""
+//|
+static mp_obj_t synthio_synthesizer_cancel_events(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_cancel_events(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_cancel_events_obj, synthio_synthesizer_cancel_events);
+
 //|     def deinit(self) -> None:
 //|         """Deinitialises the object and releases any memory resources for reuse."""
 //|         ...
@@ -228,6 +305,47 @@ MP_PROPERTY_GETSET(synthio_synthesizer_envelope_obj,
 //|     sample_rate: int
 //|     """32 bit value that tells how quickly samples are played in Hertz (cycles per second)."""
 
+//|     max_polyphony: int
+//|     """The number of voices used when ``polyphony`` is not given to the constructor"""
+
+//|     polyphony: int
+//|     """The number of notes that can sound at once (read-only)"""
+static mp_obj_t synthio_synthesizer_obj_get_polyphony(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_synthesizer_get_polyphony(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_polyphony_obj, synthio_synthesizer_obj_get_polyphony);
+
+MP_PROPERTY_GETTER(synthio_synthesizer_polyphony_obj,
+    (mp_obj_t)&synthio_synthesizer_get_polyphony_obj);
+
+//|     cpu_budget: float
+//|     """The fraction of real time, from 0 to 1, that producing one buffer of audio may take.
+//|
+//|     When producing a buffer takes longer than this, one voice is stopped immediately:
+//|     a released note first, otherwise the quietest and then the oldest playing note.
+//|     This keeps playback free of gaps when too many complex notes are pressed, at
+//|     the cost of cutting some of them short. The default, 0, disables this check."""
+static mp_obj_t synthio_synthesizer_obj_get_cpu_budget(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_synthio_synthesizer_get_cpu_budget(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_cpu_budget_obj, synthio_synthesizer_obj_get_cpu_budget);
+
+static mp_obj_t synthio_synthesizer_obj_set_cpu_budget(mp_obj_t self_in, mp_obj_t value) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_set_cpu_budget(self, mp_arg_validate_obj_float_range(value, 0, 1, MP_QSTR_cpu_budget));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_synthesizer_set_cpu_budget_obj, synthio_synthesizer_obj_set_cpu_budget);
+
+MP_PROPERTY_GETSET(synthio_synthesizer_cpu_budget_obj,
+    (mp_obj_t)&synthio_synthesizer_get_cpu_budget_obj,
+    (mp_obj_t)&synthio_synthesizer_set_cpu_budget_obj);
+
 //|     pressed: NoteSequence
 //|     """A sequence of the currently pressed notes (read-only property).
 //|
@@ -268,7 +386,6 @@ MP_DEFINE_CONST_FUN_OBJ_2(synthio_synthesizer_note_info_obj, synthio_synthesizer
 //|
 //|     This property is read-only but its contents may be modified by e.g., calling ``synth.blocks.append()`` or ``synth.blocks.remove()``. It is initially an empty list."""
 //|
-//|
 static mp_obj_t synthio_synthesizer_obj_get_blocks(mp_obj_t self_in) {
     synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
@@ -279,6 +396,21 @@ MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_blocks_obj, synthio_synthesize
 MP_PROPERTY_GETTER(synthio_synthesizer_blocks_obj,
     (mp_obj_t)&synthio_synthesizer_get_blocks_obj);
 
+//|     sample_time: int
+//|     """The number of samples produced so far, modulo 2**32. Times given to `press_at`, `release_at`
+//|     and `set_at` count from the same start. (read only)"""
+//|
+//|
+static mp_obj_t synthio_synthesizer_obj_get_sample_time(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_synthio_synthesizer_get_sample_time(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_sample_time_obj, synthio_synthesizer_obj_get_sample_time);
+
+MP_PROPERTY_GETTER(synthio_synthesizer_sample_time_obj,
+    (mp_obj_t)&synthio_synthesizer_get_sample_time_obj);
+
 static const mp_rom_map_elem_t synthio_synthesizer_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_press), MP_ROM_PTR(&synthio_synthesizer_press_obj) },
@@ -287,6 +419,10 @@ static const mp_rom_map_elem_t synthio_synthesizer_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_change), MP_ROM_PTR(&synthio_synthesizer_change_obj) },
     { MP_ROM_QSTR(MP_QSTR_release_then_press), MP_ROM_PTR(&synthio_synthesizer_change_obj) },
     { MP_ROM_QSTR(MP_QSTR_release_all_then_press), MP_ROM_PTR(&synthio_synthesizer_release_all_then_press_obj) },
+    { MP_ROM_QSTR(MP_QSTR_press_at), MP_ROM_PTR(&synthio_synthesizer_press_at_obj) },
+    { MP_ROM_QSTR(MP_QSTR_release_at), MP_ROM_PTR(&synthio_synthesizer_release_at_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_at), MP_ROM_PTR(&synthio_synthesizer_set_at_obj) },
+    { MP_ROM_QSTR(MP_QSTR_cancel_events), MP_ROM_PTR(&synthio_synthesizer_cancel_events_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&synthio_synthesizer_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
@@ -294,9 +430,12 @@ static const mp_rom_map_elem_t synthio_synthesizer_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_envelope), MP_ROM_PTR(&synthio_synthesizer_envelope_obj) },
     { MP_ROM_QSTR(MP_QSTR_max_polyphony), MP_ROM_INT(CIRCUITPY_SYNTHIO_MAX_CHANNELS) },
+    { MP_ROM_QSTR(MP_QSTR_polyphony), MP_ROM_PTR(&synthio_synthesizer_polyphony_obj) },
+    { MP_ROM_QSTR(MP_QSTR_cpu_budget), MP_ROM_PTR(&synthio_synthesizer_cpu_budget_obj) },
     { MP_ROM_QSTR(MP_QSTR_pressed), MP_ROM_PTR(&synthio_synthesizer_pressed_obj) },
     { MP_ROM_QSTR(MP_QSTR_note_info), MP_ROM_PTR(&synthio_synthesizer_note_info_obj) },
     { MP_ROM_QSTR(MP_QSTR_blocks), MP_ROM_PTR(&synthio_synthesizer_blocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample_time), MP_ROM_PTR(&synthio_synthesizer_sample_time_obj) },
     AUDIOSAMPLE_FIELDS,
 };
 static MP_DEFINE_CONST_DICT(synthio_synthesizer_locals_dict, synthio_synthesizer_locals_dict_table);
@@ -13,12 +13,20 @@ extern const mp_obj_type_t synthio_synthesizer_type;
 
 void common_hal_synthio_synthesizer_construct(synthio_synthesizer_obj_t *self,
     uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj,
-    mp_obj_t envelope_obj);
+    mp_obj_t envelope_obj, int polyphony);
 void common_hal_synthio_synthesizer_deinit(synthio_synthesizer_obj_t *self);
 void common_hal_synthio_synthesizer_release(synthio_synthesizer_obj_t *self, mp_obj_t to_release);
 void common_hal_synthio_synthesizer_press(synthio_synthesizer_obj_t *self, mp_obj_t to_press);
 void common_hal_synthio_synthesizer_retrigger(synthio_synthesizer_obj_t *self, mp_obj_t to_retrigger);
 void common_hal_synthio_synthesizer_release_all(synthio_synthesizer_obj_t *self);
+void common_hal_synthio_synthesizer_press_at(synthio_synthesizer_obj_t *self, mp_obj_t note, uint32_t time);
+void common_hal_synthio_synthesizer_release_at(synthio_synthesizer_obj_t *self, mp_obj_t note, uint32_t time);
+void common_hal_synthio_synthesizer_set_at(synthio_synthesizer_obj_t *self, mp_obj_t target, qstr attr, mp_obj_t value, uint32_t time);
+void common_hal_synthio_synthesizer_cancel_events(synthio_synthesizer_obj_t *self);
+uint32_t common_hal_synthio_synthesizer_get_sample_time(synthio_synthesizer_obj_t *self);
 mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_obj_t *self);
+mp_int_t common_hal_synthio_synthesizer_get_polyphony(synthio_synthesizer_obj_t *self);
+mp_float_t common_hal_synthio_synthesizer_get_cpu_budget(synthio_synthesizer_obj_t *self);
+void common_hal_synthio_synthesizer_set_cpu_budget(synthio_synthesizer_obj_t *self, mp_float_t value);
 mp_obj_t common_hal_synthio_synthesizer_get_blocks(synthio_synthesizer_obj_t *self);
 envelope_state_e common_hal_synthio_synthesizer_note_info(synthio_synthesizer_obj_t *self, mp_obj_t note, mp_float_t *vol_out);
@@ -5,10 +5,13 @@
 // SPDX-License-Identifier: MIT
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/obj.h"
 #include "py/runtime.h"
 
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/vectorio/__init__.h"
 #include "shared-bindings/vectorio/Circle.h"
 #include "shared-bindings/vectorio/Polygon.h"
 #include "shared-bindings/vectorio/Rectangle.h"
@@ -37,11 +40,57 @@
 //|
 //| """
 
+#if CIRCUITPY_VECTORIO_DEBUG
+// (no docstrings so that the debug functions are not shown on docs.circuitpython.org)
+
+// Fill the area x1, y1, x2, y2 of a 16 bit bitmap with the shapes as RGB565,
+// the way a Group does: the last shape is on top, and pixels no shape covers
+// are left as they are.
+static mp_obj_t vectorio_draw_area(size_t n_args, const mp_obj_t *args) {
+    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(mp_arg_validate_type(args[0], &displayio_bitmap_type, MP_QSTR_bitmap));
+    mp_arg_validate_int(bitmap->bits_per_value, 16, MP_QSTR_bits_per_value);
+    size_t shape_count;
+    mp_obj_t *shapes;
+    mp_obj_get_array(args[1], &shape_count, &shapes);
+    displayio_area_t area = {
+        .x1 = mp_arg_validate_int_range(mp_obj_get_int(args[2]), 0, bitmap->width - 1, MP_QSTR_x1),
+        .y1 = mp_arg_validate_int_range(mp_obj_get_int(args[3]), 0, bitmap->height - 1, MP_QSTR_y1),
+    };
+    area.x2 = mp_arg_validate_int_range(mp_obj_get_int(args[4]), area.x1 + 1, bitmap->width, MP_QSTR_x2);
+    area.y2 = mp_arg_validate_int_range(mp_obj_get_int(args[5]), area.y1 + 1, bitmap->height, MP_QSTR_y2);
+
+    static const _displayio_colorspace_t rgb565 = { .depth = 16, .bytes_per_cell = 2 };
+    int width = area.x2 - area.x1;
+    size_t pixels = width * (area.y2 - area.y1);
+    size_t mask_words = (pixels + 31) / 32;
+    uint32_t *mask = m_new(uint32_t, mask_words);
+    uint16_t *buffer = m_new(uint16_t, pixels);
+    memset(mask, 0, mask_words * sizeof(uint32_t));
+    for (size_t i = shape_count; i > 0; i--) {
+        const vectorio_draw_protocol_t *draw_protocol = mp_proto_get_or_throw(MP_QSTR_protocol_draw, shapes[i - 1]);
+        mp_obj_t shape = draw_protocol->draw_get_protocol_self(shapes[i - 1]);
+        draw_protocol->draw_protocol_impl->draw_fill_area(shape, &rgb565, &area, mask, (uint32_t *)buffer);
+    }
+    for (size_t i = 0; i < pixels; i++) {
+        if (mask[i / 32] & (1u << (i % 32))) {
+            common_hal_displayio_bitmap_set_pixel(bitmap, area.x1 + i % width, area.y1 + i / width, buffer[i]);
+        }
+    }
+    m_del(uint32_t, mask, mask_words);
+    m_del(uint16_t, buffer, pixels);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(vectorio_draw_area_obj, 6, 6, vectorio_draw_area);
+#endif
+
 static const mp_rom_map_elem_t vectorio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_vectorio) },
     { MP_ROM_QSTR(MP_QSTR_Circle), MP_ROM_PTR(&vectorio_circle_type) },
     { MP_ROM_QSTR(MP_QSTR_Polygon), MP_ROM_PTR(&vectorio_polygon_type) },
     { MP_ROM_QSTR(MP_QSTR_Rectangle), MP_ROM_PTR(&vectorio_rectangle_type) },
+    #if CIRCUITPY_VECTORIO_DEBUG
+    { MP_ROM_QSTR(MP_QSTR_draw_area), MP_ROM_PTR(&vectorio_draw_area_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(vectorio_module_globals, vectorio_module_globals_table);
@@ -0,0 +1,168 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/audiocore/StreamingSample.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-module/audiocore/StreamingSample.h"
+
+// write() runs from Python and get_buffer() may run in an interrupt. Each
+// side publishes its position only after it has finished with the bytes the
+// position covers, so no lock is needed.
+#define LOAD_POS(pos) __atomic_load_n(&(pos), __ATOMIC_ACQUIRE)
+#define STORE_POS(pos, value) __atomic_store_n(&(pos), (value), __ATOMIC_RELEASE)
+
+static uint32_t ring_filled(audioio_streamingsample_obj_t *self, uint32_t write_pos, uint32_t read_pos) {
+    return write_pos >= read_pos ? write_pos - read_pos : 2 * self->ring.size - read_pos + write_pos;
+}
+
+static uint32_t ring_index(audioio_streamingsample_obj_t *self, uint32_t pos) {
+    return pos >= self->ring.size ? pos - self->ring.size : pos;
+}
+
+static uint32_t ring_advance(audioio_streamingsample_obj_t *self, uint32_t pos, uint32_t n) {
+    pos += n;
+    return pos >= 2 * self->ring.size ? pos - 2 * self->ring.size : pos;
+}
+
+void common_hal_audioio_streamingsample_construct(audioio_streamingsample_obj_t *self,
+    uint32_t buffer_size,
+    uint8_t bits_per_sample,
+    bool samples_signed,
+    uint8_t channel_count,
+    uint32_t sample_rate) {
+    uint32_t bytes_per_frame = channel_count * (bits_per_sample / 8);
+    buffer_size -= buffer_size % bytes_per_frame;
+    if (!ringbuf_alloc(&self->ring, buffer_size)) {
+        m_malloc_fail(buffer_size);
+    }
+
+    // Hand out at most a quarter of the ring at a time, so that Python can
+    // keep writing while a block plays.
+    uint32_t block = buffer_size / 4;
+    block = MAX(bytes_per_frame, block - block % bytes_per_frame);
+    self->silence = m_malloc_without_collect(block);
+    if (bits_per_sample == 16 && !samples_signed) {
+        uint16_t *silence = (uint16_t *)(void *)self->silence;
+        for (uint32_t i = 0; i < block / 2; i++) {
+            silence[i] = 0x8000;
+        }
+    } else {
+        memset(self->silence, samples_signed ? 0 : 0x80, block);
+    }
+
+    self->base.bits_per_sample = bits_per_sample;
+    self->base.samples_signed = samples_signed;
+    self->base.max_buffer_length = block;
+    self->base.channel_count = channel_count;
+    self->base.sample_rate = sample_rate;
+    self->base.single_buffer = false;
+
+    self->write_pos = 0;
+    self->read_pos = 0;
+    self->held = 0;
+    self->current = self->silence;
+    self->current_length = block;
+    self->underruns = 0;
+    self->started = false;
+}
+
+void common_hal_audioio_streamingsample_deinit(audioio_streamingsample_obj_t *self) {
+    ringbuf_deinit(&self->ring);
+    self->silence = NULL;
+    self->current = NULL;
+    audiosample_mark_deinit(&self->base);
+}
+
+size_t common_hal_audioio_streamingsample_write(audioio_streamingsample_obj_t *self, const uint8_t *data, size_t len) {
+    uint32_t size = self->ring.size;
+    uint32_t bytes_per_frame = self->base.channel_count * (self->base.bits_per_sample / 8);
+    uint32_t write_pos = self->write_pos;
+    uint32_t space = size - ring_filled(self, write_pos, LOAD_POS(self->read_pos));
+
+    len = MIN(len, space);
+    len -= len % bytes_per_frame;
+
+    uint32_t index = ring_index(self, write_pos);
+    uint32_t first = MIN(len, size - index);
+    memcpy(self->ring.buf + index, data, first);
+    memcpy(self->ring.buf, data + first, len - first);
+
+    STORE_POS(self->write_pos, ring_advance(self, write_pos, len));
+    return len;
+}
+
+uint32_t common_hal_audioio_streamingsample_get_fill_level(audioio_streamingsample_obj_t *self) {
+    return ring_filled(self, LOAD_POS(self->write_pos), LOAD_POS(self->read_pos));
+}
+
+uint32_t common_hal_audioio_streamingsample_get_underruns(audioio_streamingsample_obj_t *self) {
+    return self->underruns;
+}
+
+// Give the block being played back to the writer
+static void streamingsample_release(audioio_streamingsample_obj_t *self) {
+    if (self->held) {
+        STORE_POS(self->read_pos, ring_advance(self, self->read_pos, self->held));
+        self->held = 0;
+    }
+}
+
+void audioio_streamingsample_reset_buffer(audioio_streamingsample_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+    // Data that was written but not played yet is kept, so a sample can be
+    // filled before it is played.
+    streamingsample_release(self);
+    self->current = self->silence;
+    self->current_length = self->base.max_buffer_length;
+    self->started = false;
+}
+
+audioio_get_buffer_result_t audioio_streamingsample_get_buffer(audioio_streamingsample_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    uint32_t offset = 0;
+    if (single_channel_output) {
+        offset = (channel % self->base.channel_count) * (self->base.bits_per_sample / 8);
+    }
+    // The second channel plays the same block as the first
+    if (!single_channel_output || channel == 0) {
+        streamingsample_release(self);
+
+        uint32_t read_pos = self->read_pos;
+        uint32_t filled = ring_filled(self, LOAD_POS(self->write_pos), read_pos);
+        if (filled == 0) {
+            if (self->started) {
+                self->underruns++;
+                self->started = false;
+            }
+            self->current = self->silence;
+            self->current_length = self->base.max_buffer_length;
+        } else {
+            // Play straight from the ring, up to its end
+            uint32_t index = ring_index(self, read_pos);
+            uint32_t n = MIN(MIN(filled, self->ring.size - index), self->base.max_buffer_length);
+            self->current = self->ring.buf + index;
+            self->current_length = n;
+            self->held = n;
+            self->started = true;
+        }
+    }
+
+    *buffer = self->current + offset;
+    *buffer_length = self->current_length;
+    return GET_BUFFER_MORE_DATA;
+}
@@ -0,0 +1,39 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "py/ringbuf.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+typedef struct {
+    audiosample_base_t base;
+    // Only the storage of the ringbuf is used. Its `used` count would be
+    // written by both sides, so the two sides each own one position instead.
+    // Positions run from 0 to 2 * size so that a full ring can be told apart
+    // from an empty one.
+    ringbuf_t ring;
+    uint32_t write_pos; // Only changed by write()
+    uint32_t read_pos; // Only changed by get_buffer()
+    uint32_t held; // Bytes returned by the last get_buffer, released by the next one
+    uint8_t *current;
+    uint32_t current_length;
+    uint8_t *silence;
+    uint32_t underruns;
+    bool started;
+} audioio_streamingsample_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audioio_streamingsample_reset_buffer(audioio_streamingsample_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audioio_streamingsample_get_buffer(audioio_streamingsample_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                      // length in bytes
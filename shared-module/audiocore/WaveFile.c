@@ -15,6 +15,12 @@
 #include "shared-module/audiocore/WaveFile.h"
 #include "shared-bindings/audiocore/__init__.h"
 
+#if defined(MICROPY_UNIX_COVERAGE)
+#define background_callback_prevent() ((void)0)
+#define background_callback_allow() ((void)0)
+#define background_callback_add(buf, fn, arg) ((fn)((arg)))
+#endif
+
 struct wave_format_chunk {
     uint16_t audio_format;
     uint16_t num_channels;
@@ -32,7 +38,8 @@ struct wave_format_chunk {
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     pyb_file_obj_t *file,
     uint8_t *buffer,
-    size_t buffer_size) {
+    size_t buffer_size,
+    uint8_t buffer_count) {
     // Load the wave
     self->file = file;
     uint8_t chunk_header[16];
@@ -111,47 +118,125 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     self->file_length = chunk_length;
     self->data_start = self->file->fp.fptr;
 
-    // Try to allocate two buffers, one will be loaded from file and the other
-    // DMAed to DAC.
+    // The data is read ahead into a ring of buffers: one is being played
+    // while the others are loaded by a background callback.
+    self->buffer_count = buffer_count;
     if (buffer_size) {
-        self->len = buffer_size / 2;
+        // Keep every buffer word aligned
+        self->len = (buffer_size / buffer_count) & ~3;
         self->buffer = buffer;
-        self->second_buffer = buffer + self->len;
     } else {
         self->len = 256;
-        self->buffer = m_malloc_without_collect(self->len);
+        self->buffer = m_malloc_without_collect(self->len * buffer_count);
         if (self->buffer == NULL) {
             common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
-        }
-
-        self->second_buffer = m_malloc_without_collect(self->len);
-        if (self->second_buffer == NULL) {
-            common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
+            m_malloc_fail(self->len * buffer_count);
         }
     }
+    self->read_offset = 0;
+    self->last_slots = 0;
+    self->loaded_count = 0;
+    self->played_count = 0;
+    self->current_slot = 0;
+    self->previous_slot = 0;
+    self->filling = false;
+    self->single_channel_output = false;
+    self->started = false;
+    self->data_done = false;
+    self->underruns = 0;
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self) {
     self->buffer = NULL;
-    self->second_buffer = NULL;
     audiosample_mark_deinit(&self->base);
 }
 
+uint32_t common_hal_audioio_wavefile_get_underruns(audioio_wavefile_obj_t *self) {
+    return self->underruns;
+}
+
+// Load the next part of the data into a slot. After the end of the data,
+// loading continues from its start so that looping does not wait for the file.
+static bool load_slot(audioio_wavefile_obj_t *self, uint8_t slot) {
+    uint8_t *buffer = self->buffer + slot * self->len;
+    uint32_t num_bytes_to_load = self->len;
+    if (num_bytes_to_load > self->file_length - self->read_offset) {
+        num_bytes_to_load = self->file_length - self->read_offset;
+    }
+    UINT length_read;
+    if (self->read_offset == 0 && f_lseek(&self->file->fp, self->data_start) != FR_OK) {
+        return false;
+    }
+    if (f_read(&self->file->fp, buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+        return false;
+    }
+    self->read_offset += length_read;
+    if (self->read_offset < self->file_length) {
+        self->last_slots &= ~(1u << slot);
+    } else {
+        self->read_offset = 0;
+        self->last_slots |= 1u << slot;
+        // Pad the last buffer to word align it.
+        if (length_read % sizeof(uint32_t) != 0) {
+            uint32_t pad = length_read % sizeof(uint32_t);
+            length_read += pad;
+            if (self->base.bits_per_sample == 8) {
+                for (uint32_t i = 0; i < pad; i++) {
+                    buffer[length_read / sizeof(uint8_t) - i - 1] = 0x80;
+                }
+            } else if (self->base.bits_per_sample == 16) {
+                // We know the buffer is aligned because every slot is word aligned.
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wcast-align"
+                ((int16_t *)buffer)[length_read / sizeof(int16_t) - 1] = 0;
+                #pragma GCC diagnostic pop
+            }
+        }
+    }
+    self->slot_length[slot] = length_read;
+    return true;
+}
+
+// The number of slots that may be loaded ahead of the ones in use
+static uint32_t slots_to_load(audioio_wavefile_obj_t *self) {
+    return self->buffer_count - (self->single_channel_output ? 2 : 1);
+}
+
+static void wavefile_fill_cb(void *self_in) {
+    audioio_wavefile_obj_t *self = self_in;
+    if (audiosample_deinited(&self->base)) {
+        return;
+    }
+    self->filling = true;
+    while (self->loaded_count - self->played_count < slots_to_load(self)) {
+        if (!load_slot(self, self->loaded_count % self->buffer_count)) {
+            break;
+        }
+        self->loaded_count += 1;
+    }
+    self->filling = false;
+}
+
 void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     bool single_channel_output,
     uint8_t channel) {
     if (single_channel_output && channel == 1) {
         return;
     }
-    // We don't reset the buffer index in case we're looping and we have an odd number of buffer
-    // loads
-    self->bytes_remaining = self->file_length;
-    f_lseek(&self->file->fp, self->data_start);
+    background_callback_prevent();
+    // When the end of the data has been returned, the slots loaded since
+    // then hold its start, so a loop continues without reading the file.
+    if (!self->data_done) {
+        self->loaded_count = self->played_count;
+        self->read_offset = 0;
+        self->started = false;
+    }
+    self->data_done = false;
     self->read_count = 0;
     self->left_read_count = 0;
     self->right_read_count = 0;
+    background_callback_allow();
+    background_callback_add(&self->fill_cb, wavefile_fill_cb, self);
 }
 
 audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *self,
@@ -162,6 +247,7 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
     if (!single_channel_output) {
         channel = 0;
     }
+    self->single_channel_output = single_channel_output;
 
     uint32_t channel_read_count = self->left_read_count;
     if (channel == 1) {
@@ -170,61 +256,51 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
 
     bool need_more_data = self->read_count == channel_read_count;
 
-    if (self->bytes_remaining == 0 && need_more_data) {
+    if (self->data_done && need_more_data) {
         *buffer = NULL;
         *buffer_length = 0;
         return GET_BUFFER_DONE;
     }
 
     if (need_more_data) {
-        uint32_t num_bytes_to_load = self->len;
-        if (num_bytes_to_load > self->bytes_remaining) {
-            num_bytes_to_load = self->bytes_remaining;
-        }
-        UINT length_read;
-        if (self->buffer_index % 2 == 1) {
-            *buffer = self->second_buffer;
+        uint8_t slot;
+        if (self->loaded_count != self->played_count) {
+            slot = self->played_count % self->buffer_count;
+            self->played_count += 1;
+        } else if (self->filling) {
+            // The background fill was interrupted while it reads the next
+            // slot, so play silence from the slot that just finished.
+            slot = self->current_slot;
+            memset(self->buffer + slot * self->len, self->base.samples_signed ? 0 : 0x80, self->len);
+            self->slot_length[slot] = self->len;
+            self->last_slots &= ~(1u << slot);
+            self->underruns += 1;
         } else {
-            *buffer = self->buffer;
-        }
-        if (f_read(&self->file->fp, *buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
-            return GET_BUFFER_ERROR;
-        }
-        self->bytes_remaining -= length_read;
-        // Pad the last buffer to word align it.
-        if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
-            uint32_t pad = length_read % sizeof(uint32_t);
-            length_read += pad;
-            if (self->base.bits_per_sample == 8) {
-                for (uint32_t i = 0; i < pad; i++) {
-                    ((uint8_t *)(*buffer))[length_read / sizeof(uint8_t) - i - 1] = 0x80;
-                }
-            } else if (self->base.bits_per_sample == 16) {
-                // We know the buffer is aligned because we allocated it onto the heap ourselves.
-                #pragma GCC diagnostic push
-                #pragma GCC diagnostic ignored "-Wcast-align"
-                ((int16_t *)(*buffer))[length_read / sizeof(int16_t) - 1] = 0;
-                #pragma GCC diagnostic pop
+            // Nothing was loaded ahead, so read the file now
+            slot = self->loaded_count % self->buffer_count;
+            if (!load_slot(self, slot)) {
+                return GET_BUFFER_ERROR;
+            }
+            self->loaded_count += 1;
+            self->played_count += 1;
+            if (self->started) {
+                self->underruns += 1;
             }
         }
-        *buffer_length = length_read;
-        if (self->buffer_index % 2 == 1) {
-            self->second_buffer_length = length_read;
-        } else {
-            self->buffer_length = length_read;
+        if (self->last_slots & (1u << slot)) {
+            self->data_done = true;
         }
-        self->buffer_index += 1;
+        self->previous_slot = self->current_slot;
+        self->current_slot = slot;
+        self->started = true;
         self->read_count += 1;
+        background_callback_add(&self->fill_cb, wavefile_fill_cb, self);
     }
 
     uint32_t buffers_back = self->read_count - 1 - channel_read_count;
-    if ((self->buffer_index - buffers_back) % 2 == 0) {
-        *buffer = self->second_buffer;
-        *buffer_length = self->second_buffer_length;
-    } else {
-        *buffer = self->buffer;
-        *buffer_length = self->buffer_length;
-    }
+    uint8_t slot = buffers_back == 0 ? self->current_slot : self->previous_slot;
+    *buffer = self->buffer + slot * self->len;
+    *buffer_length = self->slot_length[slot];
 
     if (channel == 0) {
         self->left_read_count += 1;
@@ -233,5 +309,5 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
         *buffer = *buffer + self->base.bits_per_sample / 8;
     }
 
-    return self->bytes_remaining == 0 ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+    return self->data_done ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
 }
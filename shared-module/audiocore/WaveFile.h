@@ -10,20 +10,37 @@
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
+#include "supervisor/background_callback.h"
+
+// The most slots that the read-ahead ring can have
+#define AUDIOCORE_WAVEFILE_MAX_BUFFERS (32)
 
 typedef struct {
     audiosample_base_t base;
-    uint8_t *buffer;
-    uint32_t buffer_length;
-    uint8_t *second_buffer;
-    uint32_t second_buffer_length;
+    uint8_t *buffer; // buffer_count slots of len bytes each
+    uint16_t slot_length[AUDIOCORE_WAVEFILE_MAX_BUFFERS];
+    uint32_t last_slots; // bit set for each slot that ends the data
     uint32_t file_length; // In bytes
     uint16_t data_start; // Where the data values start
-    uint16_t buffer_index;
-    uint32_t bytes_remaining;
+    uint32_t read_offset; // Data bytes loaded into slots, wrapping to 0 at the end
 
-    uint32_t len;
+    uint32_t len; // Bytes per slot
     pyb_file_obj_t *file;
+    background_callback_t fill_cb;
+
+    // Slots are loaded by the background fill and returned by get_buffer,
+    // which may interrupt it. Each counter has only one writer, so the slots
+    // loaded ahead are loaded_count - played_count.
+    uint32_t loaded_count;
+    uint32_t played_count;
+    uint8_t buffer_count;
+    uint8_t current_slot; // The slot get_buffer returned last
+    uint8_t previous_slot; // The slot before that, for a lagging channel
+    bool filling; // The background fill is reading the file
+    bool single_channel_output; // Each slot is returned once per channel
+    bool started; // A slot has been returned since playback was reset
+    bool data_done; // The slot that ends the data has been returned
+    uint32_t underruns;
 
     uint32_t read_count;
     uint32_t left_read_count;
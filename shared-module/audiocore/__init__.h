@@ -34,10 +34,17 @@ typedef audioio_get_buffer_result_t (*audiosample_get_buffer_fun)(mp_obj_t,
     bool single_channel_output, uint8_t channel, uint8_t **buffer,
     uint32_t *buffer_length);
 
+// Optional: produce up to `frames` frames of 16-bit scale samples into one
+// int32 array per channel (see shared-module/audiocore/effect.h). Returns
+// the number of frames produced.
+typedef uint32_t (*audiosample_get_block_fun)(mp_obj_t,
+    int32_t **channels, uint32_t frames);
+
 typedef struct _audiosample_p_t {
     MP_PROTOCOL_HEAD // MP_QSTR_protocol_audiosample
     audiosample_reset_buffer_fun reset_buffer;
     audiosample_get_buffer_fun get_buffer;
+    audiosample_get_block_fun get_block;
 } audiosample_p_t;
 
 static inline uint32_t audiosample_get_bits_per_sample(audiosample_base_t *self) {
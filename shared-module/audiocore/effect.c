@@ -0,0 +1,227 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/mpstate.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiocore/__init__.h"
+#include "shared-module/audiocore/effect.h"
+
+// Used when every shared block is already in use, which can only happen when
+// two outputs request audio at the same time.
+#define FALLBACK_BLOCK_FRAMES (32)
+
+#define POOL (MP_STATE_VM(audiocore_effect_blocks))
+
+static uint8_t pool_busy;
+
+void audiocore_effect_pool_reserve(size_t count) {
+    MP_STATIC_ASSERT(MP_ARRAY_SIZE(POOL) == AUDIOCORE_EFFECT_POOL_SIZE);
+    for (size_t i = 0; i < AUDIOCORE_EFFECT_POOL_SIZE && i < count; i++) {
+        if (POOL[i] == NULL) {
+            POOL[i] = m_malloc_without_collect(2 * AUDIOCORE_EFFECT_BLOCK_FRAMES * sizeof(int32_t));
+        }
+    }
+}
+
+void audiocore_effect_reset(void) {
+    for (size_t i = 0; i < AUDIOCORE_EFFECT_POOL_SIZE; i++) {
+        POOL[i] = NULL;
+    }
+    pool_busy = 0;
+}
+
+static int pool_acquire(void) {
+    for (int i = 0; i < AUDIOCORE_EFFECT_POOL_SIZE; i++) {
+        if (POOL[i] != NULL && !(pool_busy & (1 << i))) {
+            pool_busy |= 1 << i;
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void pool_release(int i) {
+    pool_busy &= ~(1 << i);
+}
+
+void audiocore_effect_input_init(audiocore_effect_input_t *input) {
+    input->sample = NULL; // The current playing sample
+    input->remaining_buffer = NULL; // Pointer to the start of the sample buffer we have not played
+    input->remaining_length = 0; // How many samples do we have left to play (these may be 16 bit!)
+    input->loop = false; // When the sample is done do we loop to the start again or stop (e.g. in a wav file)
+    input->more_data = false; // Is there still more data to read from the sample or did we finish
+}
+
+static const audiosample_p_t *input_proto(mp_obj_t sample) {
+    return mp_proto_get(MP_QSTR_protocol_audiosample, sample);
+}
+
+void audiocore_effect_input_play(audiocore_effect_input_t *input, audiosample_base_t *base, mp_obj_t sample, bool loop) {
+    audiosample_must_match(base, sample, false);
+
+    input->sample = sample;
+    input->loop = loop;
+    input->remaining_length = 0;
+
+    audiosample_reset_buffer(sample, false, 0);
+    if (input_proto(sample)->get_block != NULL) {
+        // Another effect: its blocks are pulled directly, not through a buffer
+        input->more_data = true;
+        return;
+    }
+
+    audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, &input->remaining_buffer, &input->remaining_length);
+
+    // Track remaining sample length in terms of bytes per sample
+    input->remaining_length /= (base->bits_per_sample / 8);
+    // Store if we have more data in the sample to retrieve
+    input->more_data = result == GET_BUFFER_MORE_DATA;
+}
+
+void audiocore_effect_input_stop(audiocore_effect_input_t *input) {
+    input->sample = NULL;
+}
+
+// Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
+static void input_refill(audiocore_effect_input_t *input, audiosample_base_t *base) {
+    if (!input->more_data) { // The sample has indicated it has no more data to play
+        if (input->loop && input->sample) { // If we are supposed to loop reset the sample to the start
+            audiosample_reset_buffer(input->sample, false, 0);
+        } else { // If we were not supposed to loop the sample, stop playing it
+            input->sample = NULL;
+        }
+    }
+    if (input->sample) {
+        // Load another sample buffer to play
+        audioio_get_buffer_result_t result = audiosample_get_buffer(input->sample, false, 0, &input->remaining_buffer, &input->remaining_length);
+        if (result == GET_BUFFER_ERROR) {
+            input->sample = NULL;
+            input->remaining_length = 0;
+            input->more_data = false;
+        } else {
+            // Track length in terms of words.
+            input->remaining_length /= (base->bits_per_sample / 8);
+            input->more_data = result == GET_BUFFER_MORE_DATA;
+        }
+    }
+}
+
+static void convert_to_block(audiosample_base_t *base, int32_t **channels, const uint8_t *buffer, uint32_t frames) {
+    uint8_t channel_count = base->channel_count;
+    for (uint8_t c = 0; c < channel_count; c++) {
+        int32_t *out = channels[c];
+        if (base->bits_per_sample == 16) {
+            const int16_t *in = (const int16_t *)(const void *)buffer + c;
+            if (base->samples_signed) {
+                for (uint32_t i = 0; i < frames; i++, in += channel_count) {
+                    out[i] = *in;
+                }
+            } else {
+                for (uint32_t i = 0; i < frames; i++, in += channel_count) {
+                    out[i] = (int16_t)(*in ^ 0x8000);
+                }
+            }
+        } else {
+            const int8_t *in = (const int8_t *)buffer + c;
+            if (base->samples_signed) {
+                for (uint32_t i = 0; i < frames; i++, in += channel_count) {
+                    out[i] = *in * 256;
+                }
+            } else {
+                for (uint32_t i = 0; i < frames; i++, in += channel_count) {
+                    out[i] = (int8_t)(*in ^ 0x80) * 256;
+                }
+            }
+        }
+    }
+}
+
+uint32_t audiocore_effect_input_read(audiocore_effect_input_t *input, audiosample_base_t *base, int32_t **channels, uint32_t frames) {
+    if (input->sample == NULL) {
+        return 0;
+    }
+    if (audiosample_deinited(audiosample_cast_obj(input->sample))) {
+        input->sample = NULL;
+        return 0;
+    }
+
+    const audiosample_p_t *proto = input_proto(input->sample);
+    if (proto->get_block != NULL) {
+        return proto->get_block(input->sample, channels, frames);
+    }
+
+    uint8_t channel_count = base->channel_count;
+    if (input->remaining_length < channel_count) {
+        input_refill(input, base);
+        if (input->sample == NULL || input->remaining_length < channel_count) {
+            // Skip any partial frame so the next read asks for new data
+            input->remaining_length = 0;
+            return 0;
+        }
+    }
+
+    uint32_t n = MIN(frames, input->remaining_length / channel_count);
+    convert_to_block(base, channels, input->remaining_buffer, n);
+
+    uint32_t n_samples = n * channel_count;
+    input->remaining_buffer += n_samples * (base->bits_per_sample / 8);
+    input->remaining_length -= n_samples;
+    return n;
+}
+
+static void convert_from_block(audiosample_base_t *base, int8_t *buffer, int32_t **channels, uint32_t frames) {
+    uint8_t channel_count = base->channel_count;
+    for (uint8_t c = 0; c < channel_count; c++) {
+        const int32_t *in = channels[c];
+        if (base->bits_per_sample == 16) {
+            uint16_t flip = base->samples_signed ? 0 : 0x8000;
+            int16_t *out = (int16_t *)(void *)buffer + c;
+            for (uint32_t i = 0; i < frames; i++, out += channel_count) {
+                *out = (int16_t)MIN(MAX(in[i], -32768), 32767) ^ flip;
+            }
+        } else {
+            uint8_t flip = base->samples_signed ? 0 : 0x80;
+            int8_t *out = buffer + c;
+            for (uint32_t i = 0; i < frames; i++, out += channel_count) {
+                *out = (int8_t)MIN(MAX(in[i] >> 8, -128), 127) ^ flip;
+            }
+        }
+    }
+}
+
+void audiocore_effect_fill_buffer(mp_obj_t self_in, audiosample_base_t *base, audiosample_get_block_fun get_block, int8_t *buffer, uint32_t buffer_len) {
+    uint32_t bytes_per_frame = base->channel_count * (base->bits_per_sample / 8);
+    uint32_t frames_left = buffer_len / bytes_per_frame;
+
+    int32_t fallback[2][FALLBACK_BLOCK_FRAMES];
+    int32_t *channels[2];
+    uint32_t block_frames;
+    int pool_index = pool_acquire();
+    if (pool_index != -1) {
+        channels[0] = POOL[pool_index];
+        channels[1] = POOL[pool_index] + AUDIOCORE_EFFECT_BLOCK_FRAMES;
+        block_frames = AUDIOCORE_EFFECT_BLOCK_FRAMES;
+    } else {
+        channels[0] = fallback[0];
+        channels[1] = fallback[1];
+        block_frames = FALLBACK_BLOCK_FRAMES;
+    }
+
+    while (frames_left != 0) {
+        uint32_t n = get_block(self_in, channels, MIN(frames_left, block_frames));
+        convert_from_block(base, buffer, channels, n);
+        buffer += n * bytes_per_frame;
+        frames_left -= n;
+    }
+
+    if (pool_index != -1) {
+        pool_release(pool_index);
+    }
+}
+
+MP_REGISTER_ROOT_POINTER(int32_t *audiocore_effect_blocks[2]);
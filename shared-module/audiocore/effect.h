@@ -0,0 +1,47 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/audiocore/__init__.h"
+
+// Audio effects share one processing path. The effect that is being played
+// converts its input into int32 blocks at 16-bit scale with one array per
+// channel. Every effect between it and the original sample then processes
+// the same block in place, pulling it through each effect's get_block. The
+// block is converted back to the output format only once, by the effect
+// whose get_buffer was called.
+
+// The largest number of frames processed at once
+#define AUDIOCORE_EFFECT_BLOCK_FRAMES (256)
+// The number of shared blocks; must match the root pointer in effect.c
+#define AUDIOCORE_EFFECT_POOL_SIZE (2)
+
+typedef struct {
+    mp_obj_t sample;
+    uint8_t *remaining_buffer;
+    uint32_t remaining_length; // in samples, not bytes or frames
+    bool loop;
+    bool more_data;
+} audiocore_effect_input_t;
+
+// Make sure at least `count` shared blocks exist. Call when an effect is
+// constructed, so that no allocation happens while audio is playing.
+void audiocore_effect_pool_reserve(size_t count);
+// Forget the shared blocks, which were in the heap of the VM that is ending.
+void audiocore_effect_reset(void);
+
+void audiocore_effect_input_init(audiocore_effect_input_t *input);
+void audiocore_effect_input_play(audiocore_effect_input_t *input, audiosample_base_t *base, mp_obj_t sample, bool loop);
+void audiocore_effect_input_stop(audiocore_effect_input_t *input);
+
+// Read up to `frames` frames of the input into `channels`. Returns 0 when
+// there is no input (nothing is playing or the sample ended).
+uint32_t audiocore_effect_input_read(audiocore_effect_input_t *input, audiosample_base_t *base, int32_t **channels, uint32_t frames);
+
+// Fill `buffer` by repeatedly calling get_block and converting the result
+// to the format described by `base`.
+void audiocore_effect_fill_buffer(mp_obj_t self_in, audiosample_base_t *base, audiosample_get_block_fun get_block, int8_t *buffer, uint32_t buffer_len);
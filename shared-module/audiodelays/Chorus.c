@@ -48,11 +48,8 @@ void common_hal_audiodelays_chorus_construct(audiodelays_chorus_obj_t *self, uin
     self->last_buf_idx = 1; // Which buffer to use first, toggle between 0 and 1
 
     // Initialize other values most effects will need.
-    self->sample = NULL; // The current playing sample
-    self->sample_remaining_buffer = NULL; // Pointer to the start of the sample buffer we have not played
-    self->sample_buffer_length = 0; // How many samples do we have left to play (these may be 16 bit!)
-    self->loop = false; // When the sample is done do we loop to the start again or stop (e.g. in a wav file)
-    self->more_data = false; // Is there still more data to read from the sample or did we finish
+    audiocore_effect_input_init(&self->input);
+    audiocore_effect_pool_reserve(1);
 
     // The below section sets up the chorus effect's starting values. For a different effect this section will change
 
@@ -161,182 +158,100 @@ void common_hal_audiodelays_chorus_set_mix(audiodelays_chorus_obj_t *self, mp_ob
 }
 
 bool common_hal_audiodelays_chorus_get_playing(audiodelays_chorus_obj_t *self) {
-    return self->sample != NULL;
+    return self->input.sample != NULL;
 }
 
 void common_hal_audiodelays_chorus_play(audiodelays_chorus_obj_t *self, mp_obj_t sample, bool loop) {
-    audiosample_must_match(&self->base, sample, false);
-
-    self->sample = sample;
-    self->loop = loop;
-
-    audiosample_reset_buffer(self->sample, false, 0);
-    audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-
-    // Track remaining sample length in terms of bytes per sample
-    self->sample_buffer_length /= (self->base.bits_per_sample / 8);
-    // Store if we have more data in the sample to retrieve
-    self->more_data = result == GET_BUFFER_MORE_DATA;
-
-    return;
+    audiocore_effect_input_play(&self->input, &self->base, sample, loop);
 }
 
 void common_hal_audiodelays_chorus_stop(audiodelays_chorus_obj_t *self) {
     // When the sample is set to stop playing do any cleanup here
     // For chorus we clear the sample but the chorus continues until the object reading our effect stops
-    self->sample = NULL;
-    return;
+    audiocore_effect_input_stop(&self->input);
 }
 
-audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj_t *self, bool single_channel_output, uint8_t channel,
-    uint8_t **buffer, uint32_t *buffer_length) {
+uint32_t audiodelays_chorus_get_block(audiodelays_chorus_obj_t *self, int32_t **channels, uint32_t frames) {
+    uint8_t channel_count = self->base.channel_count;
 
-    // Switch our buffers to the other buffer
-    self->last_buf_idx = !self->last_buf_idx;
+    frames = MIN(frames, SYNTHIO_MAX_DUR);
+    uint32_t n = audiocore_effect_input_read(&self->input, &self->base, channels, frames);
 
-    // If we are using 16 bit samples we need a 16 bit pointer, 8 bit needs an 8 bit pointer
-    int16_t *word_buffer = (int16_t *)self->buffer[self->last_buf_idx];
-    int8_t *hword_buffer = self->buffer[self->last_buf_idx];
-    uint32_t length = self->buffer_len / (self->base.bits_per_sample / 8);
+    // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+    shared_bindings_synthio_lfo_tick(self->base.sample_rate, n ? n : frames);
 
-    // The chorus buffer is always stored as a 16-bit value internally
-    int16_t *chorus_buffer = (int16_t *)self->chorus_buffer;
-    uint32_t chorus_buf_len = self->chorus_buffer_len / sizeof(uint16_t);
-    uint32_t max_chorus_buf_len = self->max_chorus_buffer_len / sizeof(uint16_t);
+    int32_t voices = (int32_t)MAX(synthio_block_slot_get(&self->voices), 1.0);
+    int32_t mix_down_scale = SYNTHIO_MIX_DOWN_SCALE(voices);
+    mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
 
-    // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
-    while (length != 0) {
-        // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
-        if (self->sample_buffer_length == 0) {
-            if (!self->more_data) { // The sample has indicated it has no more data to play
-                if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
-                    audiosample_reset_buffer(self->sample, false, 0);
-                } else { // If we were not supposed to loop the sample, stop playing it but we still need to play the chorus
-                    self->sample = NULL;
-                }
-            }
-            if (self->sample) {
-                // Load another sample buffer to play
-                audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-                if (result == GET_BUFFER_ERROR) {
-                    self->sample = NULL;
-                    self->sample_buffer_length = 0;
-                    self->more_data = false;
-                } else {
-                    // Track length in terms of words.
-                    self->sample_buffer_length /= (self->base.bits_per_sample / 8);
-                    self->more_data = result == GET_BUFFER_MORE_DATA;
-                }
-            }
-        }
+    mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
+    if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
+        chorus_recalculate_delay(self, f_delay_ms);
+    }
 
-        // Determine how many bytes we can process to our buffer, the less of the sample we have left and our buffer remaining
-        uint32_t n;
-        if (self->sample == NULL) {
-            n = MIN(length, SYNTHIO_MAX_DUR * self->base.channel_count);
-        } else {
-            n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
+    if (n == 0) {
+        for (uint8_t c = 0; c < channel_count; c++) {
+            memset(channels[c], 0, frames * sizeof(int32_t));
         }
+        return frames;
+    }
 
-        // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
-        shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
+    // The chorus buffer is always stored as a 16-bit value internally
+    int16_t *chorus_buffer = (int16_t *)self->chorus_buffer;
+    uint32_t chorus_buf_len = self->chorus_buffer_len / sizeof(uint16_t);
+    uint32_t max_chorus_buf_len = self->max_chorus_buffer_len / sizeof(uint16_t);
 
-        int32_t voices = (int32_t)MAX(synthio_block_slot_get(&self->voices), 1.0);
-        int32_t mix_down_scale = SYNTHIO_MIX_DOWN_SCALE(voices);
-        mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+    for (uint32_t i = 0; i < n; i++) {
+        for (uint8_t c = 0; c < channel_count; c++) {
+            int32_t sample_word = channels[c][i];
 
-        mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
-        if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
-            chorus_recalculate_delay(self, f_delay_ms);
-        }
+            chorus_buffer[self->chorus_buffer_pos++] = (int16_t)sample_word;
 
-        if (self->sample == NULL) {
-            if (self->base.samples_signed) {
-                memset(word_buffer, 0, n * (self->base.bits_per_sample / 8));
+            int32_t word = 0;
+            if (voices == 1) {
+                word = sample_word;
             } else {
-                // For unsigned samples set to the middle which is "quiet"
-                if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                    uint16_t *uword_buffer = (uint16_t *)word_buffer;
-                    for (uint32_t i = 0; i < n; i++) {
-                        *uword_buffer++ = 32768;
-                    }
-                } else {
-                    memset(hword_buffer, 128, n * (self->base.bits_per_sample / 8));
-                }
-            }
-        } else {
-            int16_t *sample_src = (int16_t *)self->sample_remaining_buffer; // for 16-bit samples
-            int8_t *sample_hsrc = (int8_t *)self->sample_remaining_buffer; // for 8-bit samples
-
-            for (uint32_t i = 0; i < n; i++) {
-                int32_t sample_word = 0;
-                if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                    sample_word = sample_src[i];
-                } else {
-                    if (self->base.samples_signed) {
-                        sample_word = sample_hsrc[i];
-                    } else {
-                        // Be careful here changing from an 8 bit unsigned to signed into a 32-bit signed
-                        sample_word = (int8_t)(((uint8_t)sample_hsrc[i]) ^ 0x80);
-                    }
-                }
-
-                chorus_buffer[self->chorus_buffer_pos++] = (int16_t)sample_word;
+                int32_t step = chorus_buf_len / (voices - 1) - 1;
+                int32_t c_pos = self->chorus_buffer_pos - 1;
 
-                int32_t word = 0;
-                if (voices == 1) {
-                    word = sample_word;
-                } else {
-                    int32_t step = chorus_buf_len / (voices - 1) - 1;
-                    int32_t c_pos = self->chorus_buffer_pos - 1;
-
-                    for (int32_t v = 0; v < voices; v++) {
-                        if (c_pos < 0) {
-                            c_pos += max_chorus_buf_len;
-                        }
-                        word += chorus_buffer[c_pos];
-
-                        c_pos -= step;
+                for (int32_t v = 0; v < voices; v++) {
+                    if (c_pos < 0) {
+                        c_pos += max_chorus_buf_len;
                     }
+                    word += chorus_buffer[c_pos];
 
-                    // Dividing would get an average but does not sound as good
-                    // Leaving this here in case someone wants to try an average instead
-                    // word = word / voices;
-
-                    word = synthio_mix_down_sample(word, mix_down_scale);
+                    c_pos -= step;
                 }
 
-                // Add original sample + effect
-                word = sample_word + (int32_t)(word * mix);
-                word = synthio_mix_down_sample(word, 2);
+                // Dividing would get an average but does not sound as good
+                // Leaving this here in case someone wants to try an average instead
+                // word = word / voices;
 
-                if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                    word_buffer[i] = word;
-                    if (!self->base.samples_signed) {
-                        word_buffer[i] ^= 0x8000;
-                    }
-                } else {
-                    int8_t out = word;
-                    if (self->base.samples_signed) {
-                        hword_buffer[i] = out;
-                    } else {
-                        hword_buffer[i] = (uint8_t)out ^ 0x80;
-                    }
-                }
+                word = synthio_mix_down_sample(word, mix_down_scale);
+            }
 
-                if (self->chorus_buffer_pos >= max_chorus_buf_len) {
-                    self->chorus_buffer_pos = 0;
-                }
+            // Add original sample + effect
+            word = sample_word + (int32_t)(word * mix);
+            channels[c][i] = (int16_t)synthio_mix_down_sample(word, 2);
+
+            if (self->chorus_buffer_pos >= max_chorus_buf_len) {
+                self->chorus_buffer_pos = 0;
             }
-            self->sample_remaining_buffer += (n * (self->base.bits_per_sample / 8));
-            self->sample_buffer_length -= n;
         }
-        // Update the remaining length and the buffer positions based on how much we wrote into our buffer
-        length -= n;
-        word_buffer += n;
-        hword_buffer += n;
     }
 
+    return n;
+}
+
+audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj_t *self, bool single_channel_output, uint8_t channel,
+    uint8_t **buffer, uint32_t *buffer_length) {
+
+    // Switch our buffers to the other buffer
+    self->last_buf_idx = !self->last_buf_idx;
+
+    audiocore_effect_fill_buffer(MP_OBJ_FROM_PTR(self), &self->base, (audiosample_get_block_fun)audiodelays_chorus_get_block,
+        self->buffer[self->last_buf_idx], self->buffer_len);
+
     // Finally pass our buffer and length to the calling audio function
     *buffer = (uint8_t *)self->buffer[self->last_buf_idx];
     *buffer_length = self->buffer_len;
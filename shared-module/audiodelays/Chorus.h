@@ -8,6 +8,7 @@
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
+#include "shared-module/audiocore/effect.h"
 #include "shared-module/synthio/block.h"
 
 extern const mp_obj_type_t audiodelays_chorus_type;
@@ -25,19 +26,13 @@ typedef struct {
     uint8_t last_buf_idx;
     uint32_t buffer_len; // max buffer in bytes
 
-    uint8_t *sample_remaining_buffer;
-    uint32_t sample_buffer_length;
-
-    bool loop;
-    bool more_data;
+    audiocore_effect_input_t input;
 
     int8_t *chorus_buffer;
     uint32_t chorus_buffer_len; // bytes
     uint32_t max_chorus_buffer_len; // bytes
 
     uint32_t chorus_buffer_pos; // words
-
-    mp_obj_t sample;
 } audiodelays_chorus_obj_t;
 
 void chorus_recalculate_delay(audiodelays_chorus_obj_t *self, mp_float_t f_delay_ms);
@@ -46,6 +41,10 @@ void audiodelays_chorus_reset_buffer(audiodelays_chorus_obj_t *self,
     bool single_channel_output,
     uint8_t channel);
 
+uint32_t audiodelays_chorus_get_block(audiodelays_chorus_obj_t *self,
+    int32_t **channels,
+    uint32_t frames);
+
 audioio_get_buffer_result_t audiodelays_chorus_get_buffer(audiodelays_chorus_obj_t *self,
     bool single_channel_output,
     uint8_t channel,
@@ -51,11 +51,8 @@ void common_hal_audiodelays_echo_construct(audiodelays_echo_obj_t *self, uint32_
     self->last_buf_idx = 1; // Which buffer to use first, toggle between 0 and 1
 
     // Initialize other values most effects will need.
-    self->sample = NULL; // The current playing sample
-    self->sample_remaining_buffer = NULL; // Pointer to the start of the sample buffer we have not played
-    self->sample_buffer_length = 0; // How many samples do we have left to play (these may be 16 bit!)
-    self->loop = false; // When the sample is done do we loop to the start again or stop (e.g. in a wav file)
-    self->more_data = false; // Is there still more data to read from the sample or did we finish
+    audiocore_effect_input_init(&self->input);
+    audiocore_effect_pool_reserve(1);
 
     // The below section sets up the echo effect's starting values. For a different effect this section will change
 
@@ -200,278 +197,158 @@ void audiodelays_echo_reset_buffer(audiodelays_echo_obj_t *self,
 }
 
 bool common_hal_audiodelays_echo_get_playing(audiodelays_echo_obj_t *self) {
-    return self->sample != NULL;
+    return self->input.sample != NULL;
 }
 
 void common_hal_audiodelays_echo_play(audiodelays_echo_obj_t *self, mp_obj_t sample, bool loop) {
-    audiosample_must_match(&self->base, sample, false);
-
-    self->sample = sample;
-    self->loop = loop;
-
-    audiosample_reset_buffer(self->sample, false, 0);
-    audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-
-    // Track remaining sample length in terms of bytes per sample
-    self->sample_buffer_length /= (self->base.bits_per_sample / 8);
-    // Store if we have more data in the sample to retrieve
-    self->more_data = result == GET_BUFFER_MORE_DATA;
-
-    return;
+    audiocore_effect_input_play(&self->input, &self->base, sample, loop);
 }
 
 void common_hal_audiodelays_echo_stop(audiodelays_echo_obj_t *self) {
     // When the sample is set to stop playing do any cleanup here
     // For echo we clear the sample but the echo continues until the object reading our effect stops
-    self->sample = NULL;
-    return;
+    audiocore_effect_input_stop(&self->input);
 }
 
-audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *self, bool single_channel_output, uint8_t channel,
-    uint8_t **buffer, uint32_t *buffer_length) {
+uint32_t audiodelays_echo_get_block(audiodelays_echo_obj_t *self, int32_t **channels, uint32_t frames) {
+    uint8_t channel_count = self->base.channel_count;
 
-    if (!single_channel_output) {
-        channel = 0;
+    // Get as much of the sample as fits, if there is no sample we still need to play the echo
+    frames = MIN(frames, SYNTHIO_MAX_DUR);
+    uint32_t n = audiocore_effect_input_read(&self->input, &self->base, channels, frames);
+    bool have_sample = n != 0;
+    if (!have_sample) {
+        n = frames;
     }
 
-    // Switch our buffers to the other buffer
-    self->last_buf_idx = !self->last_buf_idx;
+    // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+    shared_bindings_synthio_lfo_tick(self->base.sample_rate, n);
+    mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0)) * MICROPY_FLOAT_CONST(2.0);
+    mp_float_t decay = synthio_block_slot_get_limited(&self->decay, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
 
-    // If we are using 16 bit samples we need a 16 bit pointer, 8 bit needs an 8 bit pointer
-    int16_t *word_buffer = (int16_t *)self->buffer[self->last_buf_idx];
-    int8_t *hword_buffer = self->buffer[self->last_buf_idx];
-    uint32_t length = self->buffer_len / (self->base.bits_per_sample / 8);
+    mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
+    if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
+        recalculate_delay(self, f_delay_ms);
+    }
 
     // The echo buffer is always stored as a 16-bit value internally
     int16_t *echo_buffer = (int16_t *)self->echo_buffer;
-
-    // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
-    while (length != 0) {
-        // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
-        if (self->sample_buffer_length == 0) {
-            if (!self->more_data) { // The sample has indicated it has no more data to play
-                if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
-                    audiosample_reset_buffer(self->sample, false, 0);
-                } else { // If we were not supposed to loop the sample, stop playing it but we still need to play the echo
-                    self->sample = NULL;
-                }
-            }
-            if (self->sample) {
-                // Load another sample buffer to play
-                audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-                if (result == GET_BUFFER_ERROR) {
-                    self->sample = NULL;
-                    self->sample_buffer_length = 0;
-                    self->more_data = false;
-                } else {
-                    // Track length in terms of words.
-                    self->sample_buffer_length /= (self->base.bits_per_sample / 8);
-                    self->more_data = result == GET_BUFFER_MORE_DATA;
-                }
+    uint32_t echo_buf_len = self->echo_buffer_len / sizeof(uint16_t);
+    uint32_t max_echo_buf_len = (self->max_echo_buffer_len >> (channel_count - 1)) / sizeof(uint16_t);
+
+    // If we have no sample keep the echo echoing
+    if (!have_sample) {
+        if (mix <= MICROPY_FLOAT_CONST(0.01)) {  // Mix of 0 is pure sample sound. We have no sample so no sound
+            for (uint8_t c = 0; c < channel_count; c++) {
+                memset(channels[c], 0, n * sizeof(int32_t));
             }
+            return n;
         }
 
-        // Determine how many bytes we can process to our buffer, the less of the sample we have left and our buffer remaining
-        uint32_t n;
-        if (self->sample == NULL) {
-            n = MIN(length, SYNTHIO_MAX_DUR * self->base.channel_count);
-        } else {
-            n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
-        }
-
-        // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
-        shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
-        mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0)) * MICROPY_FLOAT_CONST(2.0);
-        mp_float_t decay = synthio_block_slot_get_limited(&self->decay, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+        for (uint32_t i = 0; i < n; i++) {
+            for (uint8_t c = 0; c < channel_count; c++) {
+                int16_t echo, word = 0;
+                uint32_t next_buffer_pos = 0;
 
-        mp_float_t f_delay_ms = synthio_block_slot_get(&self->delay_ms);
-        if (MICROPY_FLOAT_C_FUN(fabs)(self->current_delay_ms - f_delay_ms) >= self->sample_ms) {
-            recalculate_delay(self, f_delay_ms);
-        }
+                // Get our echo buffer position and offset depending on current channel
+                uint32_t echo_buffer_offset = max_echo_buf_len * (c == 1);
+                uint32_t echo_buffer_pos = echo_buffer_offset ? self->echo_buffer_right_pos : self->echo_buffer_left_pos;
 
-        uint32_t echo_buf_len = self->echo_buffer_len / sizeof(uint16_t);
-        uint32_t max_echo_buf_len = (self->max_echo_buffer_len >> (self->base.channel_count - 1)) / sizeof(uint16_t);
+                if (self->freq_shift) {
+                    echo = echo_buffer[(echo_buffer_pos >> 8) + echo_buffer_offset];
+                    next_buffer_pos = echo_buffer_pos + self->echo_buffer_rate;
 
-        // If we have no sample keep the echo echoing
-        if (self->sample == NULL) {
-            if (mix <= MICROPY_FLOAT_CONST(0.01)) {  // Mix of 0 is pure sample sound. We have no sample so no sound
-                if (self->base.samples_signed) {
-                    memset(word_buffer, 0, length * (self->base.bits_per_sample / 8));
-                } else {
-                    // For unsigned samples set to the middle which is "quiet"
-                    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                        uint16_t *uword_buffer = (uint16_t *)word_buffer;
-                        while (length--) {
-                            *uword_buffer++ = 32768;
-                        }
-                    } else {
-                        memset(hword_buffer, 128, length * (self->base.bits_per_sample / 8));
+                    for (uint32_t j = echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
+                        word = (int16_t)(echo_buffer[(j % echo_buf_len) + echo_buffer_offset] * decay);
+                        echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = word;
                     }
+                } else {
+                    echo = echo_buffer[echo_buffer_pos + echo_buffer_offset];
+                    word = (int16_t)(echo * decay);
+                    echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = word;
                 }
-            } else {
-                // Since we have no sample we can just iterate over the our entire remaining buffer and finish
-                for (uint32_t i = 0; i < length; i++) {
-                    int16_t echo, word = 0;
-                    uint32_t next_buffer_pos = 0;
-
-                    // Get our echo buffer position and offset depending on current channel
-                    uint32_t echo_buffer_offset = max_echo_buf_len * ((single_channel_output && channel == 1) || (!single_channel_output && (i % self->base.channel_count) == 1));
-                    uint32_t echo_buffer_pos = echo_buffer_offset ? self->echo_buffer_right_pos : self->echo_buffer_left_pos;
-
-                    if (self->freq_shift) {
-                        echo = echo_buffer[(echo_buffer_pos >> 8) + echo_buffer_offset];
-                        next_buffer_pos = echo_buffer_pos + self->echo_buffer_rate;
-
-                        for (uint32_t j = echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
-                            word = (int16_t)(echo_buffer[(j % echo_buf_len) + echo_buffer_offset] * decay);
-                            echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = word;
-                        }
-                    } else {
-                        echo = echo_buffer[echo_buffer_pos + echo_buffer_offset];
-                        word = (int16_t)(echo * decay);
-                        echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = word;
-                    }
-
-                    word = (int16_t)(echo * MIN(mix, MICROPY_FLOAT_CONST(1.0)));
-
-                    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                        word_buffer[i] = word;
-                        if (!self->base.samples_signed) {
-                            word_buffer[i] ^= 0x8000;
-                        }
-                    } else {
-                        hword_buffer[i] = (int8_t)word;
-                        if (!self->base.samples_signed) {
-                            hword_buffer[i] ^= 0x80;
-                        }
-                    }
 
-                    if (self->freq_shift) {
-                        echo_buffer_pos = next_buffer_pos % (echo_buf_len << 8);
-                    } else if (!self->freq_shift && echo_buffer_pos >= echo_buf_len) {
-                        echo_buffer_pos = 0;
-                    }
+                channels[c][i] = (int16_t)(echo * MIN(mix, MICROPY_FLOAT_CONST(1.0)));
 
-                    // Update buffer position
-                    if (echo_buffer_offset) {
-                        self->echo_buffer_right_pos = echo_buffer_pos;
-                    } else {
-                        self->echo_buffer_left_pos = echo_buffer_pos;
-                    }
+                if (self->freq_shift) {
+                    echo_buffer_pos = next_buffer_pos % (echo_buf_len << 8);
+                } else if (!self->freq_shift && echo_buffer_pos >= echo_buf_len) {
+                    echo_buffer_pos = 0;
                 }
-            }
 
-            length = 0;
-        } else {
-            // we have a sample to play and echo
-            int16_t *sample_src = (int16_t *)self->sample_remaining_buffer; // for 16-bit samples
-            int8_t *sample_hsrc = (int8_t *)self->sample_remaining_buffer; // for 8-bit samples
-
-            if (mix <= MICROPY_FLOAT_CONST(0.01)) { // if mix is zero pure sample only
-                for (uint32_t i = 0; i < n; i++) {
-                    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                        word_buffer[i] = sample_src[i];
-                    } else {
-                        hword_buffer[i] = sample_hsrc[i];
-                    }
+                // Update buffer position
+                if (echo_buffer_offset) {
+                    self->echo_buffer_right_pos = echo_buffer_pos;
+                } else {
+                    self->echo_buffer_left_pos = echo_buffer_pos;
                 }
-            } else {
-                for (uint32_t i = 0; i < n; i++) {
-                    int32_t sample_word = 0;
-                    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                        sample_word = sample_src[i];
-                    } else {
-                        if (self->base.samples_signed) {
-                            sample_word = sample_hsrc[i];
-                        } else {
-                            // Be careful here changing from an 8 bit unsigned to signed into a 32-bit signed
-                            sample_word = (int8_t)(((uint8_t)sample_hsrc[i]) ^ 0x80);
-                        }
-                    }
+            }
+        }
+        return n;
+    }
 
-                    int32_t echo, word = 0;
-                    uint32_t next_buffer_pos = 0;
+    // we have a sample to play and echo
+    if (mix <= MICROPY_FLOAT_CONST(0.01)) { // if mix is zero pure sample only
+        return n;
+    }
 
-                    // Get our echo buffer position and offset depending on current channel
-                    uint32_t echo_buffer_offset = max_echo_buf_len * ((single_channel_output && channel == 1) || (!single_channel_output && (i % self->base.channel_count) == 1));
-                    uint32_t echo_buffer_pos = echo_buffer_offset ? self->echo_buffer_right_pos : self->echo_buffer_left_pos;
+    for (uint32_t i = 0; i < n; i++) {
+        for (uint8_t c = 0; c < channel_count; c++) {
+            int32_t sample_word = channels[c][i];
+            int32_t echo, word = 0;
+            uint32_t next_buffer_pos = 0;
 
-                    if (self->freq_shift) {
-                        echo = echo_buffer[(echo_buffer_pos >> 8) + echo_buffer_offset];
-                        next_buffer_pos = echo_buffer_pos + self->echo_buffer_rate;
-                    } else {
-                        echo = echo_buffer[echo_buffer_pos + echo_buffer_offset];
-                        word = (int32_t)(echo * decay + sample_word);
-                    }
+            // Get our echo buffer position and offset depending on current channel
+            uint32_t echo_buffer_offset = max_echo_buf_len * (c == 1);
+            uint32_t echo_buffer_pos = echo_buffer_offset ? self->echo_buffer_right_pos : self->echo_buffer_left_pos;
 
-                    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                        if (self->freq_shift) {
-                            for (uint32_t j = echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
-                                word = (int32_t)(echo_buffer[(j % echo_buf_len) + echo_buffer_offset] * decay + sample_word);
-                                word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
-                                echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = (int16_t)word;
-                            }
-                        } else {
-                            word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
-                            echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = (int16_t)word;
-                        }
-                    } else {
-                        if (self->freq_shift) {
-                            for (uint32_t j = echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
-                                word = (int32_t)(echo_buffer[(j % echo_buf_len) + echo_buffer_offset] * decay + sample_word);
-                                // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
-                                word = MIN(MAX(word, -128), 127);
-                                echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = (int8_t)word;
-                            }
-                        } else {
-                            // Do not have mix_down for 8 bit so just hard cap samples into 1 byte
-                            word = MIN(MAX(word, -128), 127);
-                            echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = (int8_t)word;
-                        }
-                    }
+            if (self->freq_shift) {
+                echo = echo_buffer[(echo_buffer_pos >> 8) + echo_buffer_offset];
+                next_buffer_pos = echo_buffer_pos + self->echo_buffer_rate;
 
-                    word = (int32_t)((sample_word * MIN(MICROPY_FLOAT_CONST(2.0) - mix, MICROPY_FLOAT_CONST(1.0)))
-                        + (echo * MIN(mix, MICROPY_FLOAT_CONST(1.0))));
+                for (uint32_t j = echo_buffer_pos >> 8; j < next_buffer_pos >> 8; j++) {
+                    word = (int32_t)(echo_buffer[(j % echo_buf_len) + echo_buffer_offset] * decay + sample_word);
                     word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+                    echo_buffer[(j % echo_buf_len) + echo_buffer_offset] = (int16_t)word;
+                }
+            } else {
+                echo = echo_buffer[echo_buffer_pos + echo_buffer_offset];
+                word = (int32_t)(echo * decay + sample_word);
+                word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+                echo_buffer[echo_buffer_pos++ + echo_buffer_offset] = (int16_t)word;
+            }
 
-                    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                        word_buffer[i] = (int16_t)word;
-                        if (!self->base.samples_signed) {
-                            word_buffer[i] ^= 0x8000;
-                        }
-                    } else {
-                        int8_t mixed = (int16_t)word;
-                        if (self->base.samples_signed) {
-                            hword_buffer[i] = mixed;
-                        } else {
-                            hword_buffer[i] = (uint8_t)mixed ^ 0x80;
-                        }
-                    }
-
-                    if (self->freq_shift) {
-                        echo_buffer_pos = next_buffer_pos % (echo_buf_len << 8);
-                    } else if (!self->freq_shift && echo_buffer_pos >= echo_buf_len) {
-                        echo_buffer_pos = 0;
-                    }
+            word = (int32_t)((sample_word * MIN(MICROPY_FLOAT_CONST(2.0) - mix, MICROPY_FLOAT_CONST(1.0)))
+                + (echo * MIN(mix, MICROPY_FLOAT_CONST(1.0))));
+            channels[c][i] = (int16_t)synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
 
-                    // Update buffer position
-                    if (echo_buffer_offset) {
-                        self->echo_buffer_right_pos = echo_buffer_pos;
-                    } else {
-                        self->echo_buffer_left_pos = echo_buffer_pos;
-                    }
-                }
+            if (self->freq_shift) {
+                echo_buffer_pos = next_buffer_pos % (echo_buf_len << 8);
+            } else if (!self->freq_shift && echo_buffer_pos >= echo_buf_len) {
+                echo_buffer_pos = 0;
             }
 
-            // Update the remaining length and the buffer positions based on how much we wrote into our buffer
-            length -= n;
-            word_buffer += n;
-            hword_buffer += n;
-            self->sample_remaining_buffer += (n * (self->base.bits_per_sample / 8));
-            self->sample_buffer_length -= n;
+            // Update buffer position
+            if (echo_buffer_offset) {
+                self->echo_buffer_right_pos = echo_buffer_pos;
+            } else {
+                self->echo_buffer_left_pos = echo_buffer_pos;
+            }
         }
     }
 
+    return n;
+}
+
+audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *self, bool single_channel_output, uint8_t channel,
+    uint8_t **buffer, uint32_t *buffer_length) {
+
+    // Switch our buffers to the other buffer
+    self->last_buf_idx = !self->last_buf_idx;
+
+    audiocore_effect_fill_buffer(MP_OBJ_FROM_PTR(self), &self->base, (audiosample_get_block_fun)audiodelays_echo_get_block,
+        self->buffer[self->last_buf_idx], self->buffer_len);
+
     // Finally pass our buffer and length to the calling audio function
     *buffer = (uint8_t *)self->buffer[self->last_buf_idx];
     *buffer_length = self->buffer_len;
@@ -8,6 +8,7 @@
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
+#include "shared-module/audiocore/effect.h"
 #include "shared-module/synthio/__init__.h"
 #include "shared-module/synthio/block.h"
 
@@ -26,11 +27,8 @@ typedef struct {
     uint8_t last_buf_idx;
     uint32_t buffer_len; // max buffer in bytes
 
-    uint8_t *sample_remaining_buffer;
-    uint32_t sample_buffer_length;
+    audiocore_effect_input_t input;
 
-    bool loop;
-    bool more_data;
     bool freq_shift; // does the echo shift frequencies if delay changes
 
     int8_t *echo_buffer;
@@ -40,8 +38,6 @@ typedef struct {
     uint32_t echo_buffer_left_pos; // words (<< 8 when freq_shift=True)
     uint32_t echo_buffer_right_pos; // words (<< 8 when freq_shift=True)
     uint32_t echo_buffer_rate; // words << 8
-
-    mp_obj_t sample;
 } audiodelays_echo_obj_t;
 
 void recalculate_delay(audiodelays_echo_obj_t *self, mp_float_t f_delay_ms);
@@ -50,6 +46,10 @@ void audiodelays_echo_reset_buffer(audiodelays_echo_obj_t *self,
     bool single_channel_output,
     uint8_t channel);
 
+uint32_t audiodelays_echo_get_block(audiodelays_echo_obj_t *self,
+    int32_t **channels,
+    uint32_t frames);
+
 audioio_get_buffer_result_t audiodelays_echo_get_buffer(audiodelays_echo_obj_t *self,
     bool single_channel_output,
     uint8_t channel,
@@ -9,6 +9,7 @@
 
 #include "shared-bindings/audiofilters/Distortion.h"
 #include "shared-module/audiocore/__init__.h"
+#include "shared-module/audiocore/effect.h"
 #include "shared-module/synthio/block.h"
 
 typedef enum {
@@ -33,19 +34,17 @@ typedef struct {
     uint8_t last_buf_idx;
     uint32_t buffer_len; // max buffer in bytes
 
-    uint8_t *sample_remaining_buffer;
-    uint32_t sample_buffer_length;
-
-    bool loop;
-    bool more_data;
-
-    mp_obj_t sample;
+    audiocore_effect_input_t input;
 } audiofilters_distortion_obj_t;
 
 void audiofilters_distortion_reset_buffer(audiofilters_distortion_obj_t *self,
     bool single_channel_output,
     uint8_t channel);
 
+uint32_t audiofilters_distortion_get_block(audiofilters_distortion_obj_t *self,
+    int32_t **channels,
+    uint32_t frames);
+
 audioio_get_buffer_result_t audiofilters_distortion_get_buffer(audiofilters_distortion_obj_t *self,
     bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length);
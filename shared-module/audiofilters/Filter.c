@@ -44,11 +44,8 @@ void common_hal_audiofilters_filter_construct(audiofilters_filter_obj_t *self,
     memset(self->filter_buffer, 0, SYNTHIO_MAX_DUR * self->base.channel_count * sizeof(int32_t));
 
     // Initialize other values most effects will need.
-    self->sample = NULL; // The current playing sample
-    self->sample_remaining_buffer = NULL; // Pointer to the start of the sample buffer we have not played
-    self->sample_buffer_length = 0; // How many samples do we have left to play (these may be 16 bit!)
-    self->loop = false; // When the sample is done do we loop to the start again or stop (e.g. in a wav file)
-    self->more_data = false; // Is there still more data to read from the sample or did we finish
+    audiocore_effect_input_init(&self->input);
+    audiocore_effect_pool_reserve(1);
 
     // The below section sets up the effect's starting values.
 
@@ -139,179 +136,82 @@ void audiofilters_filter_reset_buffer(audiofilters_filter_obj_t *self,
 }
 
 bool common_hal_audiofilters_filter_get_playing(audiofilters_filter_obj_t *self) {
-    return self->sample != NULL;
+    return self->input.sample != NULL;
 }
 
 void common_hal_audiofilters_filter_play(audiofilters_filter_obj_t *self, mp_obj_t sample, bool loop) {
-    audiosample_must_match(&self->base, sample, false);
-
-    self->sample = sample;
-    self->loop = loop;
-
-    audiosample_reset_buffer(self->sample, false, 0);
-    audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-
-    // Track remaining sample length in terms of bytes per sample
-    self->sample_buffer_length /= (self->base.bits_per_sample / 8);
-    // Store if we have more data in the sample to retrieve
-    self->more_data = result == GET_BUFFER_MORE_DATA;
-
-    return;
+    audiocore_effect_input_play(&self->input, &self->base, sample, loop);
 }
 
 void common_hal_audiofilters_filter_stop(audiofilters_filter_obj_t *self) {
     // When the sample is set to stop playing do any cleanup here
-    self->sample = NULL;
-    return;
+    audiocore_effect_input_stop(&self->input);
 }
 
-audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_obj_t *self, bool single_channel_output, uint8_t channel,
-    uint8_t **buffer, uint32_t *buffer_length) {
-    (void)channel;
+uint32_t audiofilters_filter_get_block(audiofilters_filter_obj_t *self, int32_t **channels, uint32_t frames) {
+    uint8_t channel_count = self->base.channel_count;
 
-    if (!single_channel_output) {
-        channel = 0;
-    }
+    frames = MIN(frames, SYNTHIO_MAX_DUR);
+    uint32_t n = audiocore_effect_input_read(&self->input, &self->base, channels, frames);
 
-    // Switch our buffers to the other buffer
-    self->last_buf_idx = !self->last_buf_idx;
+    if (n == 0) {
+        // tick all block inputs
+        shared_bindings_synthio_lfo_tick(self->base.sample_rate, frames);
+        (void)synthio_block_slot_get(&self->mix);
 
-    // If we are using 16 bit samples we need a 16 bit pointer, 8 bit needs an 8 bit pointer
-    int16_t *word_buffer = (int16_t *)self->buffer[self->last_buf_idx];
-    int8_t *hword_buffer = self->buffer[self->last_buf_idx];
-    uint32_t length = self->buffer_len / (self->base.bits_per_sample / 8);
-
-    // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
-    while (length != 0) {
-        // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
-        if (self->sample_buffer_length == 0) {
-            if (!self->more_data) { // The sample has indicated it has no more data to play
-                if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
-                    audiosample_reset_buffer(self->sample, false, 0);
-                } else { // If we were not supposed to loop the sample, stop playing it
-                    self->sample = NULL;
-                }
-            }
-            if (self->sample) {
-                // Load another sample buffer to play
-                audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-                if (result == GET_BUFFER_ERROR) {
-                    self->sample = NULL;
-                    self->sample_buffer_length = 0;
-                    self->more_data = false;
-                } else {
-                    // Track length in terms of words.
-                    self->sample_buffer_length /= (self->base.bits_per_sample / 8);
-                    self->more_data = result == GET_BUFFER_MORE_DATA;
-                }
-            }
+        // Tick biquad filters
+        for (uint8_t j = 0; j < self->filter_objs_len; j++) {
+            common_hal_synthio_biquad_tick(self->filter_objs[j]);
+        }
+        for (uint8_t c = 0; c < channel_count; c++) {
+            memset(channels[c], 0, frames * sizeof(int32_t));
         }
+        return frames;
+    }
 
-        if (self->sample == NULL) {
-            // tick all block inputs
-            shared_bindings_synthio_lfo_tick(self->base.sample_rate, length / self->base.channel_count);
-            (void)synthio_block_slot_get(&self->mix);
+    // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+    shared_bindings_synthio_lfo_tick(self->base.sample_rate, n);
+    mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
 
-            // Tick biquad filters
-            for (uint8_t j = 0; j < self->filter_objs_len; j++) {
-                common_hal_synthio_biquad_tick(self->filter_objs[j]);
-            }
-            if (self->base.samples_signed) {
-                memset(word_buffer, 0, length * (self->base.bits_per_sample / 8));
-            } else {
-                // For unsigned samples set to the middle which is "quiet"
-                if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                    uint16_t *uword_buffer = (uint16_t *)word_buffer;
-                    while (length--) {
-                        *uword_buffer++ = 32768;
-                    }
-                } else {
-                    memset(hword_buffer, 128, length * (self->base.bits_per_sample / 8));
-                }
-            }
+    if (mix <= MICROPY_FLOAT_CONST(0.01) || !self->filter_states) { // if mix is zero pure sample only or no biquad filter objects are provided
+        return n;
+    }
 
-            length = 0;
-        } else {
-            // we have a sample to play and filter
-            // Determine how many bytes we can process to our buffer, the less of the sample we have left and our buffer remaining
-            uint32_t n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
-
-            int16_t *sample_src = (int16_t *)self->sample_remaining_buffer; // for 16-bit samples
-            int8_t *sample_hsrc = (int8_t *)self->sample_remaining_buffer; // for 8-bit samples
-
-            // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
-            shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
-            mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-
-            if (mix <= MICROPY_FLOAT_CONST(0.01) || !self->filter_states) { // if mix is zero pure sample only or no biquad filter objects are provided
-                for (uint32_t i = 0; i < n; i++) {
-                    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                        word_buffer[i] = sample_src[i];
-                    } else {
-                        hword_buffer[i] = sample_hsrc[i];
-                    }
-                }
-            } else {
-                uint32_t i = 0;
-                while (i < n) {
-                    uint32_t n_samples = MIN(SYNTHIO_MAX_DUR, (n - i) >> (self->base.channel_count - 1));
-
-                    // Fill filter buffer with samples
-                    for (uint32_t j = 0; j < n_samples * self->base.channel_count; j++) {
-                        bool buf_offset = (j % self->base.channel_count) == 1;
-                        uint32_t k = j / self->base.channel_count;
-                        if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                            self->filter_buffer[k + SYNTHIO_MAX_DUR * buf_offset] = sample_src[i + j];
-                        } else {
-                            if (self->base.samples_signed) {
-                                self->filter_buffer[k + SYNTHIO_MAX_DUR * buf_offset] = sample_hsrc[i + j];
-                            } else {
-                                // Be careful here changing from an 8 bit unsigned to signed into a 32-bit signed
-                                self->filter_buffer[k + SYNTHIO_MAX_DUR * buf_offset] = (int8_t)(((uint8_t)sample_hsrc[i + j]) ^ 0x80);
-                            }
-                        }
-                    }
-
-                    // Process biquad filters
-                    for (uint8_t j = 0; j < self->filter_objs_len; j++) {
-                        mp_obj_t filter_obj = self->filter_objs[j];
-                        common_hal_synthio_biquad_tick(filter_obj);
-                        for (uint8_t k = 0; k < self->base.channel_count; k++) {
-                            synthio_biquad_filter_samples(filter_obj, &self->filter_states[j * self->base.channel_count + k], self->filter_buffer + k * SYNTHIO_MAX_DUR, n_samples);
-                        }
-                    }
-
-                    // Mix processed signal with original sample and transfer to output buffer
-                    for (uint32_t j = 0; j < n_samples * self->base.channel_count; j++) {
-                        bool buf_offset = (j % self->base.channel_count) == 1;
-                        uint32_t k = j / self->base.channel_count;
-                        if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                            word_buffer[i + j] = synthio_mix_down_sample((int32_t)((sample_src[i + j] * (MICROPY_FLOAT_CONST(1.0) - mix)) + (self->filter_buffer[k + SYNTHIO_MAX_DUR * buf_offset] * mix)), SYNTHIO_MIX_DOWN_SCALE(2));
-                            if (!self->base.samples_signed) {
-                                word_buffer[i + j] ^= 0x8000;
-                            }
-                        } else {
-                            if (self->base.samples_signed) {
-                                hword_buffer[i + j] = (int8_t)((sample_hsrc[i + j] * (MICROPY_FLOAT_CONST(1.0) - mix)) + (self->filter_buffer[k + SYNTHIO_MAX_DUR * buf_offset] * mix));
-                            } else {
-                                hword_buffer[i + j] = (uint8_t)(((int8_t)(((uint8_t)sample_hsrc[i + j]) ^ 0x80) * (MICROPY_FLOAT_CONST(1.0) - mix)) + (self->filter_buffer[k + SYNTHIO_MAX_DUR * buf_offset] * mix)) ^ 0x80;
-                            }
-                        }
-                    }
-
-                    i += n_samples * self->base.channel_count;
-                }
-            }
+    // Fill filter buffer with samples
+    for (uint8_t c = 0; c < channel_count; c++) {
+        memcpy(self->filter_buffer + c * SYNTHIO_MAX_DUR, channels[c], n * sizeof(int32_t));
+    }
+
+    // Process biquad filters
+    for (uint8_t j = 0; j < self->filter_objs_len; j++) {
+        mp_obj_t filter_obj = self->filter_objs[j];
+        common_hal_synthio_biquad_tick(filter_obj);
+        for (uint8_t c = 0; c < channel_count; c++) {
+            synthio_biquad_filter_samples(filter_obj, &self->filter_states[j * channel_count + c], self->filter_buffer + c * SYNTHIO_MAX_DUR, n);
+        }
+    }
 
-            // Update the remaining length and the buffer positions based on how much we wrote into our buffer
-            length -= n;
-            word_buffer += n;
-            hword_buffer += n;
-            self->sample_remaining_buffer += (n * (self->base.bits_per_sample / 8));
-            self->sample_buffer_length -= n;
+    // Mix processed signal with original sample
+    for (uint8_t c = 0; c < channel_count; c++) {
+        int32_t *samples = channels[c];
+        int32_t *filtered = self->filter_buffer + c * SYNTHIO_MAX_DUR;
+        for (uint32_t i = 0; i < n; i++) {
+            samples[i] = synthio_mix_down_sample((int32_t)((samples[i] * (MICROPY_FLOAT_CONST(1.0) - mix)) + (filtered[i] * mix)), SYNTHIO_MIX_DOWN_SCALE(2));
         }
     }
 
+    return n;
+}
+
+audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_obj_t *self, bool single_channel_output, uint8_t channel,
+    uint8_t **buffer, uint32_t *buffer_length) {
+
+    // Switch our buffers to the other buffer
+    self->last_buf_idx = !self->last_buf_idx;
+
+    audiocore_effect_fill_buffer(MP_OBJ_FROM_PTR(self), &self->base, (audiosample_get_block_fun)audiofilters_filter_get_block,
+        self->buffer[self->last_buf_idx], self->buffer_len);
+
     // Finally pass our buffer and length to the calling audio function
     *buffer = (uint8_t *)self->buffer[self->last_buf_idx];
     *buffer_length = self->buffer_len;
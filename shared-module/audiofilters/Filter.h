@@ -9,6 +9,7 @@
 
 #include "shared-bindings/synthio/Biquad.h"
 #include "shared-module/audiocore/__init__.h"
+#include "shared-module/audiocore/effect.h"
 #include "shared-module/synthio/__init__.h"
 #include "shared-module/synthio/block.h"
 #include "shared-module/synthio/Biquad.h"
@@ -28,21 +29,19 @@ typedef struct {
     uint8_t last_buf_idx;
     uint32_t buffer_len; // max buffer in bytes
 
-    uint8_t *sample_remaining_buffer;
-    uint32_t sample_buffer_length;
+    audiocore_effect_input_t input;
 
     int32_t *filter_buffer;
-
-    bool loop;
-    bool more_data;
-
-    mp_obj_t sample;
 } audiofilters_filter_obj_t;
 
 void audiofilters_filter_reset_buffer(audiofilters_filter_obj_t *self,
     bool single_channel_output,
     uint8_t channel);
 
+uint32_t audiofilters_filter_get_block(audiofilters_filter_obj_t *self,
+    int32_t **channels,
+    uint32_t frames);
+
 audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_obj_t *self,
     bool single_channel_output,
     uint8_t channel,
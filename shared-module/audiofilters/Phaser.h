@@ -8,6 +8,7 @@
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
+#include "shared-module/audiocore/effect.h"
 #include "shared-module/synthio/__init__.h"
 #include "shared-module/synthio/block.h"
 
@@ -26,22 +27,20 @@ typedef struct {
     uint8_t last_buf_idx;
     uint32_t buffer_len; // max buffer in bytes
 
-    uint8_t *sample_remaining_buffer;
-    uint32_t sample_buffer_length;
-
-    bool loop;
-    bool more_data;
+    audiocore_effect_input_t input;
 
     int16_t *allpass_buffer;
     int16_t *word_buffer;
-
-    mp_obj_t sample;
 } audiofilters_phaser_obj_t;
 
 void audiofilters_phaser_reset_buffer(audiofilters_phaser_obj_t *self,
     bool single_channel_output,
     uint8_t channel);
 
+uint32_t audiofilters_phaser_get_block(audiofilters_phaser_obj_t *self,
+    int32_t **channels,
+    uint32_t frames);
+
 audioio_get_buffer_result_t audiofilters_phaser_get_buffer(audiofilters_phaser_obj_t *self,
     bool single_channel_output,
     uint8_t channel,
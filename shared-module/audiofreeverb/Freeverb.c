@@ -52,11 +52,8 @@ void common_hal_audiofreeverb_freeverb_construct(audiofreeverb_freeverb_obj_t *s
     self->last_buf_idx = 1; // Which buffer to use first, toggle between 0 and 1
 
     // Initialize other values most effects will need.
-    self->sample = NULL; // The current playing sample
-    self->sample_remaining_buffer = NULL; // Pointer to the start of the sample buffer we have not played
-    self->sample_buffer_length = 0; // How many samples do we have left to play (these may be 16 bit!)
-    self->loop = false; // When the sample is done do we loop to the start again or stop (e.g. in a wav file)
-    self->more_data = false; // Is there still more data to read from the sample or did we finish
+    audiocore_effect_input_init(&self->input);
+    audiocore_effect_pool_reserve(1);
 
     // The below section sets up the reverb effect's starting values. For a different effect this section will change
     if (roomsize == MP_OBJ_NULL) {
@@ -190,107 +187,58 @@ void audiofreeverb_freeverb_reset_buffer(audiofreeverb_freeverb_obj_t *self,
 }
 
 bool common_hal_audiofreeverb_freeverb_get_playing(audiofreeverb_freeverb_obj_t *self) {
-    return self->sample != NULL;
+    return self->input.sample != NULL;
 }
 
 void common_hal_audiofreeverb_freeverb_play(audiofreeverb_freeverb_obj_t *self, mp_obj_t sample, bool loop) {
-    audiosample_must_match(&self->base, sample, false);
-
-    self->sample = sample;
-    self->loop = loop;
-
-    audiosample_reset_buffer(self->sample, false, 0);
-    audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-
-    // Track remaining sample length in terms of bytes per sample
-    self->sample_buffer_length /= (self->base.bits_per_sample / 8);
-    // Store if we have more data in the sample to retrieve
-    self->more_data = result == GET_BUFFER_MORE_DATA;
-
-    return;
+    audiocore_effect_input_play(&self->input, &self->base, sample, loop);
 }
 
 void common_hal_audiofreeverb_freeverb_stop(audiofreeverb_freeverb_obj_t *self) {
     // When the sample is set to stop playing do any cleanup here
     // For reverb we clear the sample but the reverb continues until the object reading our effect stops
-    self->sample = NULL;
-    return;
+    audiocore_effect_input_stop(&self->input);
 }
 
-audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_freeverb_obj_t *self, bool single_channel_output, uint8_t channel,
-    uint8_t **buffer, uint32_t *buffer_length) {
-
-    // Switch our buffers to the other buffer
-    self->last_buf_idx = !self->last_buf_idx;
-
-    // 16 bit samples we need a 16 bit pointer
-    int16_t *word_buffer = (int16_t *)self->buffer[self->last_buf_idx];
-    uint32_t length = self->buffer_len / (self->base.bits_per_sample / 8);
-
-    // Loop over the entire length of our buffer to fill it, this may require several calls to get data from the sample
-    while (length != 0) {
-        // Check if there is no more sample to play, we will either load more data, reset the sample if loop is on or clear the sample
-        if (self->sample_buffer_length == 0) {
-            if (!self->more_data) { // The sample has indicated it has no more data to play
-                if (self->loop && self->sample) { // If we are supposed to loop reset the sample to the start
-                    audiosample_reset_buffer(self->sample, false, 0);
-                } else { // If we were not supposed to loop the sample, stop playing it but we still need to play the reverb
-                    self->sample = NULL;
-                }
-            }
-            if (self->sample) {
-                // Load another sample buffer to play
-                audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->sample_remaining_buffer, &self->sample_buffer_length);
-                if (result == GET_BUFFER_ERROR) {
-                    self->sample = NULL;
-                    self->sample_buffer_length = 0;
-                    self->more_data = false;
-                } else {
-                    // Track length in terms of words.
-                    self->sample_buffer_length /= (self->base.bits_per_sample / 8);
-                    self->more_data = result == GET_BUFFER_MORE_DATA;
-                }
-            }
-        }
+uint32_t audiofreeverb_freeverb_get_block(audiofreeverb_freeverb_obj_t *self, int32_t **channels, uint32_t frames) {
+    uint8_t channel_count = self->base.channel_count;
 
-        // Determine how many bytes we can process to our buffer, the less of the sample we have left and our buffer remaining
-        uint32_t n;
-        if (self->sample == NULL) {
-            n = MIN(length, SYNTHIO_MAX_DUR * self->base.channel_count);
-        } else {
-            n = MIN(MIN(self->sample_buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
+    // Get as much of the sample as fits, if there is no sample we still need to play the reverb
+    frames = MIN(frames, SYNTHIO_MAX_DUR);
+    uint32_t n = audiocore_effect_input_read(&self->input, &self->base, channels, frames);
+    if (n == 0) {
+        for (uint8_t c = 0; c < channel_count; c++) {
+            memset(channels[c], 0, frames * sizeof(int32_t));
         }
+        n = frames;
+    }
 
-        // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
-        shared_bindings_synthio_lfo_tick(self->base.sample_rate, n / self->base.channel_count);
-        mp_float_t damp = synthio_block_slot_get_limited(&self->damp, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-        int16_t damp1, damp2;
-        audiofreeverb_freeverb_get_damp_fixedpoint(damp, &damp1, &damp2);
-
-        mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-        int16_t mix_sample, mix_effect;
-        audiofreeverb_freeverb_get_mix_fixedpoint(mix, &mix_sample, &mix_effect);
+    // get the effect values we need from the BlockInput. These may change at run time so you need to do bounds checking if required
+    shared_bindings_synthio_lfo_tick(self->base.sample_rate, n);
+    mp_float_t damp = synthio_block_slot_get_limited(&self->damp, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+    int16_t damp1, damp2;
+    audiofreeverb_freeverb_get_damp_fixedpoint(damp, &damp1, &damp2);
 
-        mp_float_t roomsize = synthio_block_slot_get_limited(&self->roomsize, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
-        int16_t feedback = audiofreeverb_freeverb_get_roomsize_fixedpoint(roomsize);
+    mp_float_t mix = synthio_block_slot_get_limited(&self->mix, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+    int16_t mix_sample, mix_effect;
+    audiofreeverb_freeverb_get_mix_fixedpoint(mix, &mix_sample, &mix_effect);
 
-        int16_t *sample_src = (int16_t *)self->sample_remaining_buffer;
+    mp_float_t roomsize = synthio_block_slot_get_limited(&self->roomsize, MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(1.0));
+    int16_t feedback = audiofreeverb_freeverb_get_roomsize_fixedpoint(roomsize);
 
-        for (uint32_t i = 0; i < n; i++) {
-            int32_t sample_word = 0;
-            if (self->sample != NULL) {
-                sample_word = sample_src[i];
-            }
+    // Both channels run through the same comb and all-pass filters, one sample after the other
+    for (uint32_t i = 0; i < n; i++) {
+        for (uint8_t c = 0; c < channel_count; c++) {
+            int32_t sample_word = channels[c][i];
 
             int32_t word, sum;
             int16_t input, bufout, output;
-            uint32_t channel_comb_offset = 0, channel_allpass_offset = 0;
 
             input = synthio_sat16(sample_word * 8738, 17); // Initial input scaled down so we can add reverb
             sum = 0;
 
             // Calculate each of the 8 comb buffers
-            for (uint32_t j = 0 + channel_comb_offset; j < 8 + channel_comb_offset; j++) {
+            for (uint32_t j = 0; j < 8; j++) {
                 bufout = self->combbuffers[j][self->combbufferindex[j]];
                 sum += bufout;
                 self->combfitlers[j] = synthio_sat16(bufout * damp2 + self->combfitlers[j] * damp1, 15);
@@ -303,7 +251,7 @@ audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_free
             output = synthio_sat16(sum * 31457, 17); // 31457 = 0.24f with shift of 17
 
             // Calculate each of the 4 all pass buffers
-            for (uint32_t j = 0 + channel_allpass_offset; j < 4 + channel_allpass_offset; j++) {
+            for (uint32_t j = 0; j < 4; j++) {
                 bufout = self->allpassbuffers[j][self->allpassbufferindex[j]];
                 self->allpassbuffers[j][self->allpassbufferindex[j]] = output + (bufout >> 1); // bufout >> 1 same as bufout*0.5f
                 output = synthio_sat16(bufout - output, 1);
@@ -315,25 +263,22 @@ audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_free
             word = output * 30; // Add some volume back don't have to saturate as next step will
 
             word = synthio_sat16(sample_word * mix_sample, 15) + synthio_sat16(word * mix_effect, 15);
-            word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
-            word_buffer[i] = (int16_t)word;
-
-            if ((self->base.channel_count == 2) && (channel_comb_offset == 0)) {
-                channel_comb_offset = 8;
-                channel_allpass_offset = 4;
-            } else {
-                channel_comb_offset = 0;
-                channel_allpass_offset = 0;
-            }
+            channels[c][i] = (int16_t)synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
         }
-
-        // Update the remaining length and the buffer positions based on how much we wrote into our buffer
-        length -= n;
-        word_buffer += n;
-        self->sample_remaining_buffer += (n * (self->base.bits_per_sample / 8));
-        self->sample_buffer_length -= n;
     }
 
+    return n;
+}
+
+audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_freeverb_obj_t *self, bool single_channel_output, uint8_t channel,
+    uint8_t **buffer, uint32_t *buffer_length) {
+
+    // Switch our buffers to the other buffer
+    self->last_buf_idx = !self->last_buf_idx;
+
+    audiocore_effect_fill_buffer(MP_OBJ_FROM_PTR(self), &self->base, (audiosample_get_block_fun)audiofreeverb_freeverb_get_block,
+        self->buffer[self->last_buf_idx], self->buffer_len);
+
     // Finally pass our buffer and length to the calling audio function
     *buffer = (uint8_t *)self->buffer[self->last_buf_idx];
     *buffer_length = self->buffer_len;
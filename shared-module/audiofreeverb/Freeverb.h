@@ -8,6 +8,7 @@
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
+#include "shared-module/audiocore/effect.h"
 #include "shared-module/synthio/__init__.h"
 #include "shared-module/synthio/block.h"
 
@@ -23,11 +24,7 @@ typedef struct {
     uint8_t last_buf_idx;
     uint32_t buffer_len; // max buffer in bytes
 
-    uint8_t *sample_remaining_buffer;
-    uint32_t sample_buffer_length;
-
-    bool loop;
-    bool more_data;
+    audiocore_effect_input_t input;
 
     int16_t combbuffersizes[16];
     int16_t *combbuffers[16];
@@ -37,14 +34,16 @@ typedef struct {
     int16_t allpassbuffersizes[8];
     int16_t *allpassbuffers[8];
     int16_t allpassbufferindex[8];
-
-    mp_obj_t sample;
 } audiofreeverb_freeverb_obj_t;
 
 void audiofreeverb_freeverb_reset_buffer(audiofreeverb_freeverb_obj_t *self,
     bool single_channel_output,
     uint8_t channel);
 
+uint32_t audiofreeverb_freeverb_get_block(audiofreeverb_freeverb_obj_t *self,
+    int32_t **channels,
+    uint32_t frames);
+
 audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_freeverb_obj_t *self,
     bool single_channel_output,
     uint8_t channel,
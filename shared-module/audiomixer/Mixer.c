@@ -70,30 +70,34 @@ void audiomixer_mixer_reset_buffer(audiomixer_mixer_obj_t *self,
     }
 }
 
+// Cortex-M4, M7 and M33 cores with the DSP extension can work on both 16-bit
+// halves of a word with a single instruction.
+#if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1)) || (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+#define MIXER_USE_DSP (1)
+#else
+#define MIXER_USE_DSP (0)
+#endif
+
 __attribute__((always_inline))
 static inline uint32_t add16signed(uint32_t a, uint32_t b) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_USE_DSP
     return __QADD16(a, b);
     #else
-    uint32_t result = 0;
-    for (int8_t i = 0; i < 2; i++) {
-        int16_t ai = a >> (sizeof(int16_t) * 8 * i);
-        int16_t bi = b >> (sizeof(int16_t) * 8 * i);
-        int32_t intermediate = (int32_t)ai + bi;
-        if (intermediate > SHRT_MAX) {
-            intermediate = SHRT_MAX;
-        } else if (intermediate < SHRT_MIN) {
-            intermediate = SHRT_MIN;
-        }
-        result |= (((uint32_t)intermediate) & 0xffff) << (sizeof(int16_t) * 8 * i);
-    }
-    return result;
+    // Add the low 15 bits of each half without carrying into the other half,
+    // then fix up the sign bits to get a wrapping add of both halves.
+    uint32_t sum = ((a & 0x7fff7fff) + (b & 0x7fff7fff)) ^ ((a ^ b) & 0x80008000);
+    // A half overflowed if both inputs have the same sign and the sum does not.
+    uint32_t overflow = ~(a ^ b) & (a ^ sum) & 0x80008000;
+    uint32_t mask = (overflow >> 15) * 0xffff;
+    // Saturate to 0x7fff for positive inputs or 0x8000 for negative ones.
+    uint32_t saturated = 0x7fff7fff + ((a >> 15) & 0x00010001);
+    return (sum & ~mask) | (saturated & mask);
     #endif
 }
 
 __attribute__((always_inline))
 static inline uint32_t mult16signed(uint32_t val, int32_t lomul, int32_t himul) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_USE_DSP
     lomul <<= 16;
     himul <<= 16;
     int32_t hi, lo;
@@ -106,25 +110,17 @@ static inline uint32_t mult16signed(uint32_t val, int32_t lomul, int32_t himul)
     __asm__ volatile ("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
     return val;
     #else
-    uint32_t result = 0;
-    for (int8_t i = 0; i < 2; i++) {
-        float mod_mul = (float)(i ? himul : lomul) / (float)((1 << 15) - 1);
-        int16_t ai = (val >> (sizeof(uint16_t) * 8 * i));
-        int32_t intermediate = (int32_t)(ai * mod_mul);
-        if (intermediate > SHRT_MAX) {
-            intermediate = SHRT_MAX;
-        } else if (intermediate < SHRT_MIN) {
-            intermediate = SHRT_MIN;
-        }
-        intermediate &= 0x0000FFFF;
-        result |= (((uint32_t)intermediate)) << (sizeof(int16_t) * 8 * i);
-    }
-    return result;
+    // Same rounding as the DSP version so every port mixes identically
+    int32_t lo = ((int32_t)(int16_t)val * lomul) >> 15;
+    int32_t hi = (((int32_t)val >> 16) * himul) >> 15;
+    lo = MIN(MAX(lo, SHRT_MIN), SHRT_MAX);
+    hi = MIN(MAX(hi, SHRT_MIN), SHRT_MAX);
+    return ((uint32_t)lo & 0xffff) | ((uint32_t)hi << 16);
     #endif
 }
 
 static inline uint32_t tounsigned8(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_USE_DSP
     return __UADD8(val, 0x80808080);
     #else
     return val ^ 0x80808080;
@@ -132,7 +128,7 @@ static inline uint32_t tounsigned8(uint32_t val) {
 }
 
 static inline uint32_t tounsigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_USE_DSP
     return __UADD16(val, 0x80008000);
     #else
     return val ^ 0x80008000;
@@ -140,7 +136,7 @@ static inline uint32_t tounsigned16(uint32_t val) {
 }
 
 static inline uint32_t tosigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_USE_DSP
     return __UADD16(val, 0x80008000);
     #else
     return val ^ 0x80008000;
@@ -156,7 +152,7 @@ static inline uint32_t pack8(uint32_t val) {
 }
 
 static inline uint32_t copy16lsb(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_USE_DSP
     return __PKHBT(val, val, 16);
     #else
     val &= 0x0000ffff;
@@ -165,7 +161,7 @@ static inline uint32_t copy16lsb(uint32_t val) {
 }
 
 static inline uint32_t copy16msb(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_USE_DSP
     return __PKHTB(val, val, 16);
     #else
     val &= 0xffff0000;
@@ -173,12 +169,112 @@ static inline uint32_t copy16msb(uint32_t val) {
     #endif
 }
 
+// Scale `n` words of a voice by its levels and either store them (the first
+// active voice) or add them to what is already in `dst`. The flags are
+// constants in every caller below, so each use compiles to its own loop
+// without any format checks inside it.
+__attribute__((always_inline))
+static inline void mix_words(uint32_t *dst, const uint32_t *src, uint32_t n, int32_t lo_level, int32_t hi_level,
+    const bool accumulate, const bool eight_bit, const bool samples_signed, const bool mono_to_stereo) {
+    if (!eight_bit) {
+        if (!mono_to_stereo) {
+            for (uint32_t i = 0; i < n; i++) {
+                uint32_t word = src[i];
+                if (!samples_signed) {
+                    word = tosigned16(word);
+                }
+                word = mult16signed(word, lo_level, hi_level);
+                dst[i] = accumulate ? add16signed(word, dst[i]) : word;
+            }
+        } else {
+            for (uint32_t i = 0; i + 1 < n; i += 2) {
+                uint32_t word = src[i >> 1];
+                if (!samples_signed) {
+                    word = tosigned16(word);
+                }
+                uint32_t left = mult16signed(copy16lsb(word), lo_level, hi_level);
+                uint32_t right = mult16signed(copy16msb(word), lo_level, hi_level);
+                dst[i] = accumulate ? add16signed(left, dst[i]) : left;
+                dst[i + 1] = accumulate ? add16signed(right, dst[i + 1]) : right;
+            }
+        }
+    } else {
+        uint16_t *hdst = (uint16_t *)dst;
+        const uint16_t *hsrc = (const uint16_t *)src;
+        if (!mono_to_stereo) {
+            for (uint32_t i = 0; i < n * 2; i++) {
+                uint32_t word = unpack8(hsrc[i]);
+                if (!samples_signed) {
+                    word = tosigned16(word);
+                }
+                word = mult16signed(word, lo_level, hi_level);
+                if (accumulate) {
+                    word = add16signed(word, unpack8(hdst[i]));
+                }
+                hdst[i] = pack8(word);
+            }
+        } else {
+            for (uint32_t i = 0; i + 1 < n * 2; i += 2) {
+                uint32_t word = unpack8(hsrc[i >> 1]);
+                if (!samples_signed) {
+                    word = tosigned16(word);
+                }
+                uint32_t left = mult16signed(copy16lsb(word), lo_level, hi_level);
+                uint32_t right = mult16signed(copy16msb(word), lo_level, hi_level);
+                if (accumulate) {
+                    left = add16signed(left, unpack8(hdst[i]));
+                    right = add16signed(right, unpack8(hdst[i + 1]));
+                }
+                hdst[i] = pack8(left);
+                hdst[i + 1] = pack8(right);
+            }
+        }
+    }
+}
+
+typedef void (*mix_kernel_t)(uint32_t *dst, const uint32_t *src, uint32_t n, int32_t lo_level, int32_t hi_level);
+
+#define MIX_KERNEL(name, accumulate, eight_bit, samples_signed, mono_to_stereo) \
+    static void name(uint32_t *dst, const uint32_t *src, uint32_t n, int32_t lo_level, int32_t hi_level) { \
+        mix_words(dst, src, n, lo_level, hi_level, accumulate, eight_bit, samples_signed, mono_to_stereo); \
+    }
+
+MIX_KERNEL(copy_16u, false, false, false, false)
+MIX_KERNEL(copy_16u_mono, false, false, false, true)
+MIX_KERNEL(copy_16s, false, false, true, false)
+MIX_KERNEL(copy_16s_mono, false, false, true, true)
+MIX_KERNEL(copy_8u, false, true, false, false)
+MIX_KERNEL(copy_8u_mono, false, true, false, true)
+MIX_KERNEL(copy_8s, false, true, true, false)
+MIX_KERNEL(copy_8s_mono, false, true, true, true)
+MIX_KERNEL(add_16u, true, false, false, false)
+MIX_KERNEL(add_16u_mono, true, false, false, true)
+MIX_KERNEL(add_16s, true, false, true, false)
+MIX_KERNEL(add_16s_mono, true, false, true, true)
+MIX_KERNEL(add_8u, true, true, false, false)
+MIX_KERNEL(add_8u_mono, true, true, false, true)
+MIX_KERNEL(add_8s, true, true, true, false)
+MIX_KERNEL(add_8s_mono, true, true, true, true)
+
+// Indexed by [voices_active][format], see audiomixer_mixer_voice_format()
+static const mix_kernel_t mix_kernels[2][8] = {
+    { copy_16u, copy_16u_mono, copy_16s, copy_16s_mono, copy_8u, copy_8u_mono, copy_8s, copy_8s_mono },
+    { add_16u, add_16u_mono, add_16s, add_16s_mono, add_8u, add_8u_mono, add_8s, add_8s_mono },
+};
+
+uint8_t audiomixer_mixer_voice_format(audiomixer_mixer_obj_t *self, audiosample_base_t *sample) {
+    return (self->base.bits_per_sample == 8 ? AUDIOMIXER_FORMAT_8BIT : 0)
+           | (self->base.samples_signed ? AUDIOMIXER_FORMAT_SIGNED : 0)
+           | (sample->channel_count != self->base.channel_count ? AUDIOMIXER_FORMAT_MONO_TO_STEREO : 0);
+}
+
 #define ALMOST_ONE (MICROPY_FLOAT_CONST(32767.) / 32768)
 
 static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
     audiomixer_mixervoice_obj_t *voice, bool voices_active,
     uint32_t *word_buffer, uint32_t length) {
-    audiosample_base_t *sample = MP_OBJ_TO_PTR(voice->sample);
+    bool mono_to_stereo = voice->format & AUDIOMIXER_FORMAT_MONO_TO_STEREO;
+    mix_kernel_t kernel = mix_kernels[voices_active][voice->format];
     while (length != 0) {
         if (voice->buffer_length == 0) {
             if (!voice->more_data) {
@@ -208,7 +304,7 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
 
         #if CIRCUITPY_SYNTHIO
         uint32_t n;
-        if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
+        if (MP_LIKELY(!mono_to_stereo)) {
             n = MIN(MIN(voice->buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
         } else {
             n = MIN(MIN(voice->buffer_length << 1, length), SYNTHIO_MAX_DUR * self->base.channel_count);
@@ -220,7 +316,7 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
         int16_t panning = synthio_block_slot_get_scaled(&voice->panning, -ALMOST_ONE, ALMOST_ONE);
         #else
         uint32_t n;
-        if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
+        if (MP_LIKELY(!mono_to_stereo)) {
             n = MIN(voice->buffer_length, length);
         } else {
             n = MIN(voice->buffer_length << 1, length);
@@ -245,120 +341,12 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
             hi_level = (right_panning_scaled * hi_level) >> 15;
         }
 
-        // First active voice gets copied over verbatim.
-        if (!voices_active) {
-            if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                if (MP_LIKELY(self->base.samples_signed)) {
-                    if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                        for (uint32_t i = 0; i < n; i++) {
-                            uint32_t v = src[i];
-                            word_buffer[i] = mult16signed(v, lo_level, hi_level);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i < n; i += 2) {
-                            uint32_t v = src[i >> 1];
-                            word_buffer[i] = mult16signed(copy16lsb(v), lo_level, hi_level);
-                            word_buffer[i + 1] = mult16signed(copy16msb(v), lo_level, hi_level);
-                        }
-                    }
-                } else {
-                    if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                        for (uint32_t i = 0; i < n; i++) {
-                            uint32_t v = src[i];
-                            v = tosigned16(v);
-                            word_buffer[i] = mult16signed(v, lo_level, hi_level);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i + 1 < n; i += 2) {
-                            uint32_t v = src[i >> 1];
-                            v = tosigned16(v);
-                            word_buffer[i] = mult16signed(copy16lsb(v), lo_level, hi_level);
-                            word_buffer[i + 1] = mult16signed(copy16msb(v), lo_level, hi_level);
-                        }
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                    for (uint32_t i = 0; i < n * 2; i++) {
-                        uint32_t word = unpack8(hsrc[i]);
-                        if (MP_LIKELY(!self->base.samples_signed)) {
-                            word = tosigned16(word);
-                        }
-                        word = mult16signed(word, lo_level, hi_level);
-                        hword_buffer[i] = pack8(word);
-                    }
-                } else {
-                    for (uint32_t i = 0; i + 1 < n * 2; i += 2) {
-                        uint32_t word = unpack8(hsrc[i >> 1]);
-                        if (MP_LIKELY(!self->base.samples_signed)) {
-                            word = tosigned16(word);
-                        }
-                        hword_buffer[i] = pack8(mult16signed(copy16lsb(word), lo_level, hi_level));
-                        hword_buffer[i + 1] = pack8(mult16signed(copy16msb(word), lo_level, hi_level));
-                    }
-                }
-            }
-        } else {
-            if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                if (MP_LIKELY(self->base.samples_signed)) {
-                    if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                        for (uint32_t i = 0; i < n; i++) {
-                            uint32_t word = src[i];
-                            word_buffer[i] = add16signed(mult16signed(word, lo_level, hi_level), word_buffer[i]);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i + 1 < n; i += 2) {
-                            uint32_t word = src[i >> 1];
-                            word_buffer[i] = add16signed(mult16signed(copy16lsb(word), lo_level, hi_level), word_buffer[i]);
-                            word_buffer[i + 1] = add16signed(mult16signed(copy16msb(word), lo_level, hi_level), word_buffer[i + 1]);
-                        }
-                    }
-                } else {
-                    if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                        for (uint32_t i = 0; i < n; i++) {
-                            uint32_t word = src[i];
-                            word = tosigned16(word);
-                            word_buffer[i] = add16signed(mult16signed(word, lo_level, hi_level), word_buffer[i]);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i + 1 < n; i += 2) {
-                            uint32_t word = src[i >> 1];
-                            word = tosigned16(word);
-                            word_buffer[i] = add16signed(mult16signed(copy16lsb(word), lo_level, hi_level), word_buffer[i]);
-                            word_buffer[i + 1] = add16signed(mult16signed(copy16msb(word), lo_level, hi_level), word_buffer[i + 1]);
-                        }
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                    for (uint32_t i = 0; i < n * 2; i++) {
-                        uint32_t word = unpack8(hsrc[i]);
-                        if (MP_LIKELY(!self->base.samples_signed)) {
-                            word = tosigned16(word);
-                        }
-                        word = mult16signed(word, lo_level, hi_level);
-                        word = add16signed(word, unpack8(hword_buffer[i]));
-                        hword_buffer[i] = pack8(word);
-                    }
-                } else {
-                    for (uint32_t i = 0; i + 1 < n * 2; i += 2) {
-                        uint32_t word = unpack8(hsrc[i >> 1]);
-                        if (MP_LIKELY(!self->base.samples_signed)) {
-                            word = tosigned16(word);
-                        }
-                        hword_buffer[i] = pack8(add16signed(mult16signed(copy16lsb(word), lo_level, hi_level), unpack8(hword_buffer[i])));
-                        hword_buffer[i + 1] = pack8(add16signed(mult16signed(copy16msb(word), lo_level, hi_level), unpack8(hword_buffer[i + 1])));
-                    }
-                }
-            }
-        }
+        // The first active voice is stored, later ones are added to it.
+        kernel(word_buffer, src, n, lo_level, hi_level);
+
         length -= n;
         word_buffer += n;
-        if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
+        if (MP_LIKELY(!mono_to_stereo)) {
             voice->remaining_buffer += n;
             voice->buffer_length -= n;
         } else {
@@ -27,6 +27,14 @@ typedef struct {
     mp_obj_t voice[];
 } audiomixer_mixer_obj_t;
 
+// How a voice's samples are laid out relative to the mixer output. Worked out
+// once when the voice starts playing.
+#define AUDIOMIXER_FORMAT_MONO_TO_STEREO (1)
+#define AUDIOMIXER_FORMAT_SIGNED (2)
+#define AUDIOMIXER_FORMAT_8BIT (4)
+
+uint8_t audiomixer_mixer_voice_format(audiomixer_mixer_obj_t *self, audiosample_base_t *sample);
+
 
 // These are not available from Python because it may be called in an interrupt.
 void audiomixer_mixer_reset_buffer(audiomixer_mixer_obj_t *self,
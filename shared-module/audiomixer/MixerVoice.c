@@ -11,8 +11,13 @@
 
 #include "py/runtime.h"
 #include "shared-module/audiomixer/__init__.h"
+#include "shared-bindings/audiocore/__init__.h"
 #include "shared-module/audiocore/RawSample.h"
 
+#if CIRCUITPY_AUDIOSPEED
+#include "shared-bindings/audiospeed/Resampler.h"
+#endif
+
 void common_hal_audiomixer_mixervoice_construct(audiomixer_mixervoice_obj_t *self) {
     self->sample = NULL;
     common_hal_audiomixer_mixervoice_set_level(self, mp_obj_new_float(1.0));
@@ -64,9 +69,19 @@ void common_hal_audiomixer_mixervoice_set_loop(audiomixer_mixervoice_obj_t *self
 }
 
 void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t *self, mp_obj_t sample_in, bool loop) {
+    #if CIRCUITPY_AUDIOSPEED
+    const audiosample_base_t *sample_base = audiosample_check(sample_in);
+    if (sample_base->sample_rate != self->parent->base.sample_rate && !mp_obj_is_type(sample_in, &audiospeed_resampler_type)) {
+        audiosample_check_for_deinit(sample_base);
+        audiospeed_resampler_obj_t *resampler = mp_obj_malloc(audiospeed_resampler_obj_t, &audiospeed_resampler_type);
+        common_hal_audiospeed_resampler_construct(resampler, sample_in, AUDIOSPEED_QUALITY_LINEAR);
+        sample_in = MP_OBJ_FROM_PTR(resampler);
+    }
+    #endif
     audiosample_must_match(&self->parent->base, sample_in, true);
     // cast is safe, checked by must_match
     audiosample_base_t *sample = MP_OBJ_TO_PTR(sample_in);
+    self->format = audiomixer_mixer_voice_format(self->parent, sample);
     self->sample = sample;
     self->loop = loop;
 
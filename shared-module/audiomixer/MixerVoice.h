@@ -19,6 +19,7 @@ typedef struct {
     mp_obj_t sample;
     bool loop;
     bool more_data;
+    uint8_t format; // AUDIOMIXER_FORMAT_* flags
     uint32_t *remaining_buffer;
     uint32_t buffer_length;
     #if CIRCUITPY_SYNTHIO
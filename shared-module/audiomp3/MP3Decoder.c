@@ -27,6 +27,13 @@
 
 #define DO_DEBUG (0)
 
+// Number of entries in the seek index, and the initial number of frames
+// between entries. The stride doubles each time the index fills up.
+#define SEEK_INDEX_SIZE (64)
+#define SEEK_INDEX_STRIDE (8)
+// Delay of the decoder's synthesis filterbank, in samples per channel
+#define DECODER_DELAY (529)
+
 #if defined(MICROPY_UNIX_COVERAGE)
 #define background_callback_prevent() ((void)0)
 #define background_callback_allow() ((void)0)
@@ -153,6 +160,7 @@ static bool mp3file_update_inbuf_always(audiomp3_mp3file_obj_t *self, bool block
         }
 
         self->inbuf.write_off += n_read;
+        self->stream_pos += n_read;
     }
 
     if (DO_DEBUG) {
@@ -202,6 +210,23 @@ static bool mp3file_update_inbuf_half(audiomp3_mp3file_obj_t *self, bool block_o
 #define READ_PTR(self) (INPUT_BUFFER_READ_PTR(self->inbuf))
 #define BYTES_LEFT(self) (INPUT_BUFFER_AVAILABLE(self->inbuf))
 #define CONSUME(self, n) (INPUT_BUFFER_CONSUME(self->inbuf, n))
+// Stream offset of READ_PTR
+#define FRAME_OFFSET(self) ((self)->stream_pos - BYTES_LEFT(self))
+
+/** Move the stream to `offset` and empty the input buffer.
+ *
+ * Returns 0 on success, or the errno if the stream can't seek.
+ */
+static int mp3file_seek_stream(audiomp3_mp3file_obj_t *self, uint32_t offset) {
+    off_t pos = stream_lseek(self->stream, offset, SEEK_SET);
+    if (pos < 0) {
+        return -pos;
+    }
+    self->stream_pos = pos;
+    INPUT_BUFFER_CLEAR(self->inbuf);
+    self->eof = 0;
+    return 0;
+}
 
 // http://id3.org/id3v2.3.0
 static void mp3file_skip_id3v2(audiomp3_mp3file_obj_t *self, bool block_ok) {
@@ -234,7 +259,9 @@ static void mp3file_skip_id3v2(audiomp3_mp3file_obj_t *self, bool block_ok) {
     size -= to_consume;
 
     // Next, seek in the file after the header
-    if (stream_lseek(self->stream, SEEK_CUR, size) == 0) {
+    off_t pos = stream_lseek(self->stream, size, SEEK_CUR);
+    if (pos >= 0) {
+        self->stream_pos = pos;
         return;
     }
 
@@ -277,13 +304,170 @@ static bool mp3file_get_next_frame_info(audiomp3_mp3file_obj_t *self, MP3FrameIn
     return err == ERR_MP3_NONE;
 }
 
+// Size in bytes of the frame at READ_PTR, or 0 for a free format frame
+static uint32_t mp3file_frame_size(audiomp3_mp3file_obj_t *self, const MP3FrameInfo *fi) {
+    if (fi->bitrate == 0) {
+        return 0;
+    }
+    uint32_t samples_per_frame = fi->outputSamps / fi->nChans;
+    uint32_t padding = (READ_PTR(self)[2] >> 1) & 1;
+    return samples_per_frame / 8 * fi->bitrate / fi->samprate + padding;
+}
+
+// Size of the side information, which follows the header and CRC and is
+// smaller for MPEG2
+static size_t mp3file_side_info_size(const MP3FrameInfo *fi) {
+    uint32_t samples_per_frame = fi->outputSamps / fi->nChans;
+    return samples_per_frame == 1152 ? (fi->nChans == 1 ? 17 : 32) : (fi->nChans == 1 ? 9 : 17);
+}
+
+// Note the frame at READ_PTR in `frames`, which holds the last
+// MP3FILE_PRIME_FRAMES_MAX frames by index
+static void mp3file_note_frame(audiomp3_mp3file_obj_t *self, mp3file_frame_t *frames, int32_t index, const MP3FrameInfo *fi) {
+    mp3file_frame_t *frame = &frames[index % MP3FILE_PRIME_FRAMES_MAX];
+    const uint8_t *header = READ_PTR(self);
+    size_t side_info = 4 + ((header[1] & 1) ? 0 : 2);
+    size_t used = side_info + mp3file_side_info_size(fi);
+    uint32_t size = mp3file_frame_size(self, fi);
+    frame->offset = FRAME_OFFSET(self);
+    // A frame whose size isn't known counts as holding no main data and
+    // reaching as far back as it can, which primes from further back
+    frame->main_data_size = size > used ? size - used : 0;
+    frame->main_data_begin = 511;
+    if ((uint32_t)BYTES_LEFT(self) >= side_info + 2) {
+        const uint8_t *p = header + side_info;
+        frame->main_data_begin = fi->outputSamps / fi->nChans == 1152 ? (p[0] << 1) | (p[1] >> 7) : p[0];
+    }
+}
+
+// First frame to decode so that frame `target` comes out the same as when the
+// stream is played through. Neither the target nor the frame before it, whose
+// overlap goes into the target, may reach back further into the bit reservoir
+// than the frames decoded before them. `frames` holds `first` to `target`.
+static int32_t mp3file_prime_start(const mp3file_frame_t *frames, int32_t first, int32_t target) {
+    if (target <= first) {
+        return target;
+    }
+    const mp3file_frame_t *before = &frames[(target - 1) % MP3FILE_PRIME_FRAMES_MAX];
+    uint32_t target_begin = frames[target % MP3FILE_PRIME_FRAMES_MAX].main_data_begin;
+    // Main data from the frames from `start` up to `before`
+    uint32_t reservoir = 0;
+    int32_t start = target - 1;
+    while (start > first && (reservoir < before->main_data_begin || reservoir + before->main_data_size < target_begin)) {
+        start--;
+        reservoir += frames[start % MP3FILE_PRIME_FRAMES_MAX].main_data_size;
+    }
+    return start;
+}
+
+static uint32_t read_be32(const uint8_t *p) {
+    return (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+// If the frame at READ_PTR is a Xing/Info header, read the encoder delay and
+// padding from it and skip it.
+// http://gabriel.mp3-tech.org/mp3infotag.html
+static void mp3file_skip_info_frame(audiomp3_mp3file_obj_t *self, const MP3FrameInfo *fi) {
+    uint32_t size = mp3file_frame_size(self, fi);
+    if (size == 0 || (uint32_t)BYTES_LEFT(self) < size) {
+        return;
+    }
+    const uint8_t *frame = READ_PTR(self);
+    uint32_t samples_per_frame = fi->outputSamps / fi->nChans;
+    // The tag follows the side information
+    const uint8_t *tag = frame + 4 + mp3file_side_info_size(fi) + ((frame[1] & 1) ? 0 : 2);
+    if (memcmp(tag, "Xing", 4) != 0 && memcmp(tag, "Info", 4) != 0) {
+        return;
+    }
+    uint32_t flags = read_be32(tag + 4);
+    const uint8_t *p = tag + 8;
+    uint32_t frames = 0;
+    if (flags & 1) {
+        frames = read_be32(p);
+        p += 4;
+    }
+    if (flags & 2) {
+        p += 4; // byte count
+    }
+    if (flags & 4) {
+        p += 100; // table of contents
+    }
+    if (flags & 8) {
+        p += 4; // quality
+    }
+    uint32_t delay = 0, padding = 0;
+    if (p + 24 <= frame + size &&
+        (memcmp(p, "LAME", 4) == 0 || memcmp(p, "Lavc", 4) == 0 || memcmp(p, "Lavf", 4) == 0)) {
+        delay = (p[21] << 4) | (p[22] >> 4);
+        padding = ((p[22] & 0xf) << 8) | p[23];
+    }
+    self->gapless_start = delay + DECODER_DELAY;
+    if (frames) {
+        uint32_t total = frames * samples_per_frame;
+        self->gapless_end = MIN(total, total - MIN(padding, total) + DECODER_DELAY);
+    }
+    CONSUME(self, size);
+}
+
+// Skip any ID3 tag and, in gapless mode, the Info frame, then remember where
+// the first audio frame is.
+static bool mp3file_find_first_frame(audiomp3_mp3file_obj_t *self, MP3FrameInfo *fi, bool block_ok) {
+    mp3file_skip_id3v2(self, block_ok);
+    mp3file_find_sync_word(self, block_ok);
+    if (!mp3file_get_next_frame_info(self, fi, block_ok)) {
+        return false;
+    }
+    if (self->gapless) {
+        mp3file_skip_info_frame(self, fi);
+        mp3file_find_sync_word(self, block_ok);
+    }
+    self->first_frame_offset = FRAME_OFFSET(self);
+    self->frame_index = 0;
+    return true;
+}
+
+// Record the offset of the frame at READ_PTR if it belongs in the seek index
+static void mp3file_index_frame(audiomp3_mp3file_obj_t *self) {
+    if (self->frame_index < 0 || self->seek_index == NULL) {
+        return;
+    }
+    if (self->seek_index_count == SEEK_INDEX_SIZE &&
+        (uint32_t)self->frame_index == (uint32_t)SEEK_INDEX_SIZE * self->seek_stride) {
+        // Full: keep every other entry and double the distance between them
+        for (size_t i = 0; i < SEEK_INDEX_SIZE / 2; i++) {
+            self->seek_index[i] = self->seek_index[2 * i];
+        }
+        self->seek_index_count = SEEK_INDEX_SIZE / 2;
+        self->seek_stride *= 2;
+    }
+    if ((uint32_t)self->frame_index == (uint32_t)self->seek_index_count * self->seek_stride) {
+        self->seek_index[self->seek_index_count++] = FRAME_OFFSET(self);
+    }
+}
+
+// Forget the overlap and filter state left by the last frame decoded, so the
+// first frame comes out the same each time it is decoded
+static void mp3file_reset_decoder(audiomp3_mp3file_obj_t *self) {
+    /* important to do this - DSP primitives assume a bunch of state variables are 0 on first use */
+    struct _MP3DecInfo *decoder = self->decoder;
+    memset(decoder->FrameHeaderPS, 0, sizeof(FrameHeader));
+    memset(decoder->SideInfoPS, 0, sizeof(SideInfo));
+    memset(decoder->ScaleFactorInfoPS, 0, sizeof(ScaleFactorInfo));
+    memset(decoder->HuffmanInfoPS, 0, sizeof(HuffmanInfo));
+    memset(decoder->DequantInfoPS, 0, sizeof(DequantInfo));
+    memset(decoder->IMDCTInfoPS, 0, sizeof(IMDCTInfo));
+    memset(decoder->SubbandInfoPS, 0, sizeof(SubbandInfo));
+}
+
 #define DEFAULT_INPUT_BUFFER_SIZE (2048)
 #define MIN_USER_BUFFER_SIZE (DEFAULT_INPUT_BUFFER_SIZE + 2 * MAX_BUFFER_LEN)
 
 void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
     mp_obj_t stream,
     uint8_t *buffer,
-    size_t buffer_size) {
+    size_t buffer_size,
+    uint32_t cache_ms,
+    bool gapless) {
     // Note: Adafruit_MP3 uses a 2kB input buffer and two 4kB output pcm_buffer.
     // for a whopping total of 10kB pcm_buffer (+mp3 decoder state and frame buffer)
     // At 44kHz, that's 23ms of output audio data.
@@ -330,6 +514,13 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
     }
     self->inbuf.read_off = self->inbuf.write_off = 0;
 
+    self->seek_index = m_malloc_without_collect(SEEK_INDEX_SIZE * sizeof(uint32_t));
+    self->cache = NULL;
+    self->cache_size = 0;
+    self->cache_prime = NULL;
+    self->cache_ms = cache_ms;
+    self->gapless = gapless;
+
     self->decoder = MP3InitDecoder();
     if (self->decoder == NULL) {
         common_hal_audiomp3_mp3file_deinit(self);
@@ -349,12 +540,25 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, mp_obj_t
     INPUT_BUFFER_CLEAR(self->inbuf);
     self->eof = 0;
 
+    // A stream that can't report its position is assumed to be at the start
+    off_t pos = stream_lseek(self->stream, 0, SEEK_CUR);
+    self->stream_pos = MAX(pos, 0);
+    self->first_frame_offset = -1;
+    self->frame_index = -1;
+    self->seek_index_count = 0;
+    self->seek_stride = SEEK_INDEX_STRIDE;
+    self->cache_filled = 0;
+    self->cache_pos = -1;
+    self->cache_resume_frame = -1;
+    self->gapless_start = 0;
+    self->gapless_end = UINT32_MAX;
+
     self->block_ok = false;
     stream_set_blocking(self, true);
 
     self->other_channel = -1;
+    self->current_frame = self->pcm_buffer[0];
     mp3file_update_inbuf_half(self, true);
-    mp3file_find_sync_word(self, true);
     // It **SHOULD** not be necessary to do this; the buffer should be filled
     // with fresh content before it is returned by get_buffer().  The fact that
     // this is necessary to avoid a glitch at the start of playback of a second
@@ -363,18 +567,17 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, mp_obj_t
     memset(self->pcm_buffer[0], 0, MAX_BUFFER_LEN);
     memset(self->pcm_buffer[1], 0, MAX_BUFFER_LEN);
 
-    /* important to do this - DSP primitives assume a bunch of state variables are 0 on first use */
-    struct _MP3DecInfo *decoder = self->decoder;
-    memset(decoder->FrameHeaderPS, 0, sizeof(FrameHeader));
-    memset(decoder->SideInfoPS, 0, sizeof(SideInfo));
-    memset(decoder->ScaleFactorInfoPS, 0, sizeof(ScaleFactorInfo));
-    memset(decoder->HuffmanInfoPS, 0, sizeof(HuffmanInfo));
-    memset(decoder->DequantInfoPS, 0, sizeof(DequantInfo));
-    memset(decoder->IMDCTInfoPS, 0, sizeof(IMDCTInfo));
-    memset(decoder->SubbandInfoPS, 0, sizeof(SubbandInfo));
+    mp3file_reset_decoder(self);
 
     MP3FrameInfo fi;
-    bool result = mp3file_get_next_frame_info(self, &fi, true);
+    bool result;
+    if (pos <= 0) {
+        result = mp3file_find_first_frame(self, &fi, true);
+    } else {
+        // Playing from the middle of the file; the first frame is found on loop
+        mp3file_find_sync_word(self, true);
+        result = mp3file_get_next_frame_info(self, &fi, true);
+    }
     background_callback_allow();
     if (!result) {
         mp_raise_msg(&mp_type_RuntimeError,
@@ -389,6 +592,24 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, mp_obj_t
     self->base.max_buffer_length = fi.outputSamps * sizeof(int16_t);
     self->len = 2 * self->base.max_buffer_length;
     self->samples_decoded = 0;
+    self->samples_per_frame = fi.outputSamps / fi.nChans;
+
+    self->cache_frames = 0;
+    if (self->cache_ms) {
+        uint32_t frames = ((uint64_t)self->cache_ms * fi.samprate / 1000 + self->samples_per_frame - 1) / self->samples_per_frame;
+        size_t size = frames * self->base.max_buffer_length;
+        if (size > self->cache_size) {
+            // Drop the old cache first so it can be collected if this fails
+            self->cache = NULL;
+            self->cache_size = 0;
+            self->cache = m_malloc_without_collect(size);
+            self->cache_size = size;
+        }
+        if (self->cache_prime == NULL) {
+            self->cache_prime = m_malloc_without_collect(MP3FILE_PRIME_FRAMES_MAX * sizeof(mp3file_frame_t));
+        }
+        self->cache_frames = frames;
+    }
 }
 
 void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t *self) {
@@ -400,11 +621,35 @@ void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t *self) {
     self->inbuf.buf = NULL;
     self->pcm_buffer[0] = NULL;
     self->pcm_buffer[1] = NULL;
+    self->current_frame = NULL;
+    self->seek_index = NULL;
+    self->cache = NULL;
+    self->cache_size = 0;
+    self->cache_prime = NULL;
+    self->cache_frames = 0;
     self->stream = mp_const_none;
     self->settimeout_args[0] = MP_OBJ_NULL;
     self->samples_decoded = 0;
 }
 
+// Go back to the first audio frame. Returns false if the stream can't seek.
+static bool mp3file_rewind(audiomp3_mp3file_obj_t *self, bool block_ok) {
+    if (self->first_frame_offset >= 0) {
+        // Already know where the audio starts, so skip the ID3 and sync scan
+        if (mp3file_seek_stream(self, self->first_frame_offset) != 0) {
+            return false;
+        }
+        self->frame_index = 0;
+        return true;
+    }
+    if (mp3file_seek_stream(self, 0) != 0) {
+        return false;
+    }
+    MP3FrameInfo fi;
+    mp3file_find_first_frame(self, &fi, block_ok);
+    return true;
+}
+
 void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t *self,
     bool single_channel_output,
     uint8_t channel) {
@@ -414,64 +659,67 @@ void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t *self,
     // We don't reset the buffer index in case we're looping and we have an odd number of buffer
     // loads
     background_callback_prevent();
-    if (self->eof && stream_lseek(self->stream, SEEK_SET, 0) == 0) {
-        INPUT_BUFFER_CLEAR(self->inbuf);
-        self->eof = 0;
+    if (self->eof) {
+        bool cached = self->cache_frames != 0 && self->cache_resume_frame >= 0;
+        if (cached && mp3file_seek_stream(self, self->cache_resume_offset) == 0) {
+            // Play the start from the cache while the decoder catches up
+            self->frame_index = self->cache_resume_frame;
+            self->cache_pos = 0;
+        } else if (mp3file_rewind(self, false)) {
+            self->cache_pos = -1;
+        } else {
+            background_callback_allow();
+            return;
+        }
+        if (self->frame_index == 0) {
+            mp3file_reset_decoder(self);
+        }
         self->samples_decoded = 0;
         self->other_channel = -1;
-        mp3file_skip_id3v2(self, false);
-        mp3file_find_sync_word(self, false);
     }
     background_callback_allow();
 }
 
-audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *self,
-    bool single_channel_output,
-    uint8_t channel,
-    uint8_t **bufptr,
-    uint32_t *buffer_length) {
-    if (!self->inbuf.buf) {
-        *buffer_length = 0;
-        if (DO_DEBUG) {
-            mp_printf(&mp_plat_print, "%s:%d\n", __FILE__, __LINE__);
-        }
-        return GET_BUFFER_ERROR;
-    }
-    if (!single_channel_output) {
-        channel = 0;
-    }
-
+/** Decode the next frame of the stream into `buffer`.
+ *
+ * Keeps the seek index and the cache up to date. On an error the buffer is
+ * filled with silence.
+ */
+static audioio_get_buffer_result_t mp3file_decode_frame(audiomp3_mp3file_obj_t *self, int16_t *buffer, bool block_ok) {
     size_t frame_buffer_size_bytes = self->base.max_buffer_length;
-    *buffer_length = frame_buffer_size_bytes;
 
-    if (channel == self->other_channel) {
-        *bufptr = (uint8_t *)(self->pcm_buffer[self->other_buffer_index] + channel);
-        self->other_channel = -1;
-        self->samples_decoded += *buffer_length / sizeof(int16_t);
-        if (DO_DEBUG) {
-            mp_printf(&mp_plat_print, "%s:%d\n", __FILE__, __LINE__);
-        }
-        return GET_BUFFER_MORE_DATA;
+    mp3file_skip_id3v2(self, block_ok);
+    if (!mp3file_find_sync_word(self, block_ok)) {
+        memset(buffer, 0, frame_buffer_size_bytes);
+        return self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
     }
 
-
-    self->buffer_index = !self->buffer_index;
-    self->other_channel = 1 - channel;
-    self->other_buffer_index = self->buffer_index;
-    int16_t *buffer = (int16_t *)(void *)self->pcm_buffer[self->buffer_index];
-    *bufptr = (uint8_t *)buffer;
-
-    mp3file_skip_id3v2(self, false);
-    if (!mp3file_find_sync_word(self, false)) {
-        memset(buffer, 0, self->base.max_buffer_length);
-        *buffer_length = 0;
-        return self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
+    int32_t frame_index = self->frame_index;
+    mp3file_index_frame(self);
+    if (self->cache_frames != 0 && frame_index == self->cache_filled &&
+        frame_index + MP3FILE_PRIME_FRAMES_MAX > self->cache_frames) {
+        // Playing in order from the start, near the end of the cache: note
+        // the frames that the one after the cache depends on
+        MP3FrameInfo fi;
+        if (MP3GetNextFrameInfo(self->decoder, &fi, READ_PTR(self)) == ERR_MP3_NONE) {
+            mp3file_note_frame(self, self->cache_prime, frame_index, &fi);
+            if (frame_index == self->cache_frames) {
+                int32_t first = MAX(0, frame_index - (MP3FILE_PRIME_FRAMES_MAX - 1));
+                int32_t start = mp3file_prime_start(self->cache_prime, first, frame_index);
+                self->cache_resume_frame = start;
+                self->cache_resume_offset = self->cache_prime[start % MP3FILE_PRIME_FRAMES_MAX].offset;
+            }
+        }
     }
+
     int bytes_left = BYTES_LEFT(self);
     uint8_t *inbuf = READ_PTR(self);
     int err = MP3Decode(self->decoder, &inbuf, &bytes_left, buffer, 0);
     if (err != ERR_MP3_INDATA_UNDERFLOW) {
         CONSUME(self, BYTES_LEFT(self) - bytes_left);
+        if (frame_index >= 0) {
+            self->frame_index++;
+        }
     }
     if (err) {
         memset(buffer, 0, frame_buffer_size_bytes);
@@ -479,17 +727,20 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
             mp_printf(&mp_plat_print, "%s:%d err=%d\n", __FILE__, __LINE__, err);
         }
         if (self->eof || (err != ERR_MP3_INDATA_UNDERFLOW && err != ERR_MP3_MAINDATA_UNDERFLOW)) {
-            memset(buffer, 0, self->base.max_buffer_length);
-            *buffer_length = 0;
             self->eof = true;
             return GET_BUFFER_ERROR;
         }
     }
 
-    self->samples_decoded += frame_buffer_size_bytes / sizeof(int16_t);
+    // Frames played in order from the start are kept for the next loop
+    if (err != ERR_MP3_INDATA_UNDERFLOW && self->cache_frames != 0 &&
+        frame_index == self->cache_filled && self->cache_filled < self->cache_frames) {
+        memcpy(self->cache + self->cache_filled * (frame_buffer_size_bytes / sizeof(int16_t)), buffer, frame_buffer_size_bytes);
+        self->cache_filled++;
+    }
 
-    mp3file_skip_id3v2(self, false);
-    int result = mp3file_find_sync_word(self, false) ? GET_BUFFER_MORE_DATA : GET_BUFFER_DONE;
+    mp3file_skip_id3v2(self, block_ok);
+    int result = mp3file_find_sync_word(self, block_ok) ? GET_BUFFER_MORE_DATA : GET_BUFFER_DONE;
 
     if (DO_DEBUG) {
         mp_printf(&mp_plat_print, "%s:%d result=%d\n", __FILE__, __LINE__, result);
@@ -507,10 +758,217 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
     return result;
 }
 
+// Get the next frame to play, from the cache or from the stream. Sets
+// `*index` to the frame's index, or -1 if it is unknown, and `*frame` to
+// NULL if there was no frame.
+static audioio_get_buffer_result_t mp3file_next_frame(audiomp3_mp3file_obj_t *self, int16_t **frame, int32_t *index) {
+    if (self->cache_pos >= 0) {
+        *index = self->cache_pos;
+        *frame = self->cache + self->cache_pos * (self->base.max_buffer_length / sizeof(int16_t));
+        if (self->cache_pos >= self->cache_resume_frame) {
+            // The frame after the cache depends on the ones before it
+            mp3file_decode_frame(self, self->pcm_buffer[!self->buffer_index], false);
+        }
+        if (++self->cache_pos == self->cache_frames) {
+            self->cache_pos = -1;
+        }
+        return GET_BUFFER_MORE_DATA;
+    }
+
+    mp3file_skip_id3v2(self, false);
+    if (!mp3file_find_sync_word(self, false)) {
+        *frame = NULL;
+        return self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
+    }
+    self->buffer_index = !self->buffer_index;
+    *index = self->frame_index;
+    *frame = self->pcm_buffer[self->buffer_index];
+    return mp3file_decode_frame(self, *frame, false);
+}
+
+audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **bufptr,
+    uint32_t *buffer_length) {
+    if (!self->inbuf.buf) {
+        *buffer_length = 0;
+        if (DO_DEBUG) {
+            mp_printf(&mp_plat_print, "%s:%d\n", __FILE__, __LINE__);
+        }
+        return GET_BUFFER_ERROR;
+    }
+    if (!single_channel_output) {
+        channel = 0;
+    }
+
+    if (channel == self->other_channel) {
+        *bufptr = (uint8_t *)(self->other_buffer + channel);
+        *buffer_length = self->other_length;
+        self->other_channel = -1;
+        self->samples_decoded += *buffer_length / sizeof(int16_t);
+        if (DO_DEBUG) {
+            mp_printf(&mp_plat_print, "%s:%d\n", __FILE__, __LINE__);
+        }
+        return GET_BUFFER_MORE_DATA;
+    }
+
+    uint32_t samples_per_frame = self->samples_per_frame;
+    int16_t *frame;
+    int32_t index;
+    uint32_t first, last;
+    audioio_get_buffer_result_t result;
+    do {
+        result = mp3file_next_frame(self, &frame, &index);
+        if (result == GET_BUFFER_ERROR || frame == NULL) {
+            *buffer_length = 0;
+            return result;
+        }
+        first = 0;
+        last = samples_per_frame;
+        if (self->gapless && index >= 0) {
+            // Only play the part of the frame between the encoder delay and padding
+            uint32_t start = index * samples_per_frame;
+            first = MIN(samples_per_frame, start < self->gapless_start ? self->gapless_start - start : 0);
+            last = MIN(samples_per_frame, start < self->gapless_end ? self->gapless_end - start : 0);
+            last = MAX(first, last);
+            if (start + samples_per_frame >= self->gapless_end) {
+                self->eof = true;
+                result = GET_BUFFER_DONE;
+            }
+        }
+    } while (first == last && result == GET_BUFFER_MORE_DATA);
+
+    uint8_t channel_count = self->base.channel_count;
+    int16_t *buffer = frame + first * channel_count;
+    self->current_frame = frame;
+    self->other_channel = 1 - channel;
+    self->other_buffer = buffer;
+    self->other_length = (last - first) * channel_count * sizeof(int16_t);
+
+    *bufptr = (uint8_t *)(buffer + channel);
+    *buffer_length = self->other_length;
+    self->samples_decoded += *buffer_length / sizeof(int16_t);
+    return result;
+}
+
+void common_hal_audiomp3_mp3file_seek(audiomp3_mp3file_obj_t *self, uint32_t position) {
+    background_callback_prevent();
+    int err = 0;
+    if (self->first_frame_offset < 0) {
+        err = mp3file_seek_stream(self, 0);
+        if (err == 0) {
+            MP3FrameInfo fi;
+            mp3file_find_first_frame(self, &fi, true);
+        }
+    }
+    if (err == 0 && self->first_frame_offset < 0) {
+        err = MP_EINVAL;
+    }
+    if (err != 0) {
+        background_callback_allow();
+        mp_raise_OSError(err);
+    }
+
+    uint32_t samples_per_frame = self->samples_per_frame;
+    uint8_t channel_count = self->base.channel_count;
+    uint32_t sample = position / channel_count;
+    if (self->gapless) {
+        sample += self->gapless_start;
+    }
+    int32_t target = sample / samples_per_frame;
+
+    // Start from the nearest indexed frame at or before the earliest one that
+    // might have to be decoded first
+    int32_t first = MAX(0, target - (MP3FILE_PRIME_FRAMES_MAX - 1));
+    uint32_t offset = self->first_frame_offset;
+    int32_t frame_index = 0;
+    if (self->seek_index_count) {
+        uint32_t entry = MIN((uint32_t)first / self->seek_stride, self->seek_index_count - 1u);
+        offset = self->seek_index[entry];
+        frame_index = entry * self->seek_stride;
+    }
+    err = mp3file_seek_stream(self, offset);
+    if (err != 0) {
+        background_callback_allow();
+        mp_raise_OSError(err);
+    }
+    self->frame_index = frame_index;
+
+    // Walk the frame headers up to the target, noting the frames before it
+    mp3file_frame_t frames[MP3FILE_PRIME_FRAMES_MAX];
+    int16_t *scratch = self->pcm_buffer[!self->buffer_index];
+    while (self->frame_index <= target && mp3file_find_sync_word(self, true)) {
+        MP3FrameInfo fi;
+        if (MP3GetNextFrameInfo(self->decoder, &fi, READ_PTR(self)) != ERR_MP3_NONE) {
+            CONSUME(self, 1);
+            continue;
+        }
+        if (self->frame_index >= first) {
+            mp3file_note_frame(self, frames, self->frame_index, &fi);
+        }
+        if (self->frame_index == target) {
+            break;
+        }
+        uint32_t size = mp3file_frame_size(self, &fi);
+        if (size == 0) {
+            // Free format frames have to be decoded to find their end
+            if (mp3file_decode_frame(self, scratch, true) != GET_BUFFER_MORE_DATA) {
+                break;
+            }
+            continue;
+        }
+        mp3file_index_frame(self);
+        while (size > 0) {
+            uint32_t to_consume = MIN(size, (uint32_t)BYTES_LEFT(self));
+            CONSUME(self, to_consume);
+            size -= to_consume;
+            if (size > 0 && !mp3file_update_inbuf_always(self, true)) {
+                break;
+            }
+        }
+        self->frame_index++;
+    }
+
+    // Go back to the first frame the target depends on, unless the stream
+    // ended before the target
+    if (self->frame_index == target) {
+        int32_t start = mp3file_prime_start(frames, first, target);
+        if (start < target) {
+            err = mp3file_seek_stream(self, frames[start % MP3FILE_PRIME_FRAMES_MAX].offset);
+            if (err != 0) {
+                background_callback_allow();
+                mp_raise_OSError(err);
+            }
+            self->frame_index = start;
+        }
+        if (start == 0) {
+            mp3file_reset_decoder(self);
+        }
+    }
+
+    // Decode the frames just before the target so that it plays cleanly
+    while (self->frame_index < target) {
+        int32_t before = self->frame_index;
+        if (mp3file_decode_frame(self, scratch, true) != GET_BUFFER_MORE_DATA || self->frame_index == before) {
+            break;
+        }
+    }
+
+    self->cache_pos = -1;
+    self->other_channel = -1;
+    uint32_t decoded = self->frame_index * samples_per_frame;
+    if (self->gapless) {
+        decoded -= MIN(decoded, self->gapless_start);
+    }
+    self->samples_decoded = decoded * channel_count;
+    background_callback_allow();
+}
+
 float common_hal_audiomp3_mp3file_get_rms_level(audiomp3_mp3file_obj_t *self) {
     float sumsq = 0.f;
     // Assumes no DC component to the audio.  Is that a safe assumption?
-    int16_t *buffer = (int16_t *)(void *)self->pcm_buffer[self->buffer_index];
+    int16_t *buffer = self->current_frame;
     for (size_t i = 0; i < self->base.max_buffer_length / sizeof(int16_t); i++) {
         sumsq += (float)buffer[i] * buffer[i];
     }
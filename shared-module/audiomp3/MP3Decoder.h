@@ -20,6 +20,20 @@ typedef struct {
     mp_int_t write_off;
 } mp3_input_buffer_t;
 
+// Most frames decoded and discarded before a frame played after a seek or a
+// loop from the cache
+#define MP3FILE_PRIME_FRAMES_MAX (16)
+
+// Where a frame is and how it uses the bit reservoir, for working out how far
+// back decoding has to start for a frame to come out right
+typedef struct {
+    uint32_t offset;
+    // Bytes of main data in the frame, and how far back into the main data of
+    // earlier frames its own starts
+    uint16_t main_data_size;
+    uint16_t main_data_begin;
+} mp3file_frame_t;
+
 typedef struct {
     audiosample_base_t base;
     struct _MP3DecInfo *decoder;
@@ -36,9 +50,44 @@ typedef struct {
     mp_obj_t settimeout_args[3];
 
     int8_t other_channel;
-    int8_t other_buffer_index;
+    int16_t *other_buffer;
+    uint32_t other_length;
+    int16_t *current_frame;
 
     uint32_t samples_decoded;
+
+    // Stream offset of the byte after the last one read into inbuf
+    uint32_t stream_pos;
+    // Stream offset of the first audio frame, or -1 if not yet known
+    int32_t first_frame_offset;
+
+    // Index of the next frame to be decoded, counted from the first audio
+    // frame, or -1 when playback didn't start at a known frame
+    int32_t frame_index;
+    uint16_t samples_per_frame;
+
+    // Stream offsets of every seek_stride'th frame, built while decoding
+    uint32_t *seek_index;
+    uint16_t seek_index_count;
+    uint16_t seek_stride;
+
+    // Decoded copy of the first cache_frames frames, served on loop
+    int16_t *cache;
+    size_t cache_size;
+    uint32_t cache_ms;
+    uint16_t cache_frames;
+    uint16_t cache_filled;
+    int32_t cache_pos;
+    // The frames before the one after the cache, and the first of them that
+    // is decoded again while the cache plays, or -1 if not yet known
+    mp3file_frame_t *cache_prime;
+    int32_t cache_resume_frame;
+    uint32_t cache_resume_offset;
+
+    // Encoder delay and padding from a LAME/Info header, in samples per channel
+    bool gapless;
+    uint32_t gapless_start;
+    uint32_t gapless_end;
 } audiomp3_mp3file_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
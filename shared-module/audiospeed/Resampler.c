@@ -12,10 +12,11 @@ static void calculate_rate(audiospeed_base_t *self, uint32_t sample_rate) {
     } else {
         audiospeed_set_rate(&self->speed, mp_const_none);
     }
+    audiospeed_rate_changed(self);
 }
 
-void common_hal_audiospeed_resampler_construct(audiospeed_resampler_obj_t *self, mp_obj_t source) {
-    audiospeed_construct(&self->base, source, mp_const_none); // default rate 1.0
+void common_hal_audiospeed_resampler_construct(audiospeed_resampler_obj_t *self, mp_obj_t source, audiospeed_quality_t quality) {
+    audiospeed_construct(&self->base, source, mp_const_none, quality); // default rate 1.0
     self->sample_rate = 0;
 }
 
@@ -27,6 +28,14 @@ mp_obj_t common_hal_audiospeed_resampler_get_rate(audiospeed_resampler_obj_t *se
     return audiospeed_get_rate(&self->base.speed);
 }
 
+audiospeed_quality_t common_hal_audiospeed_resampler_get_quality(audiospeed_resampler_obj_t *self) {
+    return self->base.quality;
+}
+
+void common_hal_audiospeed_resampler_set_quality(audiospeed_resampler_obj_t *self, audiospeed_quality_t quality) {
+    audiospeed_set_quality(&self->base, quality);
+}
+
 void audiospeed_resampler_set_sample_rate(audiospeed_resampler_obj_t *self, uint32_t sample_rate) {
     self->sample_rate = sample_rate;
     calculate_rate(&self->base, self->sample_rate);
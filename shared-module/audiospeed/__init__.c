@@ -4,7 +4,9 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <math.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "py/gc.h"
 #include "py/objproperty.h"
@@ -14,10 +16,13 @@
 #include "shared-module/audiospeed/__init__.h"
 #include "shared-bindings/audiocore/__init__.h"
 
+#define MP_PI MICROPY_FLOAT_CONST(3.14159265358979323846)
+
 // Convert a Python float to 16.16 fixed-point rate
 uint32_t audiospeed_rate_to_fp(mp_obj_t rate_obj) {
-    mp_float_t rate = mp_arg_validate_obj_float_range(rate_obj, 0.001, 1000.0, MP_QSTR_rate);
-    return (uint32_t)(rate * (1 << SPEED_SHIFT));
+    mp_float_t rate = mp_arg_validate_obj_float_range(rate_obj, 0, 1000, MP_QSTR_rate);
+    // The slowest representable rate is 1/65536
+    return MAX(1, (uint32_t)(rate * (1 << SPEED_SHIFT)));
 }
 
 // Convert 16.16 fixed-point rate to Python float
@@ -25,7 +30,7 @@ mp_obj_t audiospeed_fp_to_rate(uint32_t rate_fp) {
     return mp_obj_new_float((mp_float_t)rate_fp / (1 << SPEED_SHIFT));
 }
 
-void audiospeed_construct(audiospeed_base_t *self, mp_obj_t source, mp_obj_t rate_obj) {
+void audiospeed_construct(audiospeed_base_t *self, mp_obj_t source, mp_obj_t rate_obj, audiospeed_quality_t quality) {
     audiosample_base_t *src_base = audiosample_check(source);
 
     self->source = source;
@@ -34,7 +39,10 @@ void audiospeed_construct(audiospeed_base_t *self, mp_obj_t source, mp_obj_t rat
     self->src_sample_count = 0;
     self->source_done = false;
     self->source_exhausted = false;
-
+    self->quality = AUDIOSPEED_QUALITY_NEAREST;
+    self->window = NULL;
+    self->sinc_table = NULL;
+    self->sinc_rate_fp = 0;
 
     // Copy format from source
     self->base.sample_rate = src_base->sample_rate;
@@ -50,9 +58,93 @@ void audiospeed_construct(audiospeed_base_t *self, mp_obj_t source, mp_obj_t rat
     self->output_buffer_length = OUTPUT_BUFFER_FRAMES * bytes_per_frame;
     self->base.max_buffer_length = self->output_buffer_length;
 
-    self->output_buffer = m_malloc_without_collect(self->output_buffer_length);
+    // Interpolated frames are computed as 16 bits and then narrowed in place
+    size_t output_buffer_size = OUTPUT_BUFFER_FRAMES * src_base->channel_count * sizeof(int16_t);
+    self->output_buffer = m_malloc_without_collect(output_buffer_size);
     if (self->output_buffer == NULL) {
-        m_malloc_fail(self->output_buffer_length);
+        m_malloc_fail(output_buffer_size);
+    }
+
+    audiospeed_set_quality(self, quality);
+}
+
+static void window_reset(audiospeed_base_t *self) {
+    // Start with silent history so the first output frame is the first source frame
+    memset(self->window, 0, self->base.channel_count * AUDIOSPEED_WINDOW_FRAMES * sizeof(int16_t));
+    self->window_frames = AUDIOSPEED_HISTORY;
+    self->speed.phase = AUDIOSPEED_HISTORY << SPEED_SHIFT;
+    self->src_skip = 0;
+    self->tail_padded = false;
+}
+
+// Blackman window over |x| < AUDIOSPEED_SINC_TAPS / 2
+static mp_float_t sinc_window(mp_float_t x) {
+    mp_float_t a = MP_PI * x / (AUDIOSPEED_SINC_TAPS / 2);
+    return MICROPY_FLOAT_CONST(0.42) + MICROPY_FLOAT_CONST(0.5) * MICROPY_FLOAT_C_FUN(cos)(a)
+           + MICROPY_FLOAT_CONST(0.08) * MICROPY_FLOAT_C_FUN(cos)(2 * a);
+}
+
+static void update_sinc_table(audiospeed_base_t *self) {
+    // Only downsampling moves the cutoff, so all upsampling rates share a table
+    uint32_t rate_fp = MAX(self->speed.rate_fp, SPEED_DEFAULT);
+    if (self->sinc_table == NULL) {
+        self->sinc_table = m_malloc_without_collect(AUDIOSPEED_SINC_PHASES * AUDIOSPEED_SINC_TAPS * sizeof(int16_t));
+    } else if (self->sinc_rate_fp == rate_fp) {
+        return;
+    }
+    self->sinc_rate_fp = rate_fp;
+
+    // Leave a transition band below the output Nyquist frequency
+    mp_float_t cutoff = MICROPY_FLOAT_CONST(0.9) * SPEED_DEFAULT / rate_fp;
+    for (int phase = 0; phase < AUDIOSPEED_SINC_PHASES; phase++) {
+        mp_float_t frac = (mp_float_t)phase / AUDIOSPEED_SINC_PHASES;
+        mp_float_t taps[AUDIOSPEED_SINC_TAPS];
+        mp_float_t sum = 0;
+        for (int t = 0; t < AUDIOSPEED_SINC_TAPS; t++) {
+            mp_float_t x = t - AUDIOSPEED_HISTORY - frac;
+            mp_float_t y = MP_PI * cutoff * x;
+            mp_float_t sinc = y == 0 ? 1 : MICROPY_FLOAT_C_FUN(sin)(y) / y;
+            taps[t] = sinc * sinc_window(x);
+            sum += taps[t];
+        }
+        // Normalize each phase to unity gain, putting the rounding error on the
+        // largest tap so that a constant input stays exactly constant
+        int16_t *row = self->sinc_table + phase * AUDIOSPEED_SINC_TAPS;
+        int32_t total = 0;
+        for (int t = 0; t < AUDIOSPEED_SINC_TAPS; t++) {
+            row[t] = (int16_t)MICROPY_FLOAT_C_FUN(floor)(taps[t] / sum * 32768 + MICROPY_FLOAT_CONST(0.5));
+            total += row[t];
+        }
+        int centre = frac < MICROPY_FLOAT_CONST(0.5) ? AUDIOSPEED_HISTORY : AUDIOSPEED_HISTORY + 1;
+        row[centre] += 32768 - total;
+    }
+}
+
+void audiospeed_rate_changed(audiospeed_base_t *self) {
+    if (self->quality == AUDIOSPEED_QUALITY_SINC) {
+        update_sinc_table(self);
+    }
+}
+
+void audiospeed_set_quality(audiospeed_base_t *self, audiospeed_quality_t quality) {
+    if (quality != AUDIOSPEED_QUALITY_NEAREST && self->window == NULL) {
+        self->window = m_malloc_without_collect(self->base.channel_count * AUDIOSPEED_WINDOW_FRAMES * sizeof(int16_t));
+    }
+    bool was_nearest = self->quality == AUDIOSPEED_QUALITY_NEAREST;
+    self->quality = quality;
+    audiospeed_rate_changed(self);
+
+    // Continue from the current source frame
+    if (quality == AUDIOSPEED_QUALITY_NEAREST) {
+        if (!was_nearest) {
+            // The end of the window holds the frames just before src_index
+            int32_t index = self->src_index - self->window_frames + audiospeed_get_index(&self->speed);
+            uint32_t fraction = self->speed.phase & ((1 << SPEED_SHIFT) - 1);
+            self->speed.phase = index >= 0 ? ((uint32_t)index << SPEED_SHIFT) | fraction : 0;
+        }
+    } else if (was_nearest) {
+        self->src_index = self->src_buffer == NULL ? 0 : MIN(audiospeed_get_index(&self->speed), self->src_sample_count);
+        window_reset(self);
     }
 }
 
@@ -83,8 +175,7 @@ bool audiospeed_fetch_source_buffer(audiospeed_base_t *self) {
     uint8_t bytes_per_frame = (self->base.bits_per_sample / 8) * self->base.channel_count;
     self->src_sample_count = len / bytes_per_frame;
     self->source_done = (result == GET_BUFFER_DONE);
-    // Reset phase to index within this new buffer
-    audiospeed_reset_phase(&self->speed);
+    self->src_index = 0;
     return true;
 }
 
@@ -99,11 +190,208 @@ void audiospeed_reset_buffer(audiospeed_base_t *self, bool single_channel_output
     self->src_sample_count = 0;
     self->source_done = false;
     self->source_exhausted = false;
+    if (self->quality != AUDIOSPEED_QUALITY_NEAREST) {
+        window_reset(self);
+    }
+}
+
+// Copy source frames into the window as int16, until it is full or the source ends
+static void window_fill(audiospeed_base_t *self) {
+    uint8_t channels = self->base.channel_count;
+    uint8_t bytes_per_sample = self->base.bits_per_sample / 8;
+    uint8_t bytes_per_frame = bytes_per_sample * channels;
+    while (self->window_frames < AUDIOSPEED_WINDOW_FRAMES) {
+        if (self->src_buffer == NULL || self->src_index >= self->src_sample_count) {
+            if (self->source_done) {
+                self->source_exhausted = true;
+                return;
+            }
+            if (!audiospeed_fetch_source_buffer(self)) {
+                return;
+            }
+        }
+        uint32_t n = self->src_sample_count - self->src_index;
+        if (self->src_skip) {
+            n = MIN(n, self->src_skip);
+            self->src_index += n;
+            self->src_skip -= n;
+            continue;
+        }
+        n = MIN(n, AUDIOSPEED_WINDOW_FRAMES - self->window_frames);
+        const uint8_t *src = self->src_buffer + self->src_index * bytes_per_frame;
+        for (uint8_t c = 0; c < channels; c++) {
+            int16_t *out = self->window + c * AUDIOSPEED_WINDOW_FRAMES + self->window_frames;
+            if (bytes_per_sample == 2) {
+                const int16_t *in = (const int16_t *)(const void *)src + c;
+                uint16_t flip = self->base.samples_signed ? 0 : 0x8000;
+                for (uint32_t i = 0; i < n; i++, in += channels) {
+                    out[i] = *in ^ flip;
+                }
+            } else {
+                const uint8_t *in = src + c;
+                uint8_t flip = self->base.samples_signed ? 0 : 0x80;
+                for (uint32_t i = 0; i < n; i++, in += channels) {
+                    out[i] = (int8_t)(*in ^ flip) * 256;
+                }
+            }
+        }
+        self->window_frames += n;
+        self->src_index += n;
+    }
+}
+
+// Drop the frames that are no longer needed as history from the window
+static void window_shift(audiospeed_base_t *self) {
+    uint32_t drop = audiospeed_get_index(&self->speed) - AUDIOSPEED_HISTORY;
+    if (drop == 0) {
+        return;
+    }
+    self->speed.phase -= drop << SPEED_SHIFT;
+    if (drop > self->window_frames) {
+        // A high rate stepped past the end of the window
+        self->src_skip += drop - self->window_frames;
+        drop = self->window_frames;
+    }
+    uint32_t keep = self->window_frames - drop;
+    for (uint8_t c = 0; c < self->base.channel_count; c++) {
+        int16_t *w = self->window + c * AUDIOSPEED_WINDOW_FRAMES;
+        memmove(w, w + drop, keep * sizeof(int16_t));
+    }
+    self->window_frames = keep;
+}
+
+static inline __attribute__((always_inline)) void resample_frames(audiospeed_base_t *self, int16_t *out, uint32_t frames,
+    const audiospeed_quality_t quality, const uint8_t channels) {
+    uint32_t phase = self->speed.phase;
+    uint32_t rate = self->speed.rate_fp;
+    for (uint32_t i = 0; i < frames; i++) {
+        uint32_t index = phase >> SPEED_SHIFT;
+        // 15 bit fraction of the way from index to index + 1
+        int32_t frac = (phase & ((1 << SPEED_SHIFT) - 1)) >> (SPEED_SHIFT - 15);
+        for (uint8_t c = 0; c < channels; c++) {
+            const int16_t *s = self->window + c * AUDIOSPEED_WINDOW_FRAMES + index;
+            int32_t w0 = s[0];
+            int32_t w1 = s[1];
+            if (quality == AUDIOSPEED_QUALITY_LINEAR) {
+                *out++ = w0 + (((w1 - w0) * frac) >> 15);
+            } else if (quality == AUDIOSPEED_QUALITY_CUBIC) {
+                // Catmull-Rom cubic through the two samples on either side
+                int32_t w_1 = s[-1];
+                int32_t w2 = s[2];
+                int32_t c1 = (w1 - w_1) / 2;
+                int32_t c2 = w_1 - (5 * w0) / 2 + 2 * w1 - w2 / 2;
+                int32_t c3 = (w2 - w_1) / 2 + (3 * (w0 - w1)) / 2;
+                int64_t result = ((int64_t)c3 * frac) >> 15;
+                result = ((result + c2) * frac) >> 15;
+                result = ((result + c1) * frac) >> 15;
+                result += w0;
+                *out++ = MIN(32767, MAX(-32768, result));
+            } else {
+                uint32_t sinc_phase = (frac >> (15 - AUDIOSPEED_SINC_PHASE_BITS));
+                const int16_t *sinc = self->sinc_table + sinc_phase * AUDIOSPEED_SINC_TAPS;
+                s -= AUDIOSPEED_HISTORY;
+                int32_t acc = 1 << 14;
+                for (int t = 0; t < AUDIOSPEED_SINC_TAPS; t++) {
+                    acc += sinc[t] * s[t];
+                }
+                acc >>= 15;
+                *out++ = MIN(32767, MAX(-32768, acc));
+            }
+        }
+        phase += rate;
+    }
+    self->speed.phase = phase;
+}
+
+typedef void (*resample_kernel_fun)(audiospeed_base_t *self, int16_t *out, uint32_t frames);
+
+#define RESAMPLE_KERNEL(name, quality, channels) \
+    static void name(audiospeed_base_t *self, int16_t *out, uint32_t frames) { \
+        resample_frames(self, out, frames, quality, channels); \
+    }
+
+RESAMPLE_KERNEL(resample_linear_mono, AUDIOSPEED_QUALITY_LINEAR, 1)
+RESAMPLE_KERNEL(resample_linear_stereo, AUDIOSPEED_QUALITY_LINEAR, 2)
+RESAMPLE_KERNEL(resample_cubic_mono, AUDIOSPEED_QUALITY_CUBIC, 1)
+RESAMPLE_KERNEL(resample_cubic_stereo, AUDIOSPEED_QUALITY_CUBIC, 2)
+RESAMPLE_KERNEL(resample_sinc_mono, AUDIOSPEED_QUALITY_SINC, 1)
+RESAMPLE_KERNEL(resample_sinc_stereo, AUDIOSPEED_QUALITY_SINC, 2)
+
+// Indexed by [quality - 1][channel_count - 1]
+static const resample_kernel_fun resample_kernels[3][2] = {
+    { resample_linear_mono, resample_linear_stereo },
+    { resample_cubic_mono, resample_cubic_stereo },
+    { resample_sinc_mono, resample_sinc_stereo },
+};
+
+static audioio_get_buffer_result_t get_buffer_interpolated(audiospeed_base_t *self, uint8_t **buffer, uint32_t *buffer_length) {
+    uint8_t channels = self->base.channel_count;
+    resample_kernel_fun kernel = resample_kernels[self->quality - 1][channels - 1];
+    int16_t *out = (int16_t *)(void *)self->output_buffer;
+    uint32_t out_frames = 0;
+    bool done = false;
+
+    while (out_frames < OUTPUT_BUFFER_FRAMES) {
+        if (self->window_frames > AUDIOSPEED_LOOKAHEAD) {
+            // Every position before end has all its taps in the window
+            uint32_t end = (self->window_frames - AUDIOSPEED_LOOKAHEAD) << SPEED_SHIFT;
+            if (self->speed.phase < end) {
+                uint32_t n = (end - self->speed.phase - 1) / self->speed.rate_fp + 1;
+                n = MIN(n, OUTPUT_BUFFER_FRAMES - out_frames);
+                kernel(self, out + out_frames * channels, n);
+                out_frames += n;
+                continue;
+            }
+        }
+
+        window_shift(self);
+        uint32_t available = self->window_frames;
+        if (!self->source_exhausted) {
+            window_fill(self);
+        }
+        if (self->window_frames != available) {
+            continue;
+        }
+        if (self->tail_padded || self->src_skip) {
+            done = true;
+            break;
+        }
+        // Pad with silence so the last source frames can be played too
+        for (uint8_t c = 0; c < channels; c++) {
+            memset(self->window + c * AUDIOSPEED_WINDOW_FRAMES + self->window_frames, 0, AUDIOSPEED_LOOKAHEAD * sizeof(int16_t));
+        }
+        self->window_frames += AUDIOSPEED_LOOKAHEAD;
+        self->tail_padded = true;
+    }
+
+    // Convert to the source format in place
+    uint32_t n_samples = out_frames * channels;
+    if (self->base.bits_per_sample == 16) {
+        if (!self->base.samples_signed) {
+            for (uint32_t i = 0; i < n_samples; i++) {
+                out[i] ^= 0x8000;
+            }
+        }
+    } else {
+        uint8_t flip = self->base.samples_signed ? 0 : 0x80;
+        uint8_t *out8 = self->output_buffer;
+        for (uint32_t i = 0; i < n_samples; i++) {
+            out8[i] = (out[i] >> 8) ^ flip;
+        }
+    }
+
+    *buffer = self->output_buffer;
+    *buffer_length = n_samples * (self->base.bits_per_sample / 8);
+    return done ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
 }
 
 audioio_get_buffer_result_t audiospeed_get_buffer(audiospeed_base_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
+    if (self->quality != AUDIOSPEED_QUALITY_NEAREST) {
+        return get_buffer_interpolated(self, buffer, buffer_length);
+    }
+
     // Ensure we have a source buffer
     if (self->src_buffer == NULL) {
         if (!audiospeed_fetch_source_buffer(self)) {
@@ -111,6 +399,7 @@ audioio_get_buffer_result_t audiospeed_get_buffer(audiospeed_base_t *self, bool
             *buffer_length = 0;
             return GET_BUFFER_DONE;
         }
+        audiospeed_reset_phase(&self->speed);
     }
 
     uint8_t bytes_per_sample = self->base.bits_per_sample / 8;
@@ -133,7 +422,9 @@ audioio_get_buffer_result_t audiospeed_get_buffer(audiospeed_base_t *self, bool
                 if (!audiospeed_fetch_source_buffer(self)) {
                     break;
                 }
-                src_index = 0; // phase was reset by fetch
+                // Restart the phase at the new buffer's first frame
+                audiospeed_reset_phase(&self->speed);
+                src_index = 0;
             }
             uint8_t *src = self->src_buffer + src_index * bytes_per_frame;
             for (uint8_t c = 0; c < channels; c++) {
@@ -155,6 +446,7 @@ audioio_get_buffer_result_t audiospeed_get_buffer(audiospeed_base_t *self, bool
                 if (!audiospeed_fetch_source_buffer(self)) {
                     break;
                 }
+                audiospeed_reset_phase(&self->speed);
                 src_index = 0;
             }
             int16_t *src = (int16_t *)(self->src_buffer + src_index * bytes_per_frame);
@@ -9,6 +9,7 @@
 #include <stdint.h>
 
 #include "py/objproperty.h"
+#include "shared-bindings/audiospeed/__init__.h"
 #include "shared-module/audiocore/__init__.h"
 
 // Fixed-point 16.16 format
@@ -50,11 +51,24 @@ static inline uint32_t audiospeed_get_index(audiospeed_speed_t *self) {
 
 #define OUTPUT_BUFFER_FRAMES 128
 
+// Interpolating qualities copy the source into a per-channel window of int16
+// frames. The output position is kept at least AUDIOSPEED_HISTORY frames into
+// the window, and AUDIOSPEED_LOOKAHEAD frames must follow it, which is enough
+// for the widest (8 tap) sinc kernel.
+#define AUDIOSPEED_WINDOW_FRAMES 256
+#define AUDIOSPEED_HISTORY 3
+#define AUDIOSPEED_LOOKAHEAD 4
+
+// Polyphase windowed-sinc coefficient table, in Q15
+#define AUDIOSPEED_SINC_PHASE_BITS 6
+#define AUDIOSPEED_SINC_PHASES (1 << AUDIOSPEED_SINC_PHASE_BITS)
+#define AUDIOSPEED_SINC_TAPS (AUDIOSPEED_HISTORY + AUDIOSPEED_LOOKAHEAD + 1)
+
 typedef struct {
     audiosample_base_t base;
     mp_obj_t source;
-    uint8_t *output_buffer;
-    uint32_t output_buffer_length; // in bytes, allocated size
+    uint8_t *output_buffer; // room for OUTPUT_BUFFER_FRAMES 16-bit frames
+    uint32_t output_buffer_length; // in bytes, at most OUTPUT_BUFFER_FRAMES frames
     // Source buffer cache
     uint8_t *src_buffer;
     uint32_t src_buffer_length; // in bytes
@@ -62,9 +76,20 @@ typedef struct {
     audiospeed_speed_t speed;
     bool source_done;  // source returned DONE on last get_buffer
     bool source_exhausted; // source DONE and we consumed all of it
+    // Interpolating qualities only. speed.phase is then the position in window.
+    audiospeed_quality_t quality;
+    bool tail_padded; // silence was appended after the last source frame
+    int16_t *window; // planar, AUDIOSPEED_WINDOW_FRAMES per channel
+    uint32_t window_frames; // frames of window holding data
+    uint32_t src_index; // next frame of src_buffer to copy into window
+    uint32_t src_skip; // source frames to drop before copying
+    int16_t *sinc_table; // AUDIOSPEED_SINC_PHASES rows of AUDIOSPEED_SINC_TAPS
+    uint32_t sinc_rate_fp; // rate the sinc_table cutoff was computed for
 } audiospeed_base_t;
 
-void audiospeed_construct(audiospeed_base_t *self, mp_obj_t source, mp_obj_t rate_obj);
+void audiospeed_construct(audiospeed_base_t *self, mp_obj_t source, mp_obj_t rate_obj, audiospeed_quality_t quality);
+void audiospeed_set_quality(audiospeed_base_t *self, audiospeed_quality_t quality);
+void audiospeed_rate_changed(audiospeed_base_t *self);
 void audiospeed_deinit(audiospeed_base_t *self);
 bool audiospeed_fetch_source_buffer(audiospeed_base_t *self);
 void audiospeed_reset_buffer(audiospeed_base_t *self, bool single_channel_output, uint8_t channel);
@@ -8,6 +8,8 @@
 
 #include <stdbool.h>
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "py/runtime.h"
 
@@ -35,9 +37,36 @@ static void check_matching_details(displayio_bitmap_t *b1, displayio_bitmap_t *b
     }
 }
 
+// The filters work on the rows of a bitmap, which a tiled bitmap doesn't store whole
+static void check_rows(displayio_bitmap_t *bitmap) {
+    if (bitmap->tiled) {
+        mp_raise_NotImplementedError(MP_ERROR_TEXT("Operation or feature not supported"));
+    }
+}
+
 size_t scratchpad_size = 0;
 static void *scratchpad = NULL;
 
+// Like scratchpad_alloc, but returns NULL rather than raising when there isn't enough memory
+static void *scratchpad_try_alloc(size_t sz) {
+    if (scratchpad) {
+        if (sz > scratchpad_size) {
+            void *tmp = port_realloc(scratchpad, sz, false);
+            if (!tmp) {
+                port_free(scratchpad);
+                scratchpad = NULL;
+            } else {
+                scratchpad = tmp;
+                scratchpad_size = sz;
+            }
+        }
+    } else {
+        scratchpad = port_malloc(sz, false);
+        scratchpad_size = sz;
+    }
+    return scratchpad;
+}
+
 static void *scratchpad_alloc(size_t sz) {
     if (sz == 0) {
         if (scratchpad) {
@@ -45,40 +74,12 @@ static void *scratchpad_alloc(size_t sz) {
         }
         scratchpad_size = sz;
         scratchpad = NULL;
-    } else {
-        if (scratchpad) {
-            if (sz > scratchpad_size) {
-                void *tmp = port_realloc(scratchpad, sz, false);
-                if (!tmp) {
-                    port_free(scratchpad);
-                    scratchpad = NULL;
-                } else {
-                    scratchpad = tmp;
-                    scratchpad_size = sz;
-                }
-            }
-        } else {
-            scratchpad = port_malloc(sz, false);
-            scratchpad_size = sz;
-        }
-        if (!scratchpad) {
-            m_malloc_fail(sz);
-        }
+    } else if (!scratchpad_try_alloc(sz)) {
+        m_malloc_fail(sz);
     }
     return scratchpad;
 }
 
-static void scratch_bitmap16(displayio_bitmap_t *buf, int rows, int cols) {
-    int stride = (cols + 1) / 2;
-    size_t sz = rows * stride * sizeof(uint32_t);
-    void *data = scratchpad_alloc(sz);
-    // memset(data, 0, sz);
-    buf->width = cols;
-    buf->height = rows;
-    buf->stride = stride;
-    buf->data = data;
-}
-
 // https://en.wikipedia.org/wiki/YCbCr -> JPEG Conversion
 uint16_t imlib_yuv_to_rgb(uint8_t y, int8_t u, int8_t v) {
     uint32_t r = IM_MAX(IM_MIN(y + ((91881 * v) >> 16), COLOR_R8_MAX), COLOR_R8_MIN);
@@ -88,6 +89,220 @@ uint16_t imlib_yuv_to_rgb(uint8_t y, int8_t u, int8_t v) {
     return COLOR_R8_G8_B8_TO_RGB565(r, g, b);
 }
 
+// Unpack row y into 5/6/5 bit channels, repeating the edge pixels `pad` times on either side.
+static void morph_unpack_row(displayio_bitmap_t *bitmap, int y, int pad, uint8_t *r, uint8_t *g, uint8_t *b) {
+    uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+    for (int x = -pad, xx = bitmap->width + pad; x < xx; x++) {
+        int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, IM_MIN(IM_MAX(x, 0), (bitmap->width - 1)));
+        r[x + pad] = COLOR_RGB565_TO_R5(pixel);
+        g[x + pad] = COLOR_RGB565_TO_G6(pixel);
+        b[x + pad] = COLOR_RGB565_TO_B5(pixel);
+    }
+}
+
+// Scale, offset and clip the convolution sums of one pixel, then threshold against the original pixel.
+static inline int morph_output_pixel(int32_t r_acc, int32_t g_acc, int32_t b_acc, int32_t m_int, int32_t b_int,
+    bool threshold, int offset, bool invert, int original) {
+    r_acc = (r_acc * m_int + b_int) >> 16;
+    if (r_acc > COLOR_R5_MAX) {
+        r_acc = COLOR_R5_MAX;
+    } else if (r_acc < 0) {
+        r_acc = 0;
+    }
+    g_acc = (g_acc * m_int + b_int * 2) >> 16;
+    if (g_acc > COLOR_G6_MAX) {
+        g_acc = COLOR_G6_MAX;
+    } else if (g_acc < 0) {
+        g_acc = 0;
+    }
+    b_acc = (b_acc * m_int + b_int) >> 16;
+    if (b_acc > COLOR_B5_MAX) {
+        b_acc = COLOR_B5_MAX;
+    } else if (b_acc < 0) {
+        b_acc = 0;
+    }
+
+    int pixel = COLOR_R5_G6_B5_TO_RGB565(r_acc, g_acc, b_acc);
+
+    if (threshold) {
+        if (((COLOR_RGB565_TO_Y(pixel) - offset) < COLOR_RGB565_TO_Y(original)) ^ invert) {
+            pixel = COLOR_RGB565_BINARY_MAX;
+        } else {
+            pixel = COLOR_RGB565_BINARY_MIN;
+        }
+    }
+    return pixel;
+}
+
+static int gcd(int a, int b) {
+    while (b) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// If the n x n kernel is the product of a column and a row of integers, find
+// them. The result of filtering with them is exactly that of the kernel.
+static bool morph_separate(int n, const int *krn, int *col, int *row) {
+    int pivot = -1;
+    for (int i = 0; i < n * n && pivot < 0; i++) {
+        if (krn[i]) {
+            pivot = i;
+        }
+    }
+    if (pivot < 0) {
+        for (int i = 0; i < n; i++) {
+            col[i] = 1;
+            row[i] = 0;
+        }
+        return true;
+    }
+    const int *pivot_row = krn + (pivot / n) * n;
+    int divisor = 0;
+    for (int i = 0; i < n; i++) {
+        divisor = gcd(divisor, abs(pivot_row[i]));
+    }
+    for (int i = 0; i < n; i++) {
+        row[i] = pivot_row[i] / divisor;
+    }
+    int pivot_x = pivot % n;
+    for (int j = 0; j < n; j++) {
+        if (krn[j * n + pivot_x] % row[pivot_x]) {
+            return false;
+        }
+        col[j] = krn[j * n + pivot_x] / row[pivot_x];
+        for (int i = 0; i < n; i++) {
+            if (col[j] * row[i] != krn[j * n + i]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Filter with a kernel that is a column times a row: each source row is
+// filtered horizontally once, and the output sums the filtered rows. When
+// every weight is the same (a box), both passes keep running sums instead, so
+// the cost does not grow with the kernel size. `box` points to that weight,
+// or is NULL.
+//
+// The horizontal pass is kept in 16 bits, see morph_row_fits_int16, so the
+// scratchpad holds 2 * 3 * width bytes for each of the 2 * ksize + 2 filtered
+// rows, plus one row of 32 bit sums and one padded unpacked row. That is about
+// twice the single pass's 3 * (width + 2 * ksize) bytes for each of its
+// 2 * ksize + 1 rows. Returns false, having done nothing, if it can't be
+// allocated, so that the caller can use the single pass instead.
+static bool morph_separable(displayio_bitmap_t *bitmap, displayio_bitmap_t *mask, int ksize, const int *col, const int *row,
+    const int *box, int32_t m_int, int32_t b_int, bool threshold, int offset, bool invert) {
+    int n = 2 * ksize + 1;
+    int width = bitmap->width, height = bitmap->height;
+    int padded = width + 2 * ksize;
+    // One more filtered row than the kernel height, for the running sum to drop
+    int ring_rows = n + 1;
+    size_t row_len = 3 * width;
+
+    int32_t *sums = scratchpad_try_alloc(row_len * sizeof(int32_t) + ring_rows * row_len * sizeof(int16_t) + 3 * padded);
+    if (!sums) {
+        return false;
+    }
+    int16_t *filtered = (int16_t *)(sums + row_len);
+    uint8_t *r = (uint8_t *)(filtered + ring_rows * row_len), *g = r + padded, *b = g + padded;
+
+    int next_row = 0;
+    for (int y = 0; y < height; y++) {
+        // Filter the source rows that have come into reach horizontally
+        for (int last = IM_MIN(y + ksize, height - 1); next_row <= last; next_row++) {
+            morph_unpack_row(bitmap, next_row, ksize, r, g, b);
+            int16_t *out = filtered + (next_row % ring_rows) * row_len;
+            if (box) {
+                int32_t r_acc = 0, g_acc = 0, b_acc = 0;
+                for (int i = 0; i < n - 1; i++) {
+                    r_acc += r[i];
+                    g_acc += g[i];
+                    b_acc += b[i];
+                }
+                for (int x = 0; x < width; x++) {
+                    r_acc += r[x + n - 1];
+                    g_acc += g[x + n - 1];
+                    b_acc += b[x + n - 1];
+                    out[3 * x] = r_acc;
+                    out[3 * x + 1] = g_acc;
+                    out[3 * x + 2] = b_acc;
+                    r_acc -= r[x];
+                    g_acc -= g[x];
+                    b_acc -= b[x];
+                }
+            } else {
+                for (int x = 0; x < width; x++) {
+                    int32_t r_acc = 0, g_acc = 0, b_acc = 0;
+                    for (int i = 0; i < n; i++) {
+                        r_acc += row[i] * r[x + i];
+                        g_acc += row[i] * g[x + i];
+                        b_acc += row[i] * b[x + i];
+                    }
+                    out[3 * x] = r_acc;
+                    out[3 * x + 1] = g_acc;
+                    out[3 * x + 2] = b_acc;
+                }
+            }
+        }
+
+        if (box) {
+            if (y == 0) {
+                memset(sums, 0, row_len * sizeof(int32_t));
+                for (int j = -ksize; j <= ksize; j++) {
+                    int16_t *in = filtered + (IM_MIN(IM_MAX(j, 0), (height - 1)) % ring_rows) * row_len;
+                    for (size_t i = 0; i < row_len; i++) {
+                        sums[i] += in[i];
+                    }
+                }
+            } else {
+                int16_t *in = filtered + (IM_MIN(y + ksize, (height - 1)) % ring_rows) * row_len;
+                int16_t *drop = filtered + (IM_MAX(y - ksize - 1, 0) % ring_rows) * row_len;
+                for (size_t i = 0; i < row_len; i++) {
+                    sums[i] += in[i] - drop[i];
+                }
+            }
+        } else {
+            memset(sums, 0, row_len * sizeof(int32_t));
+            for (int j = -ksize; j <= ksize; j++) {
+                int16_t *in = filtered + (IM_MIN(IM_MAX(y + j, 0), (height - 1)) % ring_rows) * row_len;
+                int weight = col[j + ksize];
+                for (size_t i = 0; i < row_len; i++) {
+                    sums[i] += weight * in[i];
+                }
+            }
+        }
+
+        // The source rows this row needs are all filtered, so it can be written in place
+        int weight = box ? *box : 1;
+        uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+        for (int x = 0; x < width; x++) {
+            if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
+                continue; // Short circuit.
+            }
+            int pixel = morph_output_pixel(weight * sums[3 * x], weight * sums[3 * x + 1], weight * sums[3 * x + 2],
+                m_int, b_int, threshold, offset, invert, IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x));
+            IMAGE_PUT_RGB565_PIXEL_FAST(row_ptr, x, pixel);
+        }
+    }
+    return true;
+}
+
+// Whether filtering a row of 6 bit channels with the weights can't go outside an int16_t
+static bool morph_row_fits_int16(int n, const int *row) {
+    int32_t total = 0;
+    for (int i = 0; i < n; i++) {
+        total += abs(row[i]);
+        if (total * COLOR_G6_MAX > INT16_MAX) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void shared_module_bitmapfilter_morph(
     displayio_bitmap_t *bitmap,
     displayio_bitmap_t *mask,
@@ -99,99 +314,63 @@ void shared_module_bitmapfilter_morph(
     int offset,
     bool invert) {
 
-    int brows = ksize + 1;
+    int n = 2 * ksize + 1;
 
     const int32_t m_int = (int32_t)MICROPY_FLOAT_C_FUN(round)(65536 * m);
     const int32_t b_int = (int32_t)MICROPY_FLOAT_C_FUN(round)(65536 * COLOR_G6_MAX * b);
 
+    check_rows(bitmap);
     switch (bitmap->bits_per_value) {
         default:
             mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
         case 16: {
-            displayio_bitmap_t buf;
-            scratch_bitmap16(&buf, brows, bitmap->width);
+            int col[n], row[n];
+            if (morph_separate(n, krn, col, row) && morph_row_fits_int16(n, row)) {
+                const int *box = krn;
+                for (int i = 1; i < n * n; i++) {
+                    if (krn[i] != krn[0]) {
+                        box = NULL;
+                    }
+                }
+                if (morph_separable(bitmap, mask, ksize, col, row, box, m_int, b_int, threshold, offset, invert)) {
+                    break;
+                }
+            }
 
+            // Keep the kernel's source rows unpacked, with the edges repeated,
+            // so that each pixel is read and unpacked only once
+            int padded = bitmap->width + 2 * ksize;
+            size_t unpacked_len = 3 * padded;
+            uint8_t *unpacked = scratchpad_alloc(n * unpacked_len);
+
+            int next_row = 0;
             for (int y = 0, yy = bitmap->height; y < yy; y++) {
-                uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
-                uint16_t *buf_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(&buf, (y % brows));
+                for (int last = IM_MIN(y + ksize, yy - 1); next_row <= last; next_row++) {
+                    uint8_t *r = unpacked + (next_row % n) * unpacked_len;
+                    morph_unpack_row(bitmap, next_row, ksize, r, r + padded, r + 2 * padded);
+                }
 
+                // The source rows this row needs are all unpacked, so it can be written in place
+                uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
                 for (int x = 0, xx = bitmap->width; x < xx; x++) {
                     if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
-                        IMAGE_PUT_RGB565_PIXEL_FAST(buf_row_ptr, x, IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x));
                         continue; // Short circuit.
-
                     }
                     int32_t r_acc = 0, g_acc = 0, b_acc = 0, ptr = 0;
-
-                    if (x >= ksize && x < bitmap->width - ksize && y >= ksize && y < bitmap->height - ksize) {
-                        for (int j = -ksize; j <= ksize; j++) {
-                            uint16_t *k_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y + j);
-                            for (int k = -ksize; k <= ksize; k++) {
-                                int pixel = IMAGE_GET_RGB565_PIXEL_FAST(k_row_ptr, x + k);
-                                r_acc += krn[ptr] * COLOR_RGB565_TO_R5(pixel);
-                                g_acc += krn[ptr] * COLOR_RGB565_TO_G6(pixel);
-                                b_acc += krn[ptr++] * COLOR_RGB565_TO_B5(pixel);
-                            }
-                        }
-                    } else {
-                        for (int j = -ksize; j <= ksize; j++) {
-                            uint16_t *k_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap,
-                                IM_MIN(IM_MAX(y + j, 0), (bitmap->height - 1)));
-                            for (int k = -ksize; k <= ksize; k++) {
-                                int pixel = IMAGE_GET_RGB565_PIXEL_FAST(k_row_ptr,
-                                    IM_MIN(IM_MAX(x + k, 0), (bitmap->width - 1)));
-                                r_acc += krn[ptr] * COLOR_RGB565_TO_R5(pixel);
-                                g_acc += krn[ptr] * COLOR_RGB565_TO_G6(pixel);
-                                b_acc += krn[ptr++] * COLOR_RGB565_TO_B5(pixel);
-                            }
+                    for (int j = -ksize; j <= ksize; j++) {
+                        const uint8_t *r = unpacked + (IM_MIN(IM_MAX(y + j, 0), (yy - 1)) % n) * unpacked_len + x;
+                        const uint8_t *g = r + padded, *b = g + padded;
+                        for (int k = 0; k < n; k++) {
+                            r_acc += krn[ptr] * r[k];
+                            g_acc += krn[ptr] * g[k];
+                            b_acc += krn[ptr++] * b[k];
                         }
                     }
-                    r_acc = (r_acc * m_int + b_int) >> 16;
-                    if (r_acc > COLOR_R5_MAX) {
-                        r_acc = COLOR_R5_MAX;
-                    } else if (r_acc < 0) {
-                        r_acc = 0;
-                    }
-                    g_acc = (g_acc * m_int + b_int * 2) >> 16;
-                    if (g_acc > COLOR_G6_MAX) {
-                        g_acc = COLOR_G6_MAX;
-                    } else if (g_acc < 0) {
-                        g_acc = 0;
-                    }
-                    b_acc = (b_acc * m_int + b_int) >> 16;
-                    if (b_acc > COLOR_B5_MAX) {
-                        b_acc = COLOR_B5_MAX;
-                    } else if (b_acc < 0) {
-                        b_acc = 0;
-                    }
-
-                    int pixel = COLOR_R5_G6_B5_TO_RGB565(r_acc, g_acc, b_acc);
-
-                    if (threshold) {
-                        if (((COLOR_RGB565_TO_Y(pixel) - offset) < COLOR_RGB565_TO_Y(IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x))) ^ invert) {
-                            pixel = COLOR_RGB565_BINARY_MAX;
-                        } else {
-                            pixel = COLOR_RGB565_BINARY_MIN;
-                        }
-                    }
-
-                    IMAGE_PUT_RGB565_PIXEL_FAST(buf_row_ptr, x, pixel);
-                }
-
-                if (y >= ksize) {     // Transfer buffer lines...
-                    memcpy(IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, (y - ksize)),
-                        IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(&buf, ((y - ksize) % brows)),
-                        IMAGE_RGB565_LINE_LEN_BYTES(bitmap));
+                    int pixel = morph_output_pixel(r_acc, g_acc, b_acc, m_int, b_int, threshold, offset, invert,
+                        IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x));
+                    IMAGE_PUT_RGB565_PIXEL_FAST(row_ptr, x, pixel);
                 }
             }
-
-            // Copy any remaining lines from the buffer image...
-            for (int y = IM_MAX(bitmap->height - ksize, 0), yy = bitmap->height; y < yy; y++) {
-                memcpy(IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y),
-                    IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(&buf, (y % brows)),
-                    IMAGE_RGB565_LINE_LEN_BYTES(bitmap));
-            }
-
             break;
         }
     }
@@ -217,6 +396,7 @@ void shared_module_bitmapfilter_mix(
         wt[i] = (int32_t)MICROPY_FLOAT_C_FUN(round)(scale * weights[i]);
     }
 
+    check_rows(bitmap);
     switch (bitmap->bits_per_value) {
         default:
             mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
@@ -271,6 +451,7 @@ void shared_module_bitmapfilter_solarize(
     const mp_float_t threshold) {
 
     int threshold_i = (int32_t)MICROPY_FLOAT_C_FUN(round)(256 * threshold);
+    check_rows(bitmap);
     switch (bitmap->bits_per_value) {
         default:
             mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
@@ -302,6 +483,7 @@ void shared_module_bitmapfilter_lookup(
     displayio_bitmap_t *mask,
     const bitmapfilter_lookup_table_t *table) {
 
+    check_rows(bitmap);
     switch (bitmap->bits_per_value) {
         default:
             mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
@@ -344,6 +526,7 @@ void shared_module_bitmapfilter_false_color(
         table[i] = COLOR_R8_G8_B8_TO_RGB565(r, g, b);
     }
 
+    check_rows(bitmap);
     switch (bitmap->bits_per_value) {
         default:
             mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
@@ -388,7 +571,10 @@ void shared_module_bitmapfilter_blend(
 
     check_matching_details(bitmap, src1);
     check_matching_details(bitmap, src2);
+    check_rows(src1);
+    check_rows(src2);
 
+    check_rows(bitmap);
     switch (bitmap->bits_per_value) {
         default:
             mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
@@ -23,6 +23,110 @@
 #define BITMAP_DEBUG(...) (void)0
 // #define BITMAP_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
+static inline int64_t to_fixed_16_16(mp_float_t value) {
+    return (int64_t)MICROPY_FLOAT_C_FUN(floor)(value * 65536 + MICROPY_FLOAT_CONST(0.5));
+}
+
+// Narrow [*first, *last] to the steps i where lo <= start + i * step <= hi.
+// Returns false if no steps are left.
+static bool clip_span(int64_t start, int64_t step, int64_t lo, int64_t hi, int32_t *first, int32_t *last) {
+    if (step == 0) {
+        return start >= lo && start <= hi;
+    }
+    int64_t a, b;
+    if (step > 0) {
+        a = lo - start;
+        b = hi - start;
+    } else {
+        a = start - hi;
+        b = start - lo;
+        step = -step;
+    }
+    // ceil(a / step) and floor(b / step), rounding towards the right infinity
+    int64_t i0 = a > 0 ? (a + step - 1) / step : -((-a) / step);
+    int64_t i1 = b >= 0 ? b / step : -((-b + step - 1) / step);
+    if (i0 > *first) {
+        *first = i0 > *last ? *last + 1 : i0;
+    }
+    if (i1 < *last) {
+        *last = i1 < *first ? *first - 1 : i1;
+    }
+    return *first <= *last;
+}
+
+// The address of pixel (x, y), or for fewer than 8 bits per value, of the byte holding it
+static inline void *bitmap_pixel(const displayio_bitmap_t *self, int x, int y) {
+    return (uint8_t *)self->data + displayio_bitmap_byte_offset(self, x, y);
+}
+
+// Pixel access for positions already known to be inside the bitmap
+static inline uint32_t bitmap_get_unchecked(const displayio_bitmap_t *self, int x, int y) {
+    const void *pixel = bitmap_pixel(self, x, y);
+    switch (self->bits_per_value) {
+        case 8:
+            return *(const uint8_t *)pixel;
+        case 16:
+            return *(const uint16_t *)pixel;
+        case 32:
+            return *(const uint32_t *)pixel;
+        default: {
+            uint8_t bits = *(const uint8_t *)pixel;
+            uint8_t bit_position = (8 / self->bits_per_value - (x & self->x_mask) - 1) * self->bits_per_value;
+            return (bits >> bit_position) & self->bitmask;
+        }
+    }
+}
+
+static inline void bitmap_put_unchecked(displayio_bitmap_t *self, int x, int y, uint32_t value) {
+    void *pixel = bitmap_pixel(self, x, y);
+    switch (self->bits_per_value) {
+        case 8:
+            *(uint8_t *)pixel = value;
+            break;
+        case 16:
+            *(uint16_t *)pixel = value;
+            break;
+        case 32:
+            *(uint32_t *)pixel = value;
+            break;
+        default:
+            displayio_bitmap_write_pixel(self, x, y, value);
+            break;
+    }
+}
+
+// Spread an RGB565 value so that each component has room to be multiplied by up to 32
+static inline uint32_t rgb565_spread(uint32_t c) {
+    return (c | c << 16) & 0x07e0f81f;
+}
+
+static inline uint32_t rgb565_lerp(uint32_t a, uint32_t b, uint32_t weight) {
+    return ((a * (32 - weight) + b * weight) >> 5) & 0x07e0f81f;
+}
+
+// Blend the four RGB565 source pixels around the 16.16 position (u, v). Where
+// any of them is the skip index, the nearest pixel is used as is. Returns
+// false if the pixel should not be drawn.
+static bool rotozoom_bilinear(const displayio_bitmap_t *source, uint32_t u, uint32_t v, int x_max, int y_max,
+    uint32_t skip_index, bool skip_index_none, uint32_t *result) {
+    int x0 = u >> 16, y0 = v >> 16;
+    int x1 = MIN(x0 + 1, x_max), y1 = MIN(y0 + 1, y_max);
+    uint32_t c00 = bitmap_get_unchecked(source, x0, y0);
+    uint32_t c10 = bitmap_get_unchecked(source, x1, y0);
+    uint32_t c01 = bitmap_get_unchecked(source, x0, y1);
+    uint32_t c11 = bitmap_get_unchecked(source, x1, y1);
+    if (!skip_index_none && (c00 == skip_index || c10 == skip_index || c01 == skip_index || c11 == skip_index)) {
+        *result = c00;
+        return c00 != skip_index;
+    }
+    uint32_t fx = (u >> 11) & 31, fy = (v >> 11) & 31;
+    uint32_t top = rgb565_lerp(rgb565_spread(c00), rgb565_spread(c10), fx);
+    uint32_t bottom = rgb565_lerp(rgb565_spread(c01), rgb565_spread(c11), fx);
+    uint32_t c = rgb565_lerp(top, bottom, fy);
+    *result = (c & 0xf81f) | ((c >> 16) & 0x07e0);
+    return true;
+}
+
 void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16_t oy,
     int16_t dest_clip0_x, int16_t dest_clip0_y,
     int16_t dest_clip1_x, int16_t dest_clip1_y,
@@ -31,7 +135,7 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     int16_t source_clip1_x, int16_t source_clip1_y,
     mp_float_t angle,
     mp_float_t scale,
-    uint32_t skip_index, bool skip_index_none) {
+    uint32_t skip_index, bool skip_index_none, bool bilinear) {
 
     // Copies region from source to the destination bitmap, including rotation,
     // scaling and clipping of either the source or destination regions
@@ -51,6 +155,7 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     // skip_index: color index that should be ignored (and not copied over)
     // skip_index_none: if skip_index_none is True, then all color indexes should be copied
     //                                                     (that is, no color indexes should be skipped)
+    // bilinear: blend the four nearest source pixels as RGB565 instead of taking the nearest one
 
 
     // Copy complete "source" bitmap into "self" bitmap at location x,y in the "self"
@@ -171,6 +276,13 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
         maxy = dest_clip1_y - 1;
     }
 
+    displayio_area_t dirty_area = {minx, miny, maxx + 1, maxy + 1, NULL};
+    displayio_bitmap_set_dirty_area(self, &dirty_area);
+
+    if (scale == 0) {
+        return;
+    }
+
     mp_float_t dvCol = cosAngle / scale;
     mp_float_t duCol = sinAngle / scale;
 
@@ -180,27 +292,44 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     mp_float_t startu = px - (ox * dvCol + oy * duCol);
     mp_float_t startv = py - (ox * dvRow + oy * duRow);
 
-    mp_float_t rowu = startu + miny * duCol;
-    mp_float_t rowv = startv + miny * dvCol;
-
-    displayio_area_t dirty_area = {minx, miny, maxx + 1, maxy + 1, NULL};
-    displayio_bitmap_set_dirty_area(self, &dirty_area);
-
-    for (y = miny; y <= maxy; y++) {
-        mp_float_t u = rowu + minx * duRow;
-        mp_float_t v = rowv + minx * dvRow;
-        for (x = minx; x <= maxx; x++) {
-            if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
-                uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
+    // The source position is stepped across each row in 16.16 fixed point.
+    // Row starts are kept in 64 bits, as they can be far outside the source.
+    int64_t rowu = to_fixed_16_16(startu + miny * duCol + minx * duRow);
+    int64_t rowv = to_fixed_16_16(startv + miny * dvCol + minx * dvRow);
+    int64_t du_col = to_fixed_16_16(duCol), dv_col = to_fixed_16_16(dvCol);
+    int64_t du_row = to_fixed_16_16(duRow), dv_row = to_fixed_16_16(dvRow);
+    // Positions inside the source fit in 32 bits. Stepping is unsigned so that
+    // the step past the end of a span may wrap harmlessly.
+    uint32_t du = du_row, dv = dv_row;
+
+    const int64_t u_min = (int64_t)source_clip0_x << 16, u_max = ((int64_t)source_clip1_x << 16) - 1;
+    const int64_t v_min = (int64_t)source_clip0_y << 16, v_max = ((int64_t)source_clip1_y << 16) - 1;
+
+    for (y = miny; y <= maxy; y++, rowu += du_col, rowv += dv_col) {
+        // Find the span of the row that maps inside the source clip, so that
+        // nothing outside it is looked at
+        int32_t first = 0, last = maxx - minx;
+        if (!clip_span(rowu, du_row, u_min, u_max, &first, &last) ||
+            !clip_span(rowv, dv_row, v_min, v_max, &first, &last)) {
+            continue;
+        }
+        uint32_t u = rowu + first * du_row;
+        uint32_t v = rowv + first * dv_row;
+        if (bilinear) {
+            for (x = minx + first; x <= minx + last; x++, u += du, v += dv) {
+                uint32_t c;
+                if (rotozoom_bilinear(source, u, v, source_clip1_x - 1, source_clip1_y - 1, skip_index, skip_index_none, &c)) {
+                    bitmap_put_unchecked(self, x, y, c);
+                }
+            }
+        } else {
+            for (x = minx + first; x <= minx + last; x++, u += du, v += dv) {
+                uint32_t c = bitmap_get_unchecked(source, u >> 16, v >> 16);
                 if ((skip_index_none) || (c != skip_index)) {
-                    displayio_bitmap_write_pixel(self, x, y, c);
+                    bitmap_put_unchecked(self, x, y, c);
                 }
             }
-            u += duRow;
-            v += dvRow;
         }
-        rowu += duCol;
-        rowv += dvCol;
     }
 }
 
@@ -543,9 +672,43 @@ void common_hal_bitmaptools_draw_polygon(displayio_bitmap_t *destination, void *
     displayio_bitmap_set_dirty_area(destination, &area);
 }
 
+// Copy array elements that are exactly as wide as the bitmap's values straight into its rows,
+// or for a tiled bitmap into the pieces of rows in each tile
+static void arrayblit_rows(displayio_bitmap_t *self, const uint8_t *data, int element_size, int x1, int y1, int x2, int y2, bool skip_specified, uint32_t skip_value) {
+    for (int y = y1; y < y2; y++) {
+        for (int x = x1, n; x < x2; x += n) {
+            n = MIN(x2 - x, displayio_bitmap_row_run(self, x));
+            size_t run_bytes = n * element_size;
+            uint8_t *row = (uint8_t *)self->data + displayio_bitmap_byte_offset(self, x, y);
+            if (!skip_specified) {
+                memcpy(row, data, run_bytes);
+            } else {
+                for (size_t i = 0; i < run_bytes; i += element_size) {
+                    uint32_t value = 0;
+                    memcpy(&value, data + i, element_size);
+                    if (value != skip_value) {
+                        memcpy(row + i, data + i, element_size);
+                    }
+                }
+            }
+            data += run_bytes;
+        }
+    }
+}
+
 void common_hal_bitmaptools_arrayblit(displayio_bitmap_t *self, void *data, int element_size, int x1, int y1, int x2, int y2, bool skip_specified, uint32_t skip_value) {
     uint32_t mask = (1 << common_hal_displayio_bitmap_get_bits_per_value(self)) - 1;
 
+    if (self->bits_per_value == element_size * 8) {
+        if (self->read_only) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+        }
+        arrayblit_rows(self, data, element_size, x1, y1, x2, y2, skip_specified, skip_value);
+        displayio_area_t area = { x1, y1, x2, y2, NULL };
+        displayio_bitmap_set_dirty_area(self, &area);
+        return;
+    }
+
     for (int y = y1; y < y2; y++) {
         for (int x = x1; x < x2; x++) {
             uint32_t value;
@@ -711,14 +874,18 @@ static void fill_row(displayio_bitmap_t *bitmap, int swap, int16_t *luminance_da
         luminance_data[bitmap->width + i] = 0;
     }
 
-    if (bitmap->bits_per_value == 8) {
-        uint8_t *pixel_data = (uint8_t *)(bitmap->data + bitmap->stride * y);
-        for (int x = 0; x < bitmap->width; x++) {
-            *luminance_data++ = *pixel_data++;
+    // A tiled bitmap's row is stored in pieces
+    for (int x0 = 0, n; x0 < bitmap->width; x0 += n) {
+        n = displayio_bitmap_row_run(bitmap, x0);
+        if (bitmap->bits_per_value == 8) {
+            uint8_t *pixel_data = bitmap_pixel(bitmap, x0, y);
+            for (int x = 0; x < n; x++) {
+                *luminance_data++ = *pixel_data++;
+            }
+            continue;
         }
-    } else {
-        uint16_t *pixel_data = (uint16_t *)(bitmap->data + bitmap->stride * y);
-        for (int x = 0; x < bitmap->width; x++) {
+        uint16_t *pixel_data = bitmap_pixel(bitmap, x0, y);
+        for (int x = 0; x < n; x++) {
             uint16_t pixel = *pixel_data++;
             if (swap & SWAP_BYTES) {
                 pixel = __builtin_bswap16(pixel);
@@ -746,7 +913,12 @@ static void fill_row(displayio_bitmap_t *bitmap, int swap, int16_t *luminance_da
 }
 
 static void write_pixels(displayio_bitmap_t *bitmap, int y, bool *data) {
-    if (bitmap->bits_per_value == 1) {
+    if (bitmap->tiled) {
+        uint32_t on = bitmap->bitmask;
+        for (int x = 0; x < bitmap->width; x++) {
+            bitmap_put_unchecked(bitmap, x, y, *data++ ? on : 0);
+        }
+    } else if (bitmap->bits_per_value == 1) {
         uint32_t *pixel_data = (uint32_t *)(bitmap->data + bitmap->stride * y);
         for (int i = 0; i < bitmap->width; i++) {
             uint32_t p = 0;
@@ -856,6 +1028,14 @@ void common_hal_bitmaptools_dither(displayio_bitmap_t *dest_bitmap, displayio_bi
     displayio_bitmap_set_dirty_area(dest_bitmap, &a);
 }
 
+// The number of pixels from x on that are stored one after another in the
+// rows of all the blended bitmaps
+static int blend_run(displayio_bitmap_t *dest, displayio_bitmap_t *source1, displayio_bitmap_t *source2, displayio_bitmap_t *mask, int x) {
+    int n = MIN(displayio_bitmap_row_run(dest, x), displayio_bitmap_row_run(source1, x));
+    n = MIN(n, displayio_bitmap_row_run(source2, x));
+    return mask ? MIN(n, displayio_bitmap_row_run(mask, x)) : n;
+}
+
 void common_hal_bitmaptools_alphablend(displayio_bitmap_t *dest, displayio_bitmap_t *source1, displayio_bitmap_t *source2, displayio_colorspace_t colorspace, mp_float_t factor1, mp_float_t factor2,
     bitmaptools_blendmode_t blendmode, uint32_t skip_source1_index, bool skip_source1_index_none, uint32_t skip_source2_index, bool skip_source2_index_none,
     displayio_bitmap_t *mask) {
@@ -870,50 +1050,53 @@ void common_hal_bitmaptools_alphablend(displayio_bitmap_t *dest, displayio_bitma
 
     if (colorspace == DISPLAYIO_COLORSPACE_L8) {
         for (int y = 0; y < dest->height; y++) {
-            uint8_t *dptr = (uint8_t *)(dest->data + y * dest->stride);
-            uint8_t *sptr1 = (uint8_t *)(source1->data + y * source1->stride);
-            uint8_t *sptr2 = (uint8_t *)(source2->data + y * source2->stride);
-            uint8_t *mptr = mask ? (uint8_t *)(mask->data + y * mask->stride) : NULL;
-            int pixel;
-            for (int x = 0; x < dest->width; x++) {
-                blend_source1 = skip_source1_index_none || *sptr1 != (uint8_t)skip_source1_index;
-                blend_source2 = skip_source2_index_none || *sptr2 != (uint8_t)skip_source2_index;
-                if (mptr) {
-                    uint8_t m = *mptr;
-                    // Scale source2's contribution by the mask (0..255)
-                    ifactor2 = (ifactor2_base * m + 127) / 255;
-                    if (m == 0) {
-                        // Mask says fully transparent: drop source2 entirely
-                        blend_source2 = false;
+            for (int x0 = 0, n; x0 < dest->width; x0 += n) {
+                n = blend_run(dest, source1, source2, mask, x0);
+                uint8_t *dptr = bitmap_pixel(dest, x0, y);
+                uint8_t *sptr1 = bitmap_pixel(source1, x0, y);
+                uint8_t *sptr2 = bitmap_pixel(source2, x0, y);
+                uint8_t *mptr = mask ? bitmap_pixel(mask, x0, y) : NULL;
+                int pixel;
+                for (int x = 0; x < n; x++) {
+                    blend_source1 = skip_source1_index_none || *sptr1 != (uint8_t)skip_source1_index;
+                    blend_source2 = skip_source2_index_none || *sptr2 != (uint8_t)skip_source2_index;
+                    if (mptr) {
+                        uint8_t m = *mptr;
+                        // Scale source2's contribution by the mask (0..255)
+                        ifactor2 = (ifactor2_base * m + 127) / 255;
+                        if (m == 0) {
+                            // Mask says fully transparent: drop source2 entirely
+                            blend_source2 = false;
+                        }
                     }
-                }
-                if (blend_source1 && blend_source2) {
-                    // Premultiply by the alpha factor
-                    int sda = *sptr1++ *ifactor1;
-                    int sca = *sptr2++ *ifactor2;
-                    // Blend
-                    int blend;
-                    if (blendmode == BITMAPTOOLS_BLENDMODE_SCREEN) {
-                        blend = sca + sda - (sca * sda / 65536);
+                    if (blend_source1 && blend_source2) {
+                        // Premultiply by the alpha factor
+                        int sda = *sptr1++ *ifactor1;
+                        int sca = *sptr2++ *ifactor2;
+                        // Blend
+                        int blend;
+                        if (blendmode == BITMAPTOOLS_BLENDMODE_SCREEN) {
+                            blend = sca + sda - (sca * sda / 65536);
+                        } else {
+                            blend = sca + sda * (256 - ifactor2) / 256;
+                        }
+                        // Divide by the alpha factor
+                        int denom = ifactor1 + ifactor2 - ifactor1 * ifactor2 / 256;
+                        pixel = (denom > 0) ? (blend / denom) : 0;
+                    } else if (blend_source1) {
+                        // Apply iFactor1 to source1 only
+                        pixel = *sptr1++ *ifactor1 / 256;
+                    } else if (blend_source2) {
+                        // Apply iFactor2 to source1 only
+                        pixel = *sptr2++ *ifactor2 / 256;
                     } else {
-                        blend = sca + sda * (256 - ifactor2) / 256;
+                        // Use the destination value
+                        pixel = *dptr;
+                    }
+                    *dptr++ = MIN(255, MAX(0, pixel));
+                    if (mptr) {
+                        mptr++;
                     }
-                    // Divide by the alpha factor
-                    int denom = ifactor1 + ifactor2 - ifactor1 * ifactor2 / 256;
-                    pixel = (denom > 0) ? (blend / denom) : 0;
-                } else if (blend_source1) {
-                    // Apply iFactor1 to source1 only
-                    pixel = *sptr1++ *ifactor1 / 256;
-                } else if (blend_source2) {
-                    // Apply iFactor2 to source1 only
-                    pixel = *sptr2++ *ifactor2 / 256;
-                } else {
-                    // Use the destination value
-                    pixel = *dptr;
-                }
-                *dptr++ = MIN(255, MAX(0, pixel));
-                if (mptr) {
-                    mptr++;
                 }
             }
         }
@@ -921,99 +1104,102 @@ void common_hal_bitmaptools_alphablend(displayio_bitmap_t *dest, displayio_bitma
         bool swap = (colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED) || (colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED);
         uint16_t pixel;
         for (int y = 0; y < dest->height; y++) {
-            uint16_t *dptr = (uint16_t *)(dest->data + y * dest->stride);
-            uint16_t *sptr1 = (uint16_t *)(source1->data + y * source1->stride);
-            uint16_t *sptr2 = (uint16_t *)(source2->data + y * source2->stride);
-            uint8_t *mptr = mask ? (uint8_t *)(mask->data + y * mask->stride) : NULL;
-            for (int x = 0; x < dest->width; x++) {
-                int spix1 = *sptr1++;
-                int spix2 = *sptr2++;
-
-                if (swap) {
-                    spix1 = __builtin_bswap16(spix1);
-                    spix2 = __builtin_bswap16(spix2);
-                }
-                const int r_mask = 0xf800; // (or b mask, if BGR)
-                const int g_mask = 0x07e0;
-                const int b_mask = 0x001f; // (or r mask, if BGR)
-
-                blend_source1 = skip_source1_index_none || spix1 != (int)skip_source1_index;
-                blend_source2 = skip_source2_index_none || spix2 != (int)skip_source2_index;
-
-                if (mptr) {
-                    uint8_t m = *mptr++;
-                    ifactor2 = (ifactor2_base * m + 127) / 255;
-                    if (m == 0) {
-                        blend_source2 = false;
+            for (int x0 = 0, n; x0 < dest->width; x0 += n) {
+                n = blend_run(dest, source1, source2, mask, x0);
+                uint16_t *dptr = bitmap_pixel(dest, x0, y);
+                uint16_t *sptr1 = bitmap_pixel(source1, x0, y);
+                uint16_t *sptr2 = bitmap_pixel(source2, x0, y);
+                uint8_t *mptr = mask ? bitmap_pixel(mask, x0, y) : NULL;
+                for (int x = 0; x < n; x++) {
+                    int spix1 = *sptr1++;
+                    int spix2 = *sptr2++;
+
+                    if (swap) {
+                        spix1 = __builtin_bswap16(spix1);
+                        spix2 = __builtin_bswap16(spix2);
+                    }
+                    const int r_mask = 0xf800; // (or b mask, if BGR)
+                    const int g_mask = 0x07e0;
+                    const int b_mask = 0x001f; // (or r mask, if BGR)
+
+                    blend_source1 = skip_source1_index_none || spix1 != (int)skip_source1_index;
+                    blend_source2 = skip_source2_index_none || spix2 != (int)skip_source2_index;
+
+                    if (mptr) {
+                        uint8_t m = *mptr++;
+                        ifactor2 = (ifactor2_base * m + 127) / 255;
+                        if (m == 0) {
+                            blend_source2 = false;
+                        }
                     }
-                }
 
-                if (blend_source1 && blend_source2) {
-                    // Blend based on the SVG alpha compositing specs
-                    // https://dev.w3.org/SVG/modules/compositing/master/#alphaCompositing
+                    if (blend_source1 && blend_source2) {
+                        // Blend based on the SVG alpha compositing specs
+                        // https://dev.w3.org/SVG/modules/compositing/master/#alphaCompositing
 
-                    int ifactor_blend = ifactor1 + ifactor2 - ifactor1 * ifactor2 / 256;
-                    if (ifactor_blend <= 0) {
-                        // Both factors are zero at this pixel; keep destination.
-                        dptr++;
-                        continue;
-                    }
+                        int ifactor_blend = ifactor1 + ifactor2 - ifactor1 * ifactor2 / 256;
+                        if (ifactor_blend <= 0) {
+                            // Both factors are zero at this pixel; keep destination.
+                            dptr++;
+                            continue;
+                        }
 
-                    // Premultiply the colors by the alpha factor
-                    int red_dca = ((spix1 & r_mask) >> 8) * ifactor1;
-                    int grn_dca = ((spix1 & g_mask) >> 3) * ifactor1;
-                    int blu_dca = ((spix1 & b_mask) << 3) * ifactor1;
-
-                    int red_sca = ((spix2 & r_mask) >> 8) * ifactor2;
-                    int grn_sca = ((spix2 & g_mask) >> 3) * ifactor2;
-                    int blu_sca = ((spix2 & b_mask) << 3) * ifactor2;
-
-                    int red_blend, grn_blend, blu_blend;
-                    if (blendmode == BITMAPTOOLS_BLENDMODE_SCREEN) {
-                        // Perform a screen blend Sca + Dca - Sca × Dca
-                        red_blend = red_sca + red_dca - (red_sca * red_dca / 65536);
-                        grn_blend = grn_sca + grn_dca - (grn_sca * grn_dca / 65536);
-                        blu_blend = blu_sca + blu_dca - (blu_sca * blu_dca / 65536);
-                    } else {
-                        // Perform a normal (src-over) blend
-                        red_blend = red_sca + red_dca * (256 - ifactor2) / 256;
-                        grn_blend = grn_sca + grn_dca * (256 - ifactor2) / 256;
-                        blu_blend = blu_sca + blu_dca * (256 - ifactor2) / 256;
-                    }
+                        // Premultiply the colors by the alpha factor
+                        int red_dca = ((spix1 & r_mask) >> 8) * ifactor1;
+                        int grn_dca = ((spix1 & g_mask) >> 3) * ifactor1;
+                        int blu_dca = ((spix1 & b_mask) << 3) * ifactor1;
+
+                        int red_sca = ((spix2 & r_mask) >> 8) * ifactor2;
+                        int grn_sca = ((spix2 & g_mask) >> 3) * ifactor2;
+                        int blu_sca = ((spix2 & b_mask) << 3) * ifactor2;
+
+                        int red_blend, grn_blend, blu_blend;
+                        if (blendmode == BITMAPTOOLS_BLENDMODE_SCREEN) {
+                            // Perform a screen blend Sca + Dca - Sca × Dca
+                            red_blend = red_sca + red_dca - (red_sca * red_dca / 65536);
+                            grn_blend = grn_sca + grn_dca - (grn_sca * grn_dca / 65536);
+                            blu_blend = blu_sca + blu_dca - (blu_sca * blu_dca / 65536);
+                        } else {
+                            // Perform a normal (src-over) blend
+                            red_blend = red_sca + red_dca * (256 - ifactor2) / 256;
+                            grn_blend = grn_sca + grn_dca * (256 - ifactor2) / 256;
+                            blu_blend = blu_sca + blu_dca * (256 - ifactor2) / 256;
+                        }
 
-                    // Divide by the alpha factor
-                    int r = ((red_blend / ifactor_blend) << 8) & r_mask;
-                    int g = ((grn_blend / ifactor_blend) << 3) & g_mask;
-                    int b = ((blu_blend / ifactor_blend) >> 3) & b_mask;
+                        // Divide by the alpha factor
+                        int r = ((red_blend / ifactor_blend) << 8) & r_mask;
+                        int g = ((grn_blend / ifactor_blend) << 3) & g_mask;
+                        int b = ((blu_blend / ifactor_blend) >> 3) & b_mask;
 
-                    // Clamp to the appropriate range
-                    r = MIN(r_mask, MAX(0, r)) & r_mask;
-                    g = MIN(g_mask, MAX(0, g)) & g_mask;
-                    b = MIN(b_mask, MAX(0, b)) & b_mask;
+                        // Clamp to the appropriate range
+                        r = MIN(r_mask, MAX(0, r)) & r_mask;
+                        g = MIN(g_mask, MAX(0, g)) & g_mask;
+                        b = MIN(b_mask, MAX(0, b)) & b_mask;
 
-                    pixel = r | g | b;
+                        pixel = r | g | b;
 
-                    if (swap) {
-                        pixel = __builtin_bswap16(pixel);
+                        if (swap) {
+                            pixel = __builtin_bswap16(pixel);
+                        }
+                    } else if (blend_source1) {
+                        // Apply iFactor1 to source1 only
+                        int r = (spix1 & r_mask) * ifactor1 / 256;
+                        int g = (spix1 & g_mask) * ifactor1 / 256;
+                        int b = (spix1 & b_mask) * ifactor1 / 256;
+                        pixel = r | g | b;
+                    } else if (blend_source2) {
+                        // Apply iFactor2 to source1 only
+                        int r = (spix2 & r_mask) * ifactor2 / 256;
+                        int g = (spix2 & g_mask) * ifactor2 / 256;
+                        int b = (spix2 & b_mask) * ifactor2 / 256;
+                        pixel = r | g | b;
+                    } else {
+                        // Use the destination value
+                        pixel = *dptr;
                     }
-                } else if (blend_source1) {
-                    // Apply iFactor1 to source1 only
-                    int r = (spix1 & r_mask) * ifactor1 / 256;
-                    int g = (spix1 & g_mask) * ifactor1 / 256;
-                    int b = (spix1 & b_mask) * ifactor1 / 256;
-                    pixel = r | g | b;
-                } else if (blend_source2) {
-                    // Apply iFactor2 to source1 only
-                    int r = (spix2 & r_mask) * ifactor2 / 256;
-                    int g = (spix2 & g_mask) * ifactor2 / 256;
-                    int b = (spix2 & b_mask) * ifactor2 / 256;
-                    pixel = r | g | b;
-                } else {
-                    // Use the destination value
-                    pixel = *dptr;
-                }
 
-                *dptr++ = pixel;
+                    *dptr++ = pixel;
+                }
             }
         }
     }
@@ -1080,6 +1266,190 @@ void common_hal_bitmaptools_draw_circle(displayio_bitmap_t *destination,
     draw_circle(destination, x, y, radius, value);
 }
 
+// Values of 8 bits or fewer are packed most significant bits first within
+// each byte, so rows are copied as bit strings in that order.
+static inline uint8_t bit_span_mask(uint32_t first, uint32_t n) {
+    return (uint8_t)((0xff >> first) & (0xff << (8 - first - n)));
+}
+
+// Copy nbits bits starting at bit src_bit of src to bit dst_bit of dst. The
+// buffers must not overlap.
+static void copy_bits(uint8_t *dst, uint32_t dst_bit, const uint8_t *src, uint32_t src_bit, uint32_t nbits) {
+    dst += dst_bit / 8;
+    dst_bit %= 8;
+    src += src_bit / 8;
+    src_bit %= 8;
+    if (dst_bit == src_bit) {
+        // In phase, so all but the partial bytes at the ends are plain copies
+        if (dst_bit) {
+            uint32_t n = MIN(nbits, 8 - dst_bit);
+            uint8_t mask = bit_span_mask(dst_bit, n);
+            *dst = (*dst & ~mask) | (*src & mask);
+            dst++;
+            src++;
+            nbits -= n;
+        }
+        memcpy(dst, src, nbits / 8);
+        if (nbits % 8) {
+            uint8_t mask = bit_span_mask(0, nbits % 8);
+            dst[nbits / 8] = (dst[nbits / 8] & ~mask) | (src[nbits / 8] & mask);
+        }
+        return;
+    }
+    // Out of phase, so each destination byte is taken from a window over two source bytes
+    while (nbits) {
+        uint32_t n = MIN(nbits, 8 - dst_bit);
+        uint32_t window = src[0] << 8;
+        if (src_bit + n > 8) {
+            window |= src[1];
+        }
+        uint8_t bits = (uint8_t)(((window << src_bit) >> 8) >> dst_bit);
+        uint8_t mask = bit_span_mask(dst_bit, n);
+        *dst = (*dst & ~mask) | (bits & mask);
+        src_bit += n;
+        src += src_bit / 8;
+        src_bit %= 8;
+        dst_bit += n;
+        if (dst_bit == 8) {
+            dst++;
+            dst_bit = 0;
+        }
+        nbits -= n;
+    }
+}
+
+// Repeat a value of `bits` bits across a word
+static uint32_t replicate_value(uint32_t value, uint32_t bits) {
+    uint32_t result = 0;
+    for (uint32_t i = 0; i < 32; i += bits) {
+        result |= value << i;
+    }
+    return result;
+}
+
+// A mask of the values in word that are not equal to skip, with all bits of
+// each such value set. skip_word is the skip value repeated across the word and
+// high is the top bit of each value.
+static inline uint32_t keep_mask(uint32_t word, uint32_t skip_word, uint32_t high, uint32_t bits) {
+    uint32_t diff = word ^ skip_word;
+    if (bits == 32) {
+        return diff ? 0xffffffff : 0;
+    }
+    // the top bit of each value is set where any bit of the value differs
+    uint32_t nonzero = (((diff & ~high) + ~high) | diff) & high;
+    // spreading a single bit across a value can't carry into the next value
+    return (nonzero >> (bits - 1)) * ((1u << bits) - 1);
+}
+
+// Merge nbytes bytes of src into dst, leaving the values in dst where src
+// holds the skip value. first_mask and last_mask limit the first and last bytes.
+static void merge_skipping(uint8_t *dst, const uint8_t *src, uint32_t nbytes, uint32_t bits, uint32_t skip,
+    uint8_t first_mask, uint8_t last_mask) {
+    uint32_t skip_word = replicate_value(skip, bits);
+    uint32_t high = bits == 32 ? 0 : replicate_value(1u << (bits - 1), bits);
+    for (uint32_t i = 0; i < nbytes;) {
+        if (i != 0 && i + 4 < nbytes) {
+            // four bytes at a time in the middle of the row
+            uint32_t s, d;
+            memcpy(&s, src + i, 4);
+            memcpy(&d, dst + i, 4);
+            uint32_t mask = keep_mask(s, skip_word, high, bits);
+            d = (d & ~mask) | (s & mask);
+            memcpy(dst + i, &d, 4);
+            i += 4;
+            continue;
+        }
+        // a byte, or for wider values a whole value, at a time at the ends
+        uint32_t n = bits > 8 ? bits / 8 : 1;
+        uint32_t s = 0, d = 0;
+        memcpy(&s, src + i, n);
+        memcpy(&d, dst + i, n);
+        uint32_t mask = keep_mask(s, skip_word, high, bits);
+        if (bits < 8) {
+            mask &= i == 0 ? first_mask : 0xff;
+            mask &= i == nbytes - 1 ? last_mask : 0xff;
+        }
+        d = (d & ~mask) | (s & mask);
+        memcpy(dst + i, &d, n);
+        i += n;
+    }
+}
+
+// Write nbits staged bits, from bit `phase` of `staged`, to the same bit of
+// dst, leaving out values equal to skip unless skip_none
+static void write_staged(uint8_t *dst, const uint8_t *staged, uint32_t phase, uint32_t nbits,
+    uint32_t bits, bool skip_none, uint32_t skip) {
+    if (skip_none) {
+        copy_bits(dst, phase, staged, phase, nbits);
+        return;
+    }
+    uint8_t first_mask = 0xff >> phase;
+    uint8_t last_mask = (phase + nbits) % 8 ? bit_span_mask(0, (phase + nbits) % 8) : 0xff;
+    merge_skipping(dst, staged, (phase + nbits + 7) / 8, bits, skip, first_mask, last_mask);
+}
+
+// Blit between bitmaps with the same power of two depth, a row at a time.
+// Returns false if the bitmaps can't be blitted this way.
+static bool blit_rows(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
+    int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none) {
+    uint32_t bits = destination->bits_per_value;
+    if (bits != source->bits_per_value || (bits & (bits - 1)) != 0) {
+        return false;
+    }
+    int16_t width = MIN(x2 - x1, destination->width - x);
+    int16_t height = MIN(y2 - y1, destination->height - y);
+    if (width <= 0 || height <= 0) {
+        return true;
+    }
+    uint32_t nbits = width * bits;
+    uint32_t dst_bit = x * bits;
+    uint32_t src_bit = x1 * bits;
+    uint32_t phase = dst_bit % 8;
+    // Within one bitmap, source rows are staged so that a row can't overwrite
+    // itself, and rows are copied in the order that keeps unread rows intact
+    bool stage = source == destination || !skip_source_index_none;
+    uint32_t tmp[(phase + nbits + 31) / 32 + 1];
+    uint8_t *staged = (uint8_t *)tmp;
+    bool reverse = source == destination && y > y1;
+
+    for (int16_t j = 0; j < height; j++) {
+        int16_t row = reverse ? height - 1 - j : j;
+        if (!source->tiled && !destination->tiled) {
+            const uint8_t *src_row = bitmap_pixel(source, 0, y1 + row);
+            uint8_t *dst_row = bitmap_pixel(destination, 0, y + row);
+            if (!stage) {
+                copy_bits(dst_row, dst_bit, src_row, src_bit, nbits);
+                continue;
+            }
+            // stage the row in phase with the destination
+            copy_bits(staged, phase, src_row, src_bit, nbits);
+            write_staged(dst_row + dst_bit / 8, staged, phase, nbits, bits, skip_source_index_none, skip_source_index);
+            continue;
+        }
+        // Tiled rows are stored in pieces, so copy a piece at a time
+        for (int16_t i = 0, n; i < width; i += n) {
+            n = MIN(width - i, displayio_bitmap_row_run(source, x1 + i));
+            if (!stage) {
+                n = MIN(n, displayio_bitmap_row_run(destination, x + i));
+                copy_bits(bitmap_pixel(destination, x + i, y + row), ((x + i) & destination->x_mask) * bits,
+                    bitmap_pixel(source, x1 + i, y1 + row), ((x1 + i) & source->x_mask) * bits, n * bits);
+            } else {
+                copy_bits(staged, phase + i * bits,
+                    bitmap_pixel(source, x1 + i, y1 + row), ((x1 + i) & source->x_mask) * bits, n * bits);
+            }
+        }
+        // The whole row is staged before any of it is written, as a piece of
+        // the destination may be a later piece of the source
+        for (int16_t i = 0, n; stage && i < width; i += n) {
+            n = MIN(width - i, displayio_bitmap_row_run(destination, x + i));
+            uint32_t at = phase + i * bits;
+            write_staged(bitmap_pixel(destination, x + i, y + row), staged + at / 8, at % 8, n * bits,
+                bits, skip_source_index_none, skip_source_index);
+        }
+    }
+    return true;
+}
+
 void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
     int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index,
     bool skip_dest_index_none) {
@@ -1116,6 +1486,10 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
         y_reverse = true;
     }
 
+    if (skip_dest_index_none && blit_rows(destination, source, x, y, x1, y1, x2, y2, skip_source_index, skip_source_index_none)) {
+        return;
+    }
+
     // simplest version - use internal functions for get/set pixels
     for (int16_t i = 0; i < (x2 - x1); i++) {
 
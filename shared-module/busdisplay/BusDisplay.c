@@ -22,6 +22,7 @@
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
 #include "shared-module/displayio/display_core.h"
+#include "supervisor/port_heap.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
 
@@ -34,6 +35,10 @@
 
 #define DELAY 0x80
 
+// Granularity, in pixels, at which the retained framebuffer is compared to
+// newly rendered pixels to decide what needs to be sent over the bus.
+#define RETAINED_TILE_SIZE (16)
+
 void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *self,
     mp_obj_t bus, uint16_t width, uint16_t height, int16_t colstart, int16_t rowstart,
     uint16_t rotation, uint16_t color_depth, bool grayscale, bool pixels_in_byte_share_row,
@@ -218,6 +223,78 @@ static void _send_pixels(busdisplay_busdisplay_obj_t *self, uint8_t *pixels, uin
     self->bus.send(self->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, pixels, length);
 }
 
+// Compare the freshly rendered pixels of subrectangle (in buffer) with the
+// retained framebuffer one tile at a time, and only send horizontal runs of
+// tiles that actually changed.
+static bool _send_changed_tiles(busdisplay_busdisplay_obj_t *self, const displayio_area_t *subrectangle, const uint8_t *buffer) {
+    const uint8_t bytes_per_pixel = self->core.colorspace.depth / 8;
+    const uint32_t retained_stride = self->core.area.x2 * bytes_per_pixel;
+    const uint32_t buffer_stride = displayio_area_width(subrectangle) * bytes_per_pixel;
+    const uint16_t first_tile = subrectangle->x1 / RETAINED_TILE_SIZE;
+    const uint16_t tile_count = (subrectangle->x2 - 1) / RETAINED_TILE_SIZE - first_tile + 1;
+    bool changed[tile_count];
+
+    int16_t band_y1 = subrectangle->y1;
+    while (band_y1 < subrectangle->y2) {
+        int16_t band_y2 = MIN(subrectangle->y2, (band_y1 / RETAINED_TILE_SIZE + 1) * RETAINED_TILE_SIZE);
+
+        for (uint16_t t = 0; t < tile_count; t++) {
+            int16_t x1 = MAX(subrectangle->x1, (first_tile + t) * RETAINED_TILE_SIZE);
+            int16_t x2 = MIN(subrectangle->x2, (first_tile + t + 1) * RETAINED_TILE_SIZE);
+            uint32_t span = (x2 - x1) * bytes_per_pixel;
+            changed[t] = !self->retained_buffer_valid;
+            for (int16_t y = band_y1; y < band_y2; y++) {
+                const uint8_t *src = buffer + (y - subrectangle->y1) * buffer_stride + (x1 - subrectangle->x1) * bytes_per_pixel;
+                uint8_t *dest = self->retained_buffer + y * retained_stride + x1 * bytes_per_pixel;
+                if (changed[t] || memcmp(dest, src, span) != 0) {
+                    changed[t] = true;
+                    memcpy(dest, src, span);
+                }
+            }
+        }
+
+        uint16_t t = 0;
+        while (t < tile_count) {
+            if (!changed[t]) {
+                t++;
+                continue;
+            }
+            uint16_t run_start = t;
+            while (t < tile_count && changed[t]) {
+                t++;
+            }
+            displayio_area_t run = {
+                .x1 = MAX(subrectangle->x1, (first_tile + run_start) * RETAINED_TILE_SIZE),
+                .y1 = band_y1,
+                .x2 = MIN(subrectangle->x2, (first_tile + t) * RETAINED_TILE_SIZE),
+                .y2 = band_y2,
+            };
+            uint32_t run_bytes = displayio_area_width(&run) * bytes_per_pixel;
+
+            displayio_display_bus_set_region_to_update(&self->bus, &self->core, &run);
+            if (!displayio_display_bus_begin_transaction(&self->bus)) {
+                return false;
+            }
+            if (!self->bus.data_as_commands) {
+                self->bus.send(self->bus.bus, DISPLAY_COMMAND, CHIP_SELECT_TOGGLE_EVERY_BYTE, &self->write_ram_command, 1);
+            }
+            const uint8_t *row = buffer + (run.y1 - subrectangle->y1) * buffer_stride + (run.x1 - subrectangle->x1) * bytes_per_pixel;
+            if (run_bytes == buffer_stride) {
+                // Rows are contiguous in the buffer so send them all at once.
+                self->bus.send(self->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, (uint8_t *)row, run_bytes * displayio_area_height(&run));
+            } else {
+                for (int16_t y = run.y1; y < run.y2; y++) {
+                    self->bus.send(self->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, (uint8_t *)row, run_bytes);
+                    row += buffer_stride;
+                }
+            }
+            displayio_display_bus_end_transaction(&self->bus);
+        }
+        band_y1 = band_y2;
+    }
+    return true;
+}
+
 static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area) {
     uint16_t buffer_size = CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE / sizeof(uint32_t); // In uint32_ts
 
@@ -291,14 +368,22 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
 
         displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
 
-        displayio_display_bus_set_region_to_update(&self->bus, &self->core, &subrectangle);
+        if (self->retained_buffer != NULL) {
+            if (!_send_changed_tiles(self, &subrectangle, (uint8_t *)buffer)) {
+                // The retained buffer no longer matches the display so resend everything next time.
+                self->retained_buffer_valid = false;
+                return false;
+            }
+        } else {
+            displayio_display_bus_set_region_to_update(&self->bus, &self->core, &subrectangle);
 
-        // Can't acquire display bus; skip the rest of the data.
-        if (!displayio_display_bus_begin_transaction(&self->bus)) {
-            return false;
+            // Can't acquire display bus; skip the rest of the data.
+            if (!displayio_display_bus_begin_transaction(&self->bus)) {
+                return false;
+            }
+            _send_pixels(self, (uint8_t *)buffer, subrectangle_size_bytes);
+            displayio_display_bus_end_transaction(&self->bus);
         }
-        _send_pixels(self, (uint8_t *)buffer, subrectangle_size_bytes);
-        displayio_display_bus_end_transaction(&self->bus);
 
         // Run background tasks so they can run during an explicit refresh.
         // Auto-refresh won't run background tasks here because it is a background task itself.
@@ -326,12 +411,22 @@ static void _refresh_display(busdisplay_busdisplay_obj_t *self) {
         return;
     }
 
+    // The retained buffer only becomes valid once a full refresh has been sent.
+    bool full_refresh = self->core.full_refresh;
+    bool ok = true;
     const displayio_area_t *current_area = _get_refresh_areas(self);
     while (current_area != NULL) {
-        _refresh_area(self, current_area);
+        ok = _refresh_area(self, current_area) && ok;
         current_area = current_area->next;
     }
     displayio_display_core_finish_refresh(&self->core);
+    if (self->retained_buffer != NULL) {
+        if (full_refresh && ok) {
+            self->retained_buffer_valid = true;
+        } else if (!self->retained_buffer_valid) {
+            self->core.full_refresh = true;
+        }
+    }
 }
 
 void common_hal_busdisplay_busdisplay_set_rotation(busdisplay_busdisplay_obj_t *self, int rotation) {
@@ -343,6 +438,10 @@ void common_hal_busdisplay_busdisplay_set_rotation(busdisplay_busdisplay_obj_t *
         self->core.height = tmp;
     }
     displayio_display_core_set_rotation(&self->core, rotation);
+    // The retained copy is laid out for the old rotation. It stays the same size because
+    // the area's width and height only swap.
+    self->retained_buffer_valid = false;
+    self->core.full_refresh = true;
     if (self == &displays[0].display) {
         supervisor_stop_terminal();
         supervisor_start_terminal(self->core.width, self->core.height);
@@ -382,6 +481,30 @@ bool common_hal_busdisplay_busdisplay_refresh(busdisplay_busdisplay_obj_t *self,
     return true;
 }
 
+bool common_hal_busdisplay_busdisplay_get_retained_framebuffer(busdisplay_busdisplay_obj_t *self) {
+    return self->retained_buffer != NULL;
+}
+
+void common_hal_busdisplay_busdisplay_set_retained_framebuffer(busdisplay_busdisplay_obj_t *self, bool retained) {
+    if (retained == (self->retained_buffer != NULL)) {
+        return;
+    }
+    self->retained_buffer_valid = false;
+    if (!retained) {
+        port_free(self->retained_buffer);
+        self->retained_buffer = NULL;
+        return;
+    }
+    // Allocated outside the VM heap, preferring PSRAM, so it survives reloads along with the display.
+    size_t len = self->core.area.x2 * self->core.area.y2 * (self->core.colorspace.depth / 8);
+    self->retained_buffer = port_malloc(len, false);
+    if (self->retained_buffer == NULL) {
+        m_malloc_fail(len);
+    }
+    // Send everything once so the display memory matches the retained copy.
+    self->core.full_refresh = true;
+}
+
 bool common_hal_busdisplay_busdisplay_get_auto_refresh(busdisplay_busdisplay_obj_t *self) {
     return self->auto_refresh;
 }
@@ -415,6 +538,7 @@ void busdisplay_busdisplay_background(busdisplay_busdisplay_obj_t *self) {
 
 void release_busdisplay(busdisplay_busdisplay_obj_t *self) {
     common_hal_busdisplay_busdisplay_set_auto_refresh(self, false);
+    common_hal_busdisplay_busdisplay_set_retained_framebuffer(self, false);
     release_display_core(&self->core);
     #if (CIRCUITPY_PWMIO)
     if (self->backlight_pwm.base.type == &pwmio_pwmout_type) {
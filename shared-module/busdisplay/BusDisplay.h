@@ -27,6 +27,9 @@ typedef struct {
         #endif
     };
     uint64_t last_refresh_call;
+    // Copy of the pixels last sent to the display, in native format, when
+    // retained_framebuffer is enabled. NULL otherwise.
+    uint8_t *retained_buffer;
     mp_float_t current_brightness;
     uint16_t brightness_command;
     uint16_t native_frames_per_second;
@@ -35,6 +38,8 @@ typedef struct {
     bool auto_refresh;
     bool first_manual_refresh;
     bool backlight_on_high;
+    // True once retained_buffer matches what is in the display's memory.
+    bool retained_buffer_valid;
 } busdisplay_busdisplay_obj_t;
 
 void busdisplay_busdisplay_background(busdisplay_busdisplay_obj_t *self);
@@ -19,19 +19,29 @@ static int stride(uint32_t width, uint32_t bits_per_value) {
     return (row_width + ALIGN_BITS - 1) / ALIGN_BITS;
 }
 
-void common_hal_displayio_bitmap_construct(displayio_bitmap_t *self, uint32_t width,
-    uint32_t height, uint32_t bits_per_value) {
-    common_hal_displayio_bitmap_construct_from_buffer(self, width, height, bits_per_value, NULL, false);
+// The number of uint32_t's in the bitmap's data
+static size_t data_words(displayio_bitmap_t *self) {
+    if (self->tiled) {
+        return self->stride * ((self->height + DISPLAYIO_BITMAP_TILE_MASK) >> DISPLAYIO_BITMAP_TILE_SHIFT);
+    }
+    return self->stride * self->height;
 }
 
-void common_hal_displayio_bitmap_construct_from_buffer(displayio_bitmap_t *self, uint32_t width,
-    uint32_t height, uint32_t bits_per_value, uint32_t *data, bool read_only) {
+static void bitmap_construct(displayio_bitmap_t *self, uint32_t width,
+    uint32_t height, uint32_t bits_per_value, uint32_t *data, bool read_only, bool tiled) {
     self->width = width;
     self->height = height;
-    self->stride = stride(width, bits_per_value);
+    self->tiled = tiled;
+    if (tiled) {
+        // Every tile is a whole number of uint32_t's
+        uint32_t tiles = (width + DISPLAYIO_BITMAP_TILE_MASK) >> DISPLAYIO_BITMAP_TILE_SHIFT;
+        self->stride = tiles * DISPLAYIO_BITMAP_TILE_SIZE * DISPLAYIO_BITMAP_TILE_SIZE * bits_per_value / ALIGN_BITS;
+    } else {
+        self->stride = stride(width, bits_per_value);
+    }
     self->data_alloc = false;
     if (!data) {
-        data = m_malloc_without_collect(self->stride * height * sizeof(uint32_t));
+        data = m_malloc_without_collect(data_words(self) * sizeof(uint32_t));
         self->data_alloc = true;
     }
     self->data = data;
@@ -56,10 +66,26 @@ void common_hal_displayio_bitmap_construct_from_buffer(displayio_bitmap_t *self,
     self->x_mask = (1u << self->x_shift) - 1u; // Used as a modulus on the x value
     self->bitmask = (1u << bits_per_value) - 1u;
 
-    self->dirty_area.x1 = 0;
-    self->dirty_area.x2 = width;
-    self->dirty_area.y1 = 0;
-    self->dirty_area.y2 = height;
+    self->dirty_areas[0].x1 = 0;
+    self->dirty_areas[0].x2 = width;
+    self->dirty_areas[0].y1 = 0;
+    self->dirty_areas[0].y2 = height;
+    self->dirty_area_count = 1;
+}
+
+void common_hal_displayio_bitmap_construct(displayio_bitmap_t *self, uint32_t width,
+    uint32_t height, uint32_t bits_per_value) {
+    bitmap_construct(self, width, height, bits_per_value, NULL, false, false);
+}
+
+void common_hal_displayio_bitmap_construct_tiled(displayio_bitmap_t *self, uint32_t width,
+    uint32_t height, uint32_t bits_per_value) {
+    bitmap_construct(self, width, height, bits_per_value, NULL, false, true);
+}
+
+void common_hal_displayio_bitmap_construct_from_buffer(displayio_bitmap_t *self, uint32_t width,
+    uint32_t height, uint32_t bits_per_value, uint32_t *data, bool read_only) {
+    bitmap_construct(self, width, height, bits_per_value, data, read_only, false);
 }
 
 void common_hal_displayio_bitmap_deinit(displayio_bitmap_t *self) {
@@ -85,25 +111,28 @@ uint32_t common_hal_displayio_bitmap_get_bits_per_value(displayio_bitmap_t *self
     return self->bits_per_value;
 }
 
+bool common_hal_displayio_bitmap_get_tiled(displayio_bitmap_t *self) {
+    return self->tiled;
+}
+
 uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t x, int16_t y) {
     if (x >= self->width || x < 0 || y >= self->height || y < 0) {
         return 0;
     }
-    int32_t row_start = y * self->stride;
-    uint32_t *row = self->data + row_start;
+    const uint8_t *pixel = (const uint8_t *)self->data + displayio_bitmap_byte_offset(self, x, y);
     uint8_t bytes_per_value = self->bits_per_value / 8;
     uint8_t values_per_byte = 8 / self->bits_per_value;
     if (bytes_per_value < 1) {
-        uint8_t bits = ((uint8_t *)row)[x >> self->x_shift];
+        uint8_t bits = *pixel;
         uint8_t bit_position = (values_per_byte - (x & self->x_mask) - 1) * self->bits_per_value;
         return (bits >> bit_position) & self->bitmask;
     } else {
         if (bytes_per_value == 1) {
-            return ((uint8_t *)row)[x];
+            return *pixel;
         } else if (bytes_per_value == 2) {
-            return ((uint16_t *)row)[x];
+            return *(const uint16_t *)(const void *)pixel;
         } else if (bytes_per_value == 4) {
-            return ((uint32_t *)row)[x];
+            return *(const uint32_t *)(const void *)pixel;
         }
     }
     return 0;
@@ -116,9 +145,12 @@ void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_a
 
     displayio_area_t area = *dirty_area;
     displayio_area_canon(&area);
-    displayio_area_union(&area, &self->dirty_area, &area);
     displayio_area_t bitmap_area = {0, 0, self->width, self->height, NULL};
-    displayio_area_compute_overlap(&area, &bitmap_area, &self->dirty_area);
+    if (!displayio_area_compute_overlap(&area, &bitmap_area, &area)) {
+        return;
+    }
+    self->dirty_area_count = displayio_area_add_to_set(self->dirty_areas, self->dirty_area_count,
+        DISPLAYIO_DIRTY_AREA_COUNT, &area);
 }
 
 void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
@@ -134,23 +166,22 @@ void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y
     }
 
     // Update one pixel of data
-    int32_t row_start = y * self->stride;
-    uint32_t *row = self->data + row_start;
+    uint8_t *pixel = (uint8_t *)self->data + displayio_bitmap_byte_offset(self, x, y);
     uint8_t bytes_per_value = self->bits_per_value / 8;
     uint8_t values_per_byte = 8 / self->bits_per_value;
     if (bytes_per_value < 1) {
-        uint8_t bits = ((uint8_t *)row)[x >> self->x_shift];
+        uint8_t bits = *pixel;
         uint8_t bit_position = (values_per_byte - (x & self->x_mask) - 1) * self->bits_per_value;
         bits &= ~(self->bitmask << bit_position);
         bits |= (value & self->bitmask) << bit_position;
-        ((uint8_t *)row)[x >> self->x_shift] = bits;
+        *pixel = bits;
     } else {
         if (bytes_per_value == 1) {
-            ((uint8_t *)row)[x] = value;
+            *pixel = value;
         } else if (bytes_per_value == 2) {
-            ((uint16_t *)row)[x] = value;
+            *(uint16_t *)(void *)pixel = value;
         } else if (bytes_per_value == 4) {
-            ((uint32_t *)row)[x] = value;
+            *(uint32_t *)(void *)pixel = value;
         }
     }
 }
@@ -169,19 +200,21 @@ void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x,
 }
 
 displayio_area_t *displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, displayio_area_t *tail) {
-    if (self->dirty_area.x1 == self->dirty_area.x2 || self->read_only) {
+    if (self->dirty_area_count == 0 || self->read_only) {
         return tail;
     }
-    self->dirty_area.next = tail;
-    return &self->dirty_area;
+    for (uint8_t i = 0; i < self->dirty_area_count; i++) {
+        self->dirty_areas[i].next = tail;
+        tail = &self->dirty_areas[i];
+    }
+    return tail;
 }
 
 void displayio_bitmap_finish_refresh(displayio_bitmap_t *self) {
     if (self->read_only) {
         return;
     }
-    self->dirty_area.x1 = 0;
-    self->dirty_area.x2 = 0;
+    self->dirty_area_count = 0;
 }
 
 void common_hal_displayio_bitmap_fill(displayio_bitmap_t *self, uint32_t value) {
@@ -197,7 +230,8 @@ void common_hal_displayio_bitmap_fill(displayio_bitmap_t *self, uint32_t value)
         word |= (value & self->bitmask) << (32 - ((i + 1) * self->bits_per_value));
     }
     // copy it in
-    for (uint32_t i = 0; i < self->stride * self->height; i++) {
+    size_t words = data_words(self);
+    for (size_t i = 0; i < words; i++) {
         self->data[i] = word;
     }
 }
@@ -206,7 +240,7 @@ int common_hal_displayio_bitmap_get_buffer(displayio_bitmap_t *self, mp_buffer_i
     if ((flags & MP_BUFFER_WRITE) && self->read_only) {
         return 1;
     }
-    bufinfo->len = self->stride * self->height * sizeof(uint32_t);
+    bufinfo->len = data_words(self) * sizeof(uint32_t);
     bufinfo->buf = self->data;
     switch (self->bits_per_value) {
         case 32:
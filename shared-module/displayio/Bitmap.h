@@ -17,16 +17,45 @@ typedef struct {
     uint16_t width;
     uint16_t height;
     uint32_t *data;
-    uint16_t stride; // uint32_t's
+    uint32_t stride; // uint32_t's in a row, or in a row of tiles when tiled
     uint8_t bits_per_value;
     uint8_t x_shift;
     size_t x_mask;
-    displayio_area_t dirty_area;
+    displayio_area_t dirty_areas[DISPLAYIO_DIRTY_AREA_COUNT];
+    uint8_t dirty_area_count;
     uint16_t bitmask;
     bool read_only;
     bool data_alloc; // did bitmap allocate data or someone else
+    bool tiled;
 } displayio_bitmap_t;
 
+// A tiled bitmap stores its pixels in square tiles, one row of tiles after
+// another, with the rows of each tile together. Pixels above and below each
+// other are then close in memory too.
+#define DISPLAYIO_BITMAP_TILE_SHIFT (3)
+#define DISPLAYIO_BITMAP_TILE_SIZE (1 << DISPLAYIO_BITMAP_TILE_SHIFT)
+#define DISPLAYIO_BITMAP_TILE_MASK (DISPLAYIO_BITMAP_TILE_SIZE - 1)
+
+// The offset of the byte holding pixel (x, y) from the start of the data. A
+// tile's row is a whole number of bytes for every depth.
+static inline size_t displayio_bitmap_byte_offset(const displayio_bitmap_t *self, int x, int y) {
+    uint32_t bits = self->bits_per_value;
+    if (self->tiled) {
+        size_t tile = (size_t)(y >> DISPLAYIO_BITMAP_TILE_SHIFT) * self->stride * sizeof(uint32_t) +
+            (x >> DISPLAYIO_BITMAP_TILE_SHIFT) * DISPLAYIO_BITMAP_TILE_SIZE * bits;
+        return tile + (y & DISPLAYIO_BITMAP_TILE_MASK) * bits + (((x & DISPLAYIO_BITMAP_TILE_MASK) * bits) >> 3);
+    }
+    return (size_t)y * self->stride * sizeof(uint32_t) + ((x * bits) >> 3);
+}
+
+// The number of pixels of the row from x on that are stored one after another
+static inline int displayio_bitmap_row_run(const displayio_bitmap_t *self, int x) {
+    if (self->tiled) {
+        return MIN(DISPLAYIO_BITMAP_TILE_SIZE - (x & DISPLAYIO_BITMAP_TILE_MASK), self->width - x);
+    }
+    return self->width - x;
+}
+
 void displayio_bitmap_finish_refresh(displayio_bitmap_t *self);
 displayio_area_t *displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, displayio_area_t *tail);
 void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_area_t *area);
@@ -6,19 +6,95 @@
 
 #include "shared-bindings/displayio/ColorConverter.h"
 
+#include <string.h>
+
 #include "py/misc.h"
 #include "py/runtime.h"
 
 #define NO_TRANSPARENT_COLOR (0x1000000)
 
-uint32_t displayio_colorconverter_dither_noise_1(uint32_t n) {
-    n = (n >> 13) ^ n;
-    int nn = (n * (n * n * 60493 + 19990303) + 1376312589) & 0x7fffffff;
-    return (uint32_t)(((float)nn / (1073741824.0f * 2)) * 255);
+// 4x4 Bayer matrix for ordered dithering. Thresholds are 0-15.
+static const uint8_t dither_thresholds[4][4] = {
+    { 0, 8, 2, 10 },
+    { 12, 4, 14, 6 },
+    { 3, 11, 1, 9 },
+    { 15, 7, 13, 5 },
+};
+
+// Add the ordered dither threshold for (x, y) to each channel so that truncating to the
+// colorspace's depth rounds up or down in a fixed pattern.
+static uint32_t displayio_colorconverter_dither_pixel(const _displayio_colorspace_t *colorspace, uint32_t pixel, uint16_t x, uint16_t y) {
+    uint32_t threshold = dither_thresholds[y & 3][x & 3];
+    uint32_t r8 = (pixel >> 16);
+    uint32_t g8 = (pixel >> 8) & 0xff;
+    uint32_t b8 = pixel & 0xff;
+
+    if (colorspace->depth == 16) {
+        b8 = MIN(255, b8 + (threshold >> 1));
+        r8 = MIN(255, r8 + (threshold >> 1));
+        g8 = MIN(255, g8 + (threshold >> 2));
+    } else {
+        uint32_t offset = threshold * ((0xFF >> colorspace->depth) + 1) / 16;
+        b8 = MIN(255, b8 + offset);
+        r8 = MIN(255, r8 + offset);
+        g8 = MIN(255, g8 + offset);
+    }
+    return r8 << 16 | g8 << 8 | b8;
+}
+
+void displayio_colorconverter_dither_row(const _displayio_colorspace_t *colorspace, uint32_t *rgb888, uint32_t count, uint16_t x, uint16_t y) {
+    for (uint32_t i = 0; i < count; i++) {
+        rgb888[i] = displayio_colorconverter_dither_pixel(colorspace, rgb888[i], x + i, y);
+    }
 }
 
-uint32_t displayio_colorconverter_dither_noise_2(uint32_t x, uint32_t y) {
-    return displayio_colorconverter_dither_noise_1(x + y * 0xFFFF);
+void displayio_colorconverter_rgb888_to_rgb565_row(uint32_t *pixels, uint32_t count, bool swap) {
+    // Kept branch free inside the loop so it can be unrolled and vectorized.
+    if (swap) {
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t p = pixels[i];
+            pixels[i] = __builtin_bswap16(((p >> 8) & 0xf800) | ((p >> 5) & 0x07e0) | ((p >> 3) & 0x001f));
+        }
+    } else {
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t p = pixels[i];
+            pixels[i] = ((p >> 8) & 0xf800) | ((p >> 5) & 0x07e0) | ((p >> 3) & 0x001f);
+        }
+    }
+}
+
+void displayio_colorconverter_rgb565_to_rgb888_row(const uint32_t *input, uint32_t *rgb888, uint32_t count, bool swapped) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t p = swapped ? __builtin_bswap16(input[i]) : input[i];
+        uint32_t r8 = (p >> 11) << 3;
+        uint32_t g8 = ((p >> 5) << 2) & 0xff;
+        uint32_t b8 = (p << 3) & 0xff;
+        rgb888[i] = (r8 << 16) | (g8 << 8) | b8;
+    }
+}
+
+void displayio_colorconverter_rgb565_swap_row(const uint16_t *input, uint16_t *output, uint32_t count) {
+    uint32_t i = 0;
+    // Swap two pixels at a time when both buffers are word aligned.
+    if ((((uintptr_t)input | (uintptr_t)output) & 3) == 0) {
+        const uint32_t *input_words = (const uint32_t *)input;
+        uint32_t *output_words = (uint32_t *)output;
+        for (; i + 1 < count; i += 2) {
+            uint32_t w = input_words[i / 2];
+            output_words[i / 2] = ((w & 0x00ff00ff) << 8) | ((w >> 8) & 0x00ff00ff);
+        }
+    }
+    for (; i < count; i++) {
+        output[i] = __builtin_bswap16(input[i]);
+    }
+}
+
+void displayio_colorconverter_rgb888_to_luma_row(uint32_t *pixels, uint32_t count, uint8_t shift, uint8_t mask) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t p = pixels[i];
+        uint32_t luma = (((p >> 16) & 0xff) * 19 + ((p >> 8) & 0xff) * 182 + (p & 0xff) * 54) / 255;
+        pixels[i] = (luma >> shift) & mask;
+    }
 }
 
 void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t *self, bool dither, displayio_colorspace_t input_colorspace) {
@@ -303,25 +379,7 @@ uint32_t displayio_colorconverter_convert_pixel(displayio_colorspace_t colorspac
 void displayio_convert_color(const _displayio_colorspace_t *colorspace, bool dither, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t pixel = input_pixel->pixel;
     if (dither) {
-        uint8_t randr = (displayio_colorconverter_dither_noise_2(input_pixel->tile_x, input_pixel->tile_y));
-        uint8_t randg = (displayio_colorconverter_dither_noise_2(input_pixel->tile_x + 33, input_pixel->tile_y));
-        uint8_t randb = (displayio_colorconverter_dither_noise_2(input_pixel->tile_x, input_pixel->tile_y + 33));
-
-        uint32_t r8 = (pixel >> 16);
-        uint32_t g8 = (pixel >> 8) & 0xff;
-        uint32_t b8 = pixel & 0xff;
-
-        if (colorspace->depth == 16) {
-            b8 = MIN(255, b8 + (randb & 0x07));
-            r8 = MIN(255, r8 + (randr & 0x07));
-            g8 = MIN(255, g8 + (randg & 0x03));
-        } else {
-            int bitmask = 0xFF >> colorspace->depth;
-            b8 = MIN(255, b8 + (randb & bitmask));
-            r8 = MIN(255, r8 + (randr & bitmask));
-            g8 = MIN(255, g8 + (randg & bitmask));
-        }
-        pixel = r8 << 16 | g8 << 8 | b8;
+        pixel = displayio_colorconverter_dither_pixel(colorspace, pixel, input_pixel->tile_x, input_pixel->tile_y);
     }
 
     if (colorspace->depth == 16) {
@@ -400,7 +458,86 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
     }
 }
 
+bool displayio_colorconverter_convert_row(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const uint32_t *input, uint32_t *output, uint32_t count, uint16_t x, uint16_t y) {
+    bool rgb565_input = self->input_colorspace == DISPLAYIO_COLORSPACE_RGB565 ||
+        self->input_colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED;
+    bool rgb565_swapped = self->input_colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED;
+
+    // RGB565 to RGB565 is lossless so skip RGB888 and at most swap the bytes.
+    if (rgb565_input && colorspace->depth == 16 && !self->dither) {
+        if (rgb565_swapped != colorspace->reverse_bytes_in_word) {
+            for (uint32_t i = 0; i < count; i++) {
+                output[i] = __builtin_bswap16(input[i]);
+            }
+        } else {
+            for (uint32_t i = 0; i < count; i++) {
+                output[i] = input[i] & 0xffff;
+            }
+        }
+        return true;
+    }
+
+    // Unpack the whole row to RGB888 first, in place in output.
+    if (self->input_colorspace == DISPLAYIO_COLORSPACE_RGB888) {
+        if (output != input) {
+            memmove(output, input, count * sizeof(uint32_t));
+        }
+    } else if (rgb565_input) {
+        displayio_colorconverter_rgb565_to_rgb888_row(input, output, count, rgb565_swapped);
+    } else {
+        for (uint32_t i = 0; i < count; i++) {
+            output[i] = displayio_colorconverter_convert_pixel(self->input_colorspace, input[i]);
+        }
+    }
+
+    if (self->dither) {
+        displayio_colorconverter_dither_row(colorspace, output, count, x, y);
+    }
 
+    if (colorspace->depth == 16) {
+        displayio_colorconverter_rgb888_to_rgb565_row(output, count, colorspace->reverse_bytes_in_word);
+    } else if (colorspace->grayscale && colorspace->depth <= 8 && !colorspace->tricolor && !colorspace->fourcolor) {
+        displayio_colorconverter_rgb888_to_luma_row(output, count, colorspace->grayscale_bit, (1 << colorspace->depth) - 1);
+    } else if (colorspace->depth != 32 && colorspace->depth != 24) {
+        // Less common output formats go through the per-pixel conversion.
+        displayio_input_pixel_t input_pixel = { 0 };
+        displayio_output_pixel_t output_pixel = { 0 };
+        for (uint32_t i = 0; i < count; i++) {
+            input_pixel.pixel = output[i];
+            displayio_convert_color(colorspace, false, &input_pixel, &output_pixel);
+            output[i] = output_pixel.pixel;
+        }
+        // Whether a colorspace is supported doesn't depend on the pixel
+        return count == 0 || output_pixel.opaque;
+    }
+    return true;
+}
+
+void common_hal_displayio_colorconverter_convert_row(displayio_colorconverter_t *self, const void *input, size_t input_itemsize, uint16_t *output, uint32_t count, uint16_t x, uint16_t y) {
+    // Fast path for only swapping bytes between RGB565 buffers.
+    if (input_itemsize == 2 && !self->dither && self->input_colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED) {
+        displayio_colorconverter_rgb565_swap_row(input, output, count);
+        return;
+    }
+    // Work in chunks so the intermediate values fit on the stack.
+    uint32_t chunk[64];
+    for (uint32_t start = 0; start < count; start += MP_ARRAY_SIZE(chunk)) {
+        uint32_t n = MIN(count - start, MP_ARRAY_SIZE(chunk));
+        for (uint32_t i = 0; i < n; i++) {
+            if (input_itemsize == 4) {
+                chunk[i] = ((const uint32_t *)input)[start + i];
+            } else if (input_itemsize == 2) {
+                chunk[i] = ((const uint16_t *)input)[start + i];
+            } else {
+                chunk[i] = ((const uint8_t *)input)[start + i];
+            }
+        }
+        displayio_colorconverter_convert_row(self, &self->output_colorspace, chunk, chunk, n, x + start, y);
+        for (uint32_t i = 0; i < n; i++) {
+            output[start + i] = chunk[i];
+        }
+    }
+}
 
 // Currently no refresh logic is needed for a ColorConverter.
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self) {
@@ -29,8 +29,18 @@ bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_finish_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
 
-uint32_t displayio_colorconverter_dither_noise_1(uint32_t n);
-uint32_t displayio_colorconverter_dither_noise_2(uint32_t x, uint32_t y);
+// Convert count pixels of a single row, starting at (x, y), from the converter's input colorspace
+// to colorspace. output may be the same as input. Transparency is not checked. Returns false if
+// colorspace isn't one that can be converted to, in which case no pixel is opaque.
+bool displayio_colorconverter_convert_row(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const uint32_t *input, uint32_t *output, uint32_t count, uint16_t x, uint16_t y);
+
+// Row kernels used by displayio_colorconverter_convert_row. They work on whole rows with no per
+// pixel branching on format.
+void displayio_colorconverter_dither_row(const _displayio_colorspace_t *colorspace, uint32_t *rgb888, uint32_t count, uint16_t x, uint16_t y);
+void displayio_colorconverter_rgb888_to_rgb565_row(uint32_t *pixels, uint32_t count, bool swap);
+void displayio_colorconverter_rgb565_to_rgb888_row(const uint32_t *input, uint32_t *rgb888, uint32_t count, bool swapped);
+void displayio_colorconverter_rgb565_swap_row(const uint16_t *input, uint16_t *output, uint32_t count);
+void displayio_colorconverter_rgb888_to_luma_row(uint32_t *pixels, uint32_t count, uint8_t shift, uint8_t mask);
 
 // Convert version that doesn't require a colorconverter object.
 void displayio_convert_color(const _displayio_colorspace_t *colorspace, bool dither, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
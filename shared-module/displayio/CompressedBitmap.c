@@ -0,0 +1,220 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/displayio/CompressedBitmap.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/displayio/Bitmap.h"
+
+static const uint8_t magic[4] = { 'R', 'L', 'E', 'B' };
+
+static uint32_t read_value(const uint8_t *p, uint8_t size) {
+    switch (size) {
+        case 1:
+            return p[0];
+        case 2:
+            return p[0] | (p[1] << 8);
+        default:
+            return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+}
+
+static void invalid_data(void) {
+    mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_data);
+}
+
+void common_hal_displayio_compressedbitmap_construct(displayio_compressedbitmap_t *self, mp_obj_t data_obj,
+    const uint8_t *data, size_t len) {
+    if (len < DISPLAYIO_COMPRESSEDBITMAP_HEADER_SIZE || memcmp(data, magic, sizeof(magic)) != 0) {
+        invalid_data();
+    }
+    uint16_t width = read_value(data + 4, 2);
+    uint16_t height = read_value(data + 6, 2);
+    uint8_t bits_per_value = data[8];
+    if (width == 0 || height == 0 || bits_per_value == 0 || bits_per_value > 32 ||
+        (bits_per_value & (bits_per_value - 1)) != 0) {
+        invalid_data();
+    }
+    uint8_t value_size = bits_per_value <= 8 ? 1 : bits_per_value / 8;
+    const uint8_t *row_index = data + DISPLAYIO_COMPRESSEDBITMAP_HEADER_SIZE;
+    if (len < DISPLAYIO_COMPRESSEDBITMAP_HEADER_SIZE + 4 * (size_t)height) {
+        invalid_data();
+    }
+
+    // Check every row once so that get_pixel can trust the packets.
+    for (uint16_t y = 0; y < height; y++) {
+        size_t offset = read_value(row_index + 4 * y, 4);
+        uint32_t x = 0;
+        while (x < width) {
+            if (offset >= len) {
+                invalid_data();
+            }
+            uint8_t n = data[offset];
+            uint32_t count = (n & ~DISPLAYIO_COMPRESSEDBITMAP_RUN) + 1;
+            offset += 1 + ((n & DISPLAYIO_COMPRESSEDBITMAP_RUN) ? 1 : count) * value_size;
+            x += count;
+        }
+        if (x != width || offset > len) {
+            invalid_data();
+        }
+    }
+
+    self->width = width;
+    self->height = height;
+    self->data_obj = data_obj;
+    self->data = data;
+    self->row_index = row_index;
+    self->bits_per_value = bits_per_value;
+    self->value_size = value_size;
+    self->cursor_y = 0xffff;
+    self->packet_x = 0;
+    self->packet = 0;
+    self->row_cache = m_malloc_without_collect(width * value_size);
+    self->cached_y = 0xffff;
+}
+
+static void decode_row(displayio_compressedbitmap_t *self, uint16_t y) {
+    uint8_t value_size = self->value_size;
+    const uint8_t *packet = self->data + read_value(self->row_index + 4 * y, 4);
+    uint8_t *out = self->row_cache;
+    uint8_t *end = out + self->width * value_size;
+    while (out < end) {
+        uint8_t n = *packet;
+        uint32_t count = (n & ~DISPLAYIO_COMPRESSEDBITMAP_RUN) + 1;
+        if (n & DISPLAYIO_COMPRESSEDBITMAP_RUN) {
+            for (uint32_t i = 0; i < count; i++) {
+                memcpy(out, packet + 1, value_size);
+                out += value_size;
+            }
+            packet += 1 + value_size;
+        } else {
+            memcpy(out, packet + 1, count * value_size);
+            out += count * value_size;
+            packet += 1 + count * value_size;
+        }
+    }
+    self->cached_y = y;
+}
+
+uint32_t common_hal_displayio_compressedbitmap_get_pixel(displayio_compressedbitmap_t *self,
+    int16_t x, int16_t y) {
+    if (x >= self->width || x < 0 || y >= self->height || y < 0) {
+        return 0;
+    }
+    uint8_t value_size = self->value_size;
+    // Stepping back along a row, as a flipped TileGrid does, can't be done
+    // packet by packet, so the row is decoded once and read from the cache.
+    if (y == self->cursor_y && x < self->packet_x && y != self->cached_y) {
+        decode_row(self, y);
+    }
+    if (y == self->cached_y) {
+        return read_value(self->row_cache + x * value_size, value_size);
+    }
+    // Reading along a row carries on from the last packet. Anything else
+    // starts again from the row's entry in the index.
+    if (y != self->cursor_y) {
+        self->cursor_y = y;
+        self->packet_x = 0;
+        self->packet = read_value(self->row_index + 4 * y, 4);
+    }
+    const uint8_t *packet = self->data + self->packet;
+    uint32_t packet_x = self->packet_x;
+    while (true) {
+        uint8_t n = *packet;
+        uint32_t count = (n & ~DISPLAYIO_COMPRESSEDBITMAP_RUN) + 1;
+        if ((uint32_t)x < packet_x + count) {
+            break;
+        }
+        packet_x += count;
+        packet += 1 + ((n & DISPLAYIO_COMPRESSEDBITMAP_RUN) ? 1 : count) * value_size;
+    }
+    self->packet_x = packet_x;
+    self->packet = packet - self->data;
+
+    const uint8_t *value = packet + 1;
+    if (!(*packet & DISPLAYIO_COMPRESSEDBITMAP_RUN)) {
+        value += (x - packet_x) * value_size;
+    }
+    return read_value(value, value_size);
+}
+
+uint16_t common_hal_displayio_compressedbitmap_get_height(displayio_compressedbitmap_t *self) {
+    return self->height;
+}
+
+uint16_t common_hal_displayio_compressedbitmap_get_width(displayio_compressedbitmap_t *self) {
+    return self->width;
+}
+
+uint32_t common_hal_displayio_compressedbitmap_get_bits_per_value(displayio_compressedbitmap_t *self) {
+    return self->bits_per_value;
+}
+
+static size_t put_value(uint8_t *buf, size_t n, uint32_t value, uint8_t size) {
+    if (buf) {
+        for (uint8_t i = 0; i < size; i++) {
+            buf[n + i] = value >> (8 * i);
+        }
+    }
+    return n + size;
+}
+
+// The number of values from x that are the same, up to the longest packet
+static int run_length(displayio_bitmap_t *bitmap, int x, int y) {
+    uint32_t value = common_hal_displayio_bitmap_get_pixel(bitmap, x, y);
+    int n = 1;
+    while (x + n < bitmap->width && n < DISPLAYIO_COMPRESSEDBITMAP_MAX_PACKET &&
+           common_hal_displayio_bitmap_get_pixel(bitmap, x + n, y) == value) {
+        n++;
+    }
+    return n;
+}
+
+size_t common_hal_displayio_compressedbitmap_compress(displayio_bitmap_t *bitmap, uint8_t *buf) {
+    uint8_t bits_per_value = bitmap->bits_per_value;
+    uint8_t value_size = bits_per_value <= 8 ? 1 : bits_per_value / 8;
+    // A run of two single byte values is no smaller than a literal of them
+    int min_run = value_size == 1 ? 3 : 2;
+    int width = bitmap->width;
+
+    if (buf) {
+        memcpy(buf, magic, sizeof(magic));
+        put_value(buf, 4, bitmap->width, 2);
+        put_value(buf, 6, bitmap->height, 2);
+        put_value(buf, 8, bits_per_value, 4);
+    }
+    size_t n = DISPLAYIO_COMPRESSEDBITMAP_HEADER_SIZE + 4 * (size_t)bitmap->height;
+    for (int y = 0; y < bitmap->height; y++) {
+        put_value(buf, DISPLAYIO_COMPRESSEDBITMAP_HEADER_SIZE + 4 * y, n, 4);
+        int x = 0;
+        while (x < width) {
+            int run = run_length(bitmap, x, y);
+            if (run >= min_run) {
+                if (buf) {
+                    buf[n] = DISPLAYIO_COMPRESSEDBITMAP_RUN | (run - 1);
+                }
+                n = put_value(buf, n + 1, common_hal_displayio_bitmap_get_pixel(bitmap, x, y), value_size);
+                x += run;
+                continue;
+            }
+            // Gather values up to the next run that is worth a packet of its own
+            int start = x;
+            do {
+                x++;
+            } while (x < width && x - start < DISPLAYIO_COMPRESSEDBITMAP_MAX_PACKET && run_length(bitmap, x, y) < min_run);
+            if (buf) {
+                buf[n] = x - start - 1;
+            }
+            n++;
+            for (int i = start; i < x; i++) {
+                n = put_value(buf, n, common_hal_displayio_bitmap_get_pixel(bitmap, i, y), value_size);
+            }
+        }
+    }
+    return n;
+}
@@ -0,0 +1,44 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+
+// The data starts with a header:
+//   "RLEB", uint16 width, uint16 height, uint8 bits per value, 3 zero bytes
+// followed by a uint32 offset from the start of the data to each row. A row is
+// a series of packets. A packet's first byte n covers (n & 0x7f) + 1 values. When
+// the top bit is set one value follows and is repeated, otherwise each value
+// follows in turn. Values are 1, 2 or 4 bytes, little endian. Packets don't
+// cross rows.
+#define DISPLAYIO_COMPRESSEDBITMAP_HEADER_SIZE (12)
+#define DISPLAYIO_COMPRESSEDBITMAP_RUN (0x80)
+#define DISPLAYIO_COMPRESSEDBITMAP_MAX_PACKET (128)
+
+typedef struct {
+    mp_obj_base_t base;
+    uint16_t width;
+    uint16_t height;
+    // Kept so that the data isn't collected while it is used.
+    mp_obj_t data_obj;
+    const uint8_t *data;
+    const uint8_t *row_index;
+    uint8_t bits_per_value;
+    uint8_t value_size;
+    // Where the last lookup ended, so that reading along a row decodes each
+    // packet once. packet_x is the x of the first value in the packet at
+    // offset packet.
+    uint16_t cursor_y;
+    uint16_t packet_x;
+    uint32_t packet;
+    // The values of row cached_y, decoded when a row is read backwards.
+    uint8_t *row_cache;
+    uint16_t cached_y;
+} displayio_compressedbitmap_t;
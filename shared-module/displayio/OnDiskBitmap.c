@@ -25,7 +25,7 @@ static uint32_t read_word(uint16_t *bmp_header, uint16_t index) {
     return bmp_header[index] | bmp_header[index + 1] << 16;
 }
 
-void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file) {
+void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file, uint32_t cache_size) {
     // Load the wave
     self->file = file;
     uint16_t bmp_header[69];
@@ -158,6 +158,43 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    // Never cache more than the whole image.
+    self->cache_size = MIN(cache_size, (uint32_t)self->stride * self->height);
+    self->cache_start = 0;
+    self->cache_length = 0;
+    self->cache = NULL;
+    if (self->cache_size > 0) {
+        self->cache = m_malloc_without_collect(self->cache_size);
+    }
+}
+
+// Load the block of the file around location into the cache. Returns false if it couldn't be read.
+static bool fill_cache(displayio_ondiskbitmap_t *self, uint32_t location, uint8_t bytes_per_pixel) {
+    uint32_t start;
+    if (self->cache_size >= self->stride) {
+        // Cache whole rows. Rows are stored bottom up in the file and displays draw top down, so
+        // the requested row goes at the end of the block and the rows drawn next come before it.
+        uint32_t rows = self->cache_size / self->stride;
+        uint32_t row = (location - self->data_offset) / self->stride;
+        uint32_t first_row = row + 1 > rows ? row + 1 - rows : 0;
+        start = self->data_offset + first_row * self->stride;
+    } else {
+        // Cache part of a row starting at the requested pixel since pixels are drawn left to right.
+        start = location;
+    }
+    uint32_t end = MIN(start + self->cache_size, self->data_offset + (uint32_t)self->stride * self->height);
+
+    self->cache_length = 0;
+    if (f_lseek(&self->file->fp, start) != FR_OK) {
+        return false;
+    }
+    UINT bytes_read;
+    if (f_read(&self->file->fp, self->cache, end - start, &bytes_read) != FR_OK) {
+        return false;
+    }
+    self->cache_start = start;
+    self->cache_length = bytes_read;
+    return location + bytes_per_pixel <= start + bytes_read;
 }
 
 
@@ -175,11 +212,20 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
     } else {
         location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
-    f_lseek(&self->file->fp, location);
-    UINT bytes_read;
     uint32_t pixel_data = 0;
-    uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    uint32_t result = FR_OK;
+    if (self->cache != NULL) {
+        if (location < self->cache_start || location + bytes_per_pixel > self->cache_start + self->cache_length) {
+            if (!fill_cache(self, location, bytes_per_pixel)) {
+                return 0;
+            }
+        }
+        memcpy(&pixel_data, self->cache + (location - self->cache_start), bytes_per_pixel);
+    } else {
+        f_lseek(&self->file->fp, location);
+        UINT bytes_read;
+        result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    }
     if (result == FR_OK) {
         uint32_t tmp = 0;
         uint8_t red;
@@ -23,6 +23,13 @@ typedef struct {
     uint32_t g_bitmask;
     uint32_t b_bitmask;
     pyb_file_obj_t *file;
+    // Block of the file's pixel data kept in RAM so that neighboring pixels don't each need a
+    // seek and read. cache_start is a file offset and cache_length is how much of the cache is
+    // valid.
+    uint8_t *cache;
+    uint32_t cache_size;
+    uint32_t cache_start;
+    uint32_t cache_length;
     union {
         mp_obj_base_t *pixel_shader_base;
         struct displayio_palette *palette;
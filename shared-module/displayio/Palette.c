@@ -11,6 +11,7 @@
 void common_hal_displayio_palette_construct(displayio_palette_t *self, uint16_t color_count, bool dither) {
     self->color_count = color_count;
     self->colors = (_displayio_color_t *)m_malloc_without_collect(color_count * sizeof(_displayio_color_t));
+    self->cached_colorspace = NULL;
     self->dither = dither;
 }
 
@@ -45,7 +46,7 @@ void common_hal_displayio_palette_set_color(displayio_palette_t *self, uint32_t
         return;
     }
     self->colors[palette_index].rgb888 = color;
-    self->colors[palette_index].cached_colorspace = NULL;
+    self->colors[palette_index].cached = false;
     self->needs_refresh = true;
 }
 
@@ -53,33 +54,70 @@ uint32_t common_hal_displayio_palette_get_color(displayio_palette_t *self, uint3
     return self->colors[palette_index].rgb888;
 }
 
-void displayio_palette_get_color(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
-    uint32_t palette_index = input_pixel->pixel;
-    if (palette_index > self->color_count || self->colors[palette_index].transparent) {
-        output_color->opaque = false;
-        return;
+// Make the cached colors valid for colorspace, dropping them if they were
+// converted for a different one. Returns false if the cache can't be used.
+static bool displayio_palette_use_colorspace(displayio_palette_t *self, const _displayio_colorspace_t *colorspace) {
+    if (self->dither) {
+        return false;
+    }
+    if (self->cached_colorspace != colorspace ||
+        self->cached_colorspace_grayscale_bit != colorspace->grayscale_bit ||
+        self->cached_colorspace_grayscale != colorspace->grayscale) {
+        for (uint32_t i = 0; i < self->color_count; i++) {
+            self->colors[i].cached = false;
+        }
+        self->cached_colorspace = colorspace;
+        self->cached_colorspace_grayscale_bit = colorspace->grayscale_bit;
+        self->cached_colorspace_grayscale = colorspace->grayscale;
     }
+    return true;
+}
 
-    // Cache results when not dithering.
-    _displayio_color_t *color = &self->colors[palette_index];
-    // Check the grayscale settings because EPaperDisplay will change them on
-    // the same object.
-    if (!self->dither &&
-        color->cached_colorspace == colorspace &&
-        color->cached_colorspace_grayscale_bit == colorspace->grayscale_bit &&
-        color->cached_colorspace_grayscale == colorspace->grayscale) {
-        output_color->pixel = self->colors[palette_index].cached_color;
+static void displayio_palette_convert(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, bool use_cache, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
+    _displayio_color_t *color = &self->colors[input_pixel->pixel];
+    if (use_cache && color->cached) {
+        output_color->pixel = color->cached_color;
         return;
     }
 
     displayio_input_pixel_t rgb888_pixel = *input_pixel;
-    rgb888_pixel.pixel = self->colors[palette_index].rgb888;
+    rgb888_pixel.pixel = color->rgb888;
     displayio_convert_color(colorspace, self->dither, &rgb888_pixel, output_color);
-    if (!self->dither) {
-        color->cached_colorspace = colorspace;
+    // A hit returns the cached color as opaque, so colors the colorspace can't show aren't kept
+    if (use_cache && output_color->opaque) {
         color->cached_color = output_color->pixel;
-        color->cached_colorspace_grayscale = colorspace->grayscale;
-        color->cached_colorspace_grayscale_bit = colorspace->grayscale_bit;
+        color->cached = true;
+    }
+}
+
+void displayio_palette_get_color(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
+    uint32_t palette_index = input_pixel->pixel;
+    if (palette_index >= self->color_count || self->colors[palette_index].transparent) {
+        output_color->opaque = false;
+        return;
+    }
+
+    bool use_cache = displayio_palette_use_colorspace(self, colorspace);
+    displayio_palette_convert(self, colorspace, use_cache, input_pixel, output_color);
+}
+
+void displayio_palette_get_colors(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, const uint32_t *indices, displayio_output_pixel_t *output_colors, uint32_t count) {
+    bool use_cache = displayio_palette_use_colorspace(self, colorspace);
+    displayio_input_pixel_t input_pixel = { 0 };
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t palette_index = indices[i];
+        displayio_output_pixel_t *output_color = &output_colors[i];
+        if (palette_index >= self->color_count || self->colors[palette_index].transparent) {
+            output_color->opaque = false;
+            continue;
+        }
+        output_color->opaque = true;
+        if (use_cache && self->colors[palette_index].cached) {
+            output_color->pixel = self->colors[palette_index].cached_color;
+            continue;
+        }
+        input_pixel.pixel = palette_index;
+        displayio_palette_convert(self, colorspace, use_cache, &input_pixel, output_color);
     }
 }
 
@@ -30,10 +30,8 @@ typedef struct {
 
 typedef struct {
     uint32_t rgb888;
-    const _displayio_colorspace_t *cached_colorspace;
-    uint32_t cached_color;
-    uint8_t cached_colorspace_grayscale_bit;
-    bool cached_colorspace_grayscale;
+    uint32_t cached_color; // rgb888 converted to the palette's cached colorspace.
+    bool cached; // True when cached_color is valid.
     bool transparent; // This may have additional bits added later for blending.
 } _displayio_color_t;
 
@@ -54,13 +52,21 @@ typedef struct {
 typedef struct displayio_palette {
     mp_obj_base_t base;
     _displayio_color_t *colors;
+    // The colorspace that the cached colors were converted for. Check the
+    // grayscale settings too because EPaperDisplay changes them on the same
+    // object.
+    const _displayio_colorspace_t *cached_colorspace;
     uint32_t color_count;
+    uint8_t cached_colorspace_grayscale_bit;
+    bool cached_colorspace_grayscale;
     bool needs_refresh;
     bool dither;
 } displayio_palette_t;
 
 
 void displayio_palette_get_color(displayio_palette_t *palette, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
-;
+// Convert count palette indices to colors in colorspace at once. Transparent and out of range
+// entries are marked not opaque. Used by renderers that can gather a run of pixels first.
+void displayio_palette_get_colors(displayio_palette_t *palette, const _displayio_colorspace_t *colorspace, const uint32_t *indices, displayio_output_pixel_t *output_colors, uint32_t count);
 bool displayio_palette_needs_refresh(displayio_palette_t *self);
 void displayio_palette_finish_refresh(displayio_palette_t *self);
@@ -9,6 +9,7 @@
 #include "py/runtime.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/CompressedBitmap.h"
 #include "shared-bindings/displayio/OnDiskBitmap.h"
 #include "shared-bindings/displayio/Palette.h"
 #if CIRCUITPY_TILEPALETTEMAPPER
@@ -286,29 +287,22 @@ uint16_t common_hal_displayio_tilegrid_get_tile(displayio_tilegrid_t *self, uint
 }
 
 void displayio_tilegrid_mark_tile_dirty(displayio_tilegrid_t *self, uint16_t x, uint16_t y) {
-    displayio_area_t temp_area;
-    displayio_area_t *tile_area;
-    if (!self->partial_change) {
-        tile_area = &self->dirty_area;
-    } else {
-        tile_area = &temp_area;
-    }
+    displayio_area_t tile_area;
     int16_t tx = (x - self->top_left_x) % self->width_in_tiles;
     if (tx < 0) {
         tx += self->width_in_tiles;
     }
-    tile_area->x1 = tx * self->tile_width;
-    tile_area->x2 = tile_area->x1 + self->tile_width;
+    tile_area.x1 = tx * self->tile_width;
+    tile_area.x2 = tile_area.x1 + self->tile_width;
     int16_t ty = (y - self->top_left_y) % self->height_in_tiles;
     if (ty < 0) {
         ty += self->height_in_tiles;
     }
-    tile_area->y1 = ty * self->tile_height;
-    tile_area->y2 = tile_area->y1 + self->tile_height;
+    tile_area.y1 = ty * self->tile_height;
+    tile_area.y2 = tile_area.y1 + self->tile_height;
 
-    if (self->partial_change) {
-        displayio_area_union(&self->dirty_area, &temp_area, &self->dirty_area);
-    }
+    self->dirty_area_count = displayio_area_add_to_set(self->dirty_areas, self->dirty_area_count,
+        DISPLAYIO_DIRTY_AREA_COUNT, &tile_area);
     self->partial_change = true;
 }
 
@@ -425,6 +419,73 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
+// Number of pixels gathered before converting them through a Palette or ColorConverter at once.
+#define PIXEL_BATCH_SIZE (32)
+
+static void _write_pixel(const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
+    uint32_t *buffer, int16_t offset, uint32_t pixel) {
+    if (colorspace->depth == 16) {
+        *(((uint16_t *)buffer) + offset) = pixel;
+    } else if (colorspace->depth == 32) {
+        *(((uint32_t *)buffer) + offset) = pixel;
+    } else if (colorspace->depth == 24) {
+        memcpy(((uint8_t *)buffer) + offset * 3, &pixel, 3);
+    } else if (colorspace->depth == 8) {
+        *(((uint8_t *)buffer) + offset) = pixel;
+    } else if (colorspace->depth < 8) {
+        uint8_t pixels_per_byte = 8 / colorspace->depth;
+
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t width = displayio_area_width(area);
+            uint16_t row = offset / width;
+            uint16_t col = offset % width;
+            // Dividing by pixels_per_byte does truncated division even if we multiply it back out.
+            offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
+            // Also useful for validating that the bitpacking worked correctly.
+            // if (offset > displayio_area_size(area)) {
+            //     asm("bkpt");
+            // }
+        }
+        uint8_t shift = (offset % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        ((uint8_t *)buffer)[offset / pixels_per_byte] |= pixel << shift;
+    }
+}
+
+// Convert a batch of pixels at once through the pixel shader and write the opaque ones. Returns
+// false if any pixel was transparent.
+static bool _write_pixel_batch(mp_obj_t pixel_shader, const _displayio_colorspace_t *colorspace,
+    const displayio_area_t *area, uint32_t *mask, uint32_t *buffer,
+    const uint32_t *pixels, const int16_t *offsets, uint32_t count) {
+    displayio_output_pixel_t colors[PIXEL_BATCH_SIZE];
+    if (mp_obj_is_type(pixel_shader, &displayio_palette_type)) {
+        displayio_palette_get_colors(pixel_shader, colorspace, pixels, colors, count);
+    } else {
+        displayio_colorconverter_t *converter = pixel_shader;
+        uint32_t converted[PIXEL_BATCH_SIZE];
+        bool converted_ok = displayio_colorconverter_convert_row(converter, colorspace, pixels, converted, count, 0, 0);
+        for (uint32_t i = 0; i < count; i++) {
+            colors[i].pixel = converted[i];
+            colors[i].opaque = converted_ok && pixels[i] != converter->transparent_color;
+        }
+    }
+    bool all_opaque = true;
+    for (uint32_t i = 0; i < count; i++) {
+        if (!colors[i].opaque) {
+            all_opaque = false;
+            continue;
+        }
+        int16_t offset = offsets[i];
+        mask[offset / 32] |= 1 << (offset % 32);
+        _write_pixel(colorspace, area, buffer, offset, colors[i].pixel);
+    }
+    return all_opaque;
+}
+
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
     uint32_t *mask, uint32_t *buffer) {
@@ -515,6 +576,16 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
+    // Undithered shaders don't depend on pixel position so convert runs of pixels at once
+    // instead of one at a time.
+    bool pixel_batch = (mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
+        !common_hal_displayio_palette_get_dither(self->pixel_shader)) ||
+        (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) &&
+            !common_hal_displayio_colorconverter_get_dither(self->pixel_shader));
+    uint32_t batch_pixels[PIXEL_BATCH_SIZE];
+    int16_t batch_offsets[PIXEL_BATCH_SIZE];
+    uint32_t batch_count = 0;
+
     for (input_pixel.y = start_y; input_pixel.y < end_y; ++input_pixel.y) {
         int16_t row_start = start + (input_pixel.y - start_y + y_shift) * y_stride; // in pixels
         int16_t local_y = input_pixel.y / self->absolute_transform->scale;
@@ -553,6 +624,20 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
                 input_pixel.pixel = common_hal_displayio_bitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
             } else if (mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) {
                 input_pixel.pixel = common_hal_displayio_ondiskbitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
+            } else if (mp_obj_is_type(self->bitmap, &displayio_compressedbitmap_type)) {
+                input_pixel.pixel = common_hal_displayio_compressedbitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
+            }
+
+            if (pixel_batch) {
+                batch_pixels[batch_count] = input_pixel.pixel;
+                batch_offsets[batch_count] = offset;
+                batch_count++;
+                if (batch_count == PIXEL_BATCH_SIZE) {
+                    full_coverage &= _write_pixel_batch(self->pixel_shader, colorspace, area, mask, buffer,
+                        batch_pixels, batch_offsets, batch_count);
+                    batch_count = 0;
+                }
+                continue;
             }
 
             output_pixel.opaque = true;
@@ -573,39 +658,14 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
                 full_coverage = false;
             } else {
                 mask[offset / 32] |= 1 << (offset % 32);
-                if (colorspace->depth == 16) {
-                    *(((uint16_t *)buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    *(((uint32_t *)buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth == 24) {
-                    memcpy(((uint8_t *)buffer) + offset * 3, &output_pixel.pixel, 3);
-                } else if (colorspace->depth == 8) {
-                    *(((uint8_t *)buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    uint8_t pixels_per_byte = 8 / colorspace->depth;
-
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t width = displayio_area_width(area);
-                        uint16_t row = offset / width;
-                        uint16_t col = offset % width;
-                        // Dividing by pixels_per_byte does truncated division even if we multiply it back out.
-                        offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
-                        // Also useful for validating that the bitpacking worked correctly.
-                        // if (offset > displayio_area_size(area)) {
-                        //     asm("bkpt");
-                        // }
-                    }
-                    uint8_t shift = (offset % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
-                    }
-                    ((uint8_t *)buffer)[offset / pixels_per_byte] |= output_pixel.pixel << shift;
-                }
+                _write_pixel(colorspace, area, buffer, offset, output_pixel.pixel);
             }
         }
     }
+    if (batch_count > 0) {
+        full_coverage &= _write_pixel_batch(self->pixel_shader, colorspace, area, mask, buffer,
+            batch_pixels, batch_offsets, batch_count);
+    }
     return full_coverage;
 }
 
@@ -621,6 +681,7 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     self->moved = false;
     self->full_change = false;
     self->partial_change = false;
+    self->dirty_area_count = 0;
     if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
         displayio_palette_finish_refresh(self->pixel_shader);
     } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
@@ -636,6 +697,50 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     // That way they won't change during a refresh and tear.
 }
 
+// Convert a dirty area relative to the TileGrid into an absolute area.
+static void _transform_dirty_area(displayio_tilegrid_t *self, displayio_area_t *area) {
+    int16_t x = self->x;
+    int16_t y = self->y;
+    if (self->absolute_transform->transpose_xy) {
+        int16_t temp = y;
+        y = x;
+        x = temp;
+    }
+    int16_t x1 = area->x1;
+    int16_t x2 = area->x2;
+    if (self->flip_x) {
+        x1 = self->pixel_width - x1;
+        x2 = self->pixel_width - x2;
+    }
+    int16_t y1 = area->y1;
+    int16_t y2 = area->y2;
+    if (self->flip_y) {
+        y1 = self->pixel_height - y1;
+        y2 = self->pixel_height - y2;
+    }
+    if (self->transpose_xy != self->absolute_transform->transpose_xy) {
+        int16_t temp1 = y1, temp2 = y2;
+        y1 = x1;
+        x1 = temp1;
+        y2 = x2;
+        x2 = temp2;
+    }
+    area->x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
+    area->y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
+    area->x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
+    area->y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
+    if (area->y2 < area->y1) {
+        int16_t temp = area->y2;
+        area->y2 = area->y1;
+        area->y1 = temp;
+    }
+    if (area->x2 < area->x1) {
+        int16_t temp = area->x2;
+        area->x2 = area->x1;
+        area->x1 = temp;
+    }
+}
+
 displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_t *tail) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
@@ -649,10 +754,11 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
             return tail;
         }
     } else if (self->moved && !first_draw) {
-        displayio_area_union(&self->previous_area, &self->current_area, &self->dirty_area);
-        if (displayio_area_size(&self->dirty_area) <= 2U * self->pixel_width * self->pixel_height) {
-            self->dirty_area.next = tail;
-            return &self->dirty_area;
+        displayio_area_t *union_area = &self->dirty_areas[0];
+        displayio_area_union(&self->previous_area, &self->current_area, union_area);
+        if (displayio_area_size(union_area) <= 2U * self->pixel_width * self->pixel_height) {
+            union_area->next = tail;
+            return union_area;
         }
         self->previous_area.next = tail;
         self->current_area.next = &self->previous_area;
@@ -664,9 +770,12 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
         displayio_area_t *refresh_area = displayio_bitmap_get_refresh_areas(self->bitmap, tail);
         if (refresh_area != tail) {
             // Special case a TileGrid that shows a full bitmap and use its
-            // dirty area. Copy it to ours so we can transform it.
+            // dirty areas. Copy them to ours so we can transform them.
             if (self->tiles_in_bitmap == 1) {
-                displayio_area_copy(refresh_area, &self->dirty_area);
+                for (const displayio_area_t *area = refresh_area; area != tail; area = area->next) {
+                    self->dirty_area_count = displayio_area_add_to_set(self->dirty_areas,
+                        self->dirty_area_count, DISPLAYIO_DIRTY_AREA_COUNT, area);
+                }
                 self->partial_change = true;
             } else {
                 self->full_change = true;
@@ -686,49 +795,11 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
     }
 
     if (self->partial_change) {
-        int16_t x = self->x;
-        int16_t y = self->y;
-        if (self->absolute_transform->transpose_xy) {
-            int16_t temp = y;
-            y = x;
-            x = temp;
-        }
-        int16_t x1 = self->dirty_area.x1;
-        int16_t x2 = self->dirty_area.x2;
-        if (self->flip_x) {
-            x1 = self->pixel_width - x1;
-            x2 = self->pixel_width - x2;
+        for (uint8_t i = 0; i < self->dirty_area_count; i++) {
+            _transform_dirty_area(self, &self->dirty_areas[i]);
+            self->dirty_areas[i].next = tail;
+            tail = &self->dirty_areas[i];
         }
-        int16_t y1 = self->dirty_area.y1;
-        int16_t y2 = self->dirty_area.y2;
-        if (self->flip_y) {
-            y1 = self->pixel_height - y1;
-            y2 = self->pixel_height - y2;
-        }
-        if (self->transpose_xy != self->absolute_transform->transpose_xy) {
-            int16_t temp1 = y1, temp2 = y2;
-            y1 = x1;
-            x1 = temp1;
-            y2 = x2;
-            x2 = temp2;
-        }
-        self->dirty_area.x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
-        self->dirty_area.y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
-        self->dirty_area.x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
-        self->dirty_area.y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
-        if (self->dirty_area.y2 < self->dirty_area.y1) {
-            int16_t temp = self->dirty_area.y2;
-            self->dirty_area.y2 = self->dirty_area.y1;
-            self->dirty_area.y1 = temp;
-        }
-        if (self->dirty_area.x2 < self->dirty_area.x1) {
-            int16_t temp = self->dirty_area.x2;
-            self->dirty_area.x2 = self->dirty_area.x1;
-            self->dirty_area.x1 = temp;
-        }
-
-        self->dirty_area.next = tail;
-        return &self->dirty_area;
     }
     return tail;
 }
@@ -32,7 +32,9 @@ typedef struct {
     uint16_t top_left_y;
     void *tiles;  // Can be either uint8_t* or uint16_t* depending on tiles_in_bitmap
     const displayio_buffer_transform_t *absolute_transform;
-    displayio_area_t dirty_area; // Stored as a relative area until the refresh area is fetched.
+    // Stored as relative areas until the refresh areas are fetched.
+    displayio_area_t dirty_areas[DISPLAYIO_DIRTY_AREA_COUNT];
+    uint8_t dirty_area_count;
     displayio_area_t previous_area; // Stored as an absolute area.
     displayio_area_t current_area; // Stored as an absolute area so it applies across frames.
     bool partial_change : 1;
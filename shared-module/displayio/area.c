@@ -111,6 +111,52 @@ bool displayio_area_equal(const displayio_area_t *a, const displayio_area_t *b)
            a->y2 == b->y2;
 }
 
+static uint8_t remove_from_set(displayio_area_t *areas, uint8_t count, uint8_t index) {
+    count--;
+    displayio_area_copy(&areas[count], &areas[index]);
+    return count;
+}
+
+uint8_t displayio_area_add_to_set(displayio_area_t *areas, uint8_t count, uint8_t capacity,
+    const displayio_area_t *area) {
+    if (displayio_area_empty(area)) {
+        return count;
+    }
+    displayio_area_t pending;
+    displayio_area_copy(area, &pending);
+    while (true) {
+        // Merge with any area where the union isn't bigger than the two apart. This covers overlaps
+        // and neighbors that line up. The merged area may now qualify with another so start over.
+        uint8_t merge = count;
+        displayio_area_t u;
+        for (uint8_t i = 0; i < count; i++) {
+            displayio_area_union(&areas[i], &pending, &u);
+            if (displayio_area_size(&u) <= displayio_area_size(&areas[i]) + displayio_area_size(&pending)) {
+                merge = i;
+                break;
+            }
+        }
+        if (merge == count) {
+            if (count < capacity) {
+                displayio_area_copy(&pending, &areas[count]);
+                return count + 1;
+            }
+            // The set is full so merge with the area that grows the least.
+            uint32_t least_growth = UINT32_MAX;
+            for (uint8_t i = 0; i < count; i++) {
+                displayio_area_union(&areas[i], &pending, &u);
+                uint32_t growth = displayio_area_size(&u) - displayio_area_size(&areas[i]);
+                if (growth < least_growth) {
+                    least_growth = growth;
+                    merge = i;
+                }
+            }
+        }
+        displayio_area_union(&areas[merge], &pending, &pending);
+        count = remove_from_set(areas, count, merge);
+    }
+}
+
 // Original and whole must be in the same coordinate space.
 void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpose_xy,
     const displayio_area_t *original,
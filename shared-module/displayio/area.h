@@ -20,6 +20,9 @@ struct _displayio_area_t {
     const displayio_area_t *next; // Next area in the linked list.
 };
 
+// Number of separate dirty areas a Bitmap or TileGrid tracks before merging them.
+#define DISPLAYIO_DIRTY_AREA_COUNT (4)
+
 typedef struct {
     uint16_t x;
     uint16_t y;
@@ -51,6 +54,10 @@ uint16_t displayio_area_width(const displayio_area_t *area);
 uint16_t displayio_area_height(const displayio_area_t *area);
 uint32_t displayio_area_size(const displayio_area_t *area);
 bool displayio_area_equal(const displayio_area_t *a, const displayio_area_t *b);
+// Adds area to the set of count areas and returns the new count. Areas that are cheaper to
+// refresh together are merged and when the set is full the merge that grows least is used.
+uint8_t displayio_area_add_to_set(displayio_area_t *areas, uint8_t count, uint8_t capacity,
+    const displayio_area_t *area);
 void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpose_xy,
     const displayio_area_t *original,
     const displayio_area_t *whole,
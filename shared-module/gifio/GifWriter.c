@@ -16,7 +16,23 @@
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-bindings/util.h"
 
-#define BLOCK_SIZE (126) // (2^7) - 2 // (DO NOT CHANGE!)
+#if MICROPY_VFS_FAT
+#include "extmod/vfs_fat.h"
+#endif
+
+// The palette has 128 colors, and one more entry for pixels that didn't
+// change since the last frame
+#define TRANSPARENT_INDEX (128)
+#define MIN_CODE_SIZE (8)
+#define CLEAR_CODE (1 << MIN_CODE_SIZE)
+#define END_CODE (CLEAR_CODE + 1)
+#define FIRST_CODE (CLEAR_CODE + 2)
+#define MAX_CODE (4096)
+
+// Output is collected and written in chunks of this many bytes, or of the
+// filesystem's cluster size when it is between these
+#define MIN_BUFFER_SIZE (512)
+#define MAX_BUFFER_SIZE (4096)
 
 static void handle_error(gifio_gifwriter_t *self) {
     if (self->error != 0) {
@@ -36,24 +52,134 @@ static void flush_data(gifio_gifwriter_t *self) {
     }
 }
 
-// These "write" calls _MUST_ have enough buffer space available!  This is
-// ensured by allocating the proper buffer size in construct.
+// Only full buffers are written, so that writes stay aligned to the filesystem's clusters
 static void write_data(gifio_gifwriter_t *self, const void *data, size_t size) {
-    assert(self->cur + size <= self->size);
-    memcpy(self->data + self->cur, data, size);
-    self->cur += size;
+    const uint8_t *src = data;
+    while (size) {
+        size_t n = MIN(size, self->size - self->cur);
+        memcpy(self->data + self->cur, src, n);
+        self->cur += n;
+        src += n;
+        size -= n;
+        if (self->cur == self->size) {
+            flush_data(self);
+        }
+    }
 }
 
 static void write_byte(gifio_gifwriter_t *self, uint8_t value) {
     write_data(self, &value, sizeof(value));
 }
 
-static void write_long(gifio_gifwriter_t *self, uint32_t value) {
+static void write_word(gifio_gifwriter_t *self, uint16_t value) {
     write_data(self, &value, sizeof(value));
 }
 
-static void write_word(gifio_gifwriter_t *self, uint16_t value) {
-    write_data(self, &value, sizeof(value));
+static size_t buffer_size_for(mp_obj_t file) {
+    size_t size = MIN_BUFFER_SIZE;
+    #if MICROPY_VFS_FAT
+    if (mp_obj_is_type(file, &mp_type_vfs_fat_fileio)) {
+        pyb_file_obj_t *f = MP_OBJ_TO_PTR(file);
+        FATFS *fs = f->fp.obj.fs;
+        #if FF_MAX_SS != FF_MIN_SS
+        size = fs->csize * fs->ssize;
+        #else
+        size = fs->csize * FF_MAX_SS;
+        #endif
+    }
+    #endif
+    return MIN(MAX(size, MIN_BUFFER_SIZE), MAX_BUFFER_SIZE);
+}
+
+// LZW codes are packed into data sub-blocks of up to 255 bytes
+static void lzw_write_code(gifio_gifwriter_t *self, int code) {
+    self->lzw_bits |= (uint32_t)code << self->lzw_bit_count;
+    self->lzw_bit_count += self->lzw_code_size;
+    while (self->lzw_bit_count >= 8) {
+        self->block[self->block_len++] = self->lzw_bits & 0xff;
+        self->lzw_bits >>= 8;
+        self->lzw_bit_count -= 8;
+        if (self->block_len == 255) {
+            write_byte(self, 255);
+            write_data(self, self->block, 255);
+            self->block_len = 0;
+        }
+    }
+}
+
+static void lzw_clear(gifio_gifwriter_t *self) {
+    if (self->lzw_next_code != FIRST_CODE) {
+        memset(self->lzw_table, 0, GIFIO_LZW_TABLE_SIZE * sizeof(*self->lzw_table));
+    }
+    self->lzw_next_code = FIRST_CODE;
+    self->lzw_code_size = MIN_CODE_SIZE + 1;
+}
+
+static void lzw_start(gifio_gifwriter_t *self) {
+    write_byte(self, MIN_CODE_SIZE);
+    self->lzw_bits = 0;
+    self->lzw_bit_count = 0;
+    self->block_len = 0;
+    self->lzw_prefix = -1;
+    self->lzw_code_size = MIN_CODE_SIZE + 1;
+    lzw_write_code(self, CLEAR_CODE);
+    lzw_clear(self);
+}
+
+// Table entries hold the (prefix, pixel) key above the 12 bit code. Codes
+// in the table are never 0, so 0 marks an empty entry.
+static void lzw_add_pixel(gifio_gifwriter_t *self, uint8_t pixel) {
+    int prefix = self->lzw_prefix;
+    if (prefix < 0) {
+        self->lzw_prefix = pixel;
+        return;
+    }
+
+    uint32_t key = (uint32_t)prefix << 8 | pixel;
+    uint32_t *table = self->lzw_table;
+    size_t i = (pixel << 4) ^ prefix;
+    while (table[i] != 0) {
+        if (table[i] >> 12 == key) {
+            self->lzw_prefix = table[i] & 0xfff;
+            return;
+        }
+        if (++i == GIFIO_LZW_TABLE_SIZE) {
+            i = 0;
+        }
+    }
+
+    lzw_write_code(self, prefix);
+    if (self->lzw_next_code < MAX_CODE) {
+        table[i] = key << 12 | self->lzw_next_code++;
+        // The decoder adds each code one code later, so it needs the wider
+        // code once this code doesn't fit
+        if (self->lzw_next_code > (1 << self->lzw_code_size)) {
+            self->lzw_code_size++;
+        }
+    } else {
+        lzw_write_code(self, CLEAR_CODE);
+        lzw_clear(self);
+    }
+    self->lzw_prefix = pixel;
+}
+
+static void lzw_finish(gifio_gifwriter_t *self) {
+    if (self->lzw_prefix >= 0) {
+        lzw_write_code(self, self->lzw_prefix);
+        // The decoder adds a code for the last one, which can widen the end code
+        if (self->lzw_next_code < MAX_CODE && ++self->lzw_next_code > (1 << self->lzw_code_size)) {
+            self->lzw_code_size++;
+        }
+    }
+    lzw_write_code(self, END_CODE);
+    if (self->lzw_bit_count) {
+        self->block[self->block_len++] = self->lzw_bits;
+    }
+    if (self->block_len) {
+        write_byte(self, self->block_len);
+        write_data(self, self->block, self->block_len);
+    }
+    write_byte(self, 0); // block terminator
 }
 
 void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *file, int width, int height, displayio_colorspace_t colorspace, bool loop, bool dither, bool own_file) {
@@ -68,16 +194,19 @@ void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *
     self->dither = dither;
     self->own_file = own_file;
 
-    size_t nblocks = (width * height + 125) / 126;
-    self->size = nblocks * 128 + 4;
+    self->size = buffer_size_for(file);
     self->data = m_malloc_without_collect(self->size);
     self->cur = 0;
     self->error = 0;
+    self->pixels = m_malloc_without_collect(width * height);
+    self->lzw_table = m_malloc_without_collect(GIFIO_LZW_TABLE_SIZE * sizeof(*self->lzw_table));
+    self->lzw_next_code = MAX_CODE;
+    self->frame_count = 0;
 
     write_data(self, "GIF89a", 6);
     write_word(self, width);
     write_word(self, height);
-    write_data(self, (uint8_t []) {0xF6, 0x00, 0x00}, 3);
+    write_data(self, (uint8_t []) {0xF7, 0x00, 0x00}, 3); // 256 entry global palette
 
     switch (colorspace) {
         case DISPLAYIO_COLORSPACE_RGB565:
@@ -114,13 +243,17 @@ void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *
         }
     }
 
+    // Only the transparent entry of the rest of the palette is used
+    for (int i = 128; i < 256; i++) {
+        write_data(self, (uint8_t []) {0, 0, 0}, 3);
+    }
+
     if (loop) {
         write_data(self, (uint8_t []) {'!', 0xFF, 0x0B}, 3);
         write_data(self, "NETSCAPE2.0", 11);
         write_data(self, (uint8_t []) {0x03, 0x01, 0x00, 0x00, 0x00}, 5);
     }
 
-    flush_data(self);
     handle_error(self);
 }
 
@@ -154,103 +287,108 @@ static const uint8_t g_bayer[4][4] = {
     {31, 14, 26, 10}
 };
 
-void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_buffer_info_t *bufinfo, int16_t delay) {
-    if (delay) {
-        write_data(self, (uint8_t []) {'!', 0xF9, 0x04, 0x04}, 4);
-        write_word(self, delay);
-        write_word(self, 0); // end
+// Convert the pixel at (x, y) to a palette index
+static uint8_t quantize(gifio_gifwriter_t *self, const void *buf, int x, int y) {
+    int i = y * self->width + x;
+    if (self->colorspace == DISPLAYIO_COLORSPACE_L8) {
+        return ((const uint8_t *)buf)[i] >> 1;
     }
 
-    write_byte(self, 0x2C);
-    write_long(self, 0);
-    write_word(self, self->width);
-    write_word(self, self->height);
-    write_data(self, (uint8_t []) {0x00, 0x07}, 2); // 7-bits
+    int pixel = ((const uint16_t *)buf)[i];
+    if (self->byteswap) {
+        pixel = __builtin_bswap16(pixel);
+    }
+    if (!self->dither) {
+        int red = (pixel >> (11 + (5 - 2))) & 0x3;
+        int green = (pixel >> (5 + (6 - 3))) & 0x7;
+        int blue = (pixel >> (0 + (5 - 2))) & 0x3;
+        return (red << 5) | (green << 2) | blue;
+    }
 
-    int pixel_count = self->width * self->height;
-    int blocks = (pixel_count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    int red = (pixel >> 8) & 0xf8;
+    int green = (pixel >> 3) & 0xfc;
+    int blue = (pixel << 3) & 0xf8;
 
-    uint8_t *data = self->data + self->cur;
+    red = MAX(0, red - rb_bayer[x % 4][y % 4]);
+    green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
+    blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
 
-    if (self->colorspace == DISPLAYIO_COLORSPACE_L8) {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(pixel_count - 1), false);
-
-        uint8_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            assert(pixel_count >= 0);
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                *data++ = (*pixels++) >> 1;
-            }
-        }
-    } else if (!self->dither) {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
-
-        uint16_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
+    return ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6);
+}
+
+void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_buffer_info_t *bufinfo, int16_t delay) {
+    int width = self->width;
+    int height = self->height;
+    int pixel_count = width * height;
+    int bytes_per_pixel = self->colorspace == DISPLAYIO_COLORSPACE_L8 ? 1 : 2;
+    mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(bytes_per_pixel * pixel_count - 1), false);
+    const void *buf = bufinfo->buf;
+    uint8_t *pixels = self->pixels;
+
+    // After the first frame, only the rectangle that changed is written, and
+    // the pixels in it that didn't change are transparent
+    bool delta = self->frame_count > 0;
+    int x1 = 0, y1 = 0, x2 = width, y2 = height;
+    if (delta) {
+        x1 = width;
+        y1 = height;
+        x2 = y2 = 0;
+        for (int y = 0; y < height; y++) {
+            const uint8_t *row = pixels + y * width;
+            for (int x = 0; x < width; x++) {
+                if (quantize(self, buf, x, y) != row[x]) {
+                    x1 = MIN(x1, x);
+                    x2 = MAX(x2, x + 1);
+                    y1 = MIN(y1, y);
+                    y2 = y + 1;
                 }
-                int red = (pixel >> (11 + (5 - 2))) & 0x3;
-                int green = (pixel >> (5 + (6 - 3))) & 0x7;
-                int blue = (pixel >> (0 + (5 - 2))) & 0x3;
-                *data++ = (red << 5) | (green << 2) | blue;
             }
         }
-    } else {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
-
-        uint16_t *pixels = bufinfo->buf;
-        int x = 0, y = 0;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
-                }
-                int red = (pixel >> 8) & 0xf8;
-                int green = (pixel >> 3) & 0xfc;
-                int blue = (pixel << 3) & 0xf8;
-
-                red = MAX(0, red - rb_bayer[x % 4][y % 4]);
-                green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
-                blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
-                x++;
-                if (x == self->width) {
-                    x = 0;
-                    y++;
-                }
+        if (x1 >= x2) {
+            // Nothing changed, but the frame still takes its time
+            x1 = y1 = 0;
+            x2 = y2 = 1;
+        }
+    }
 
-                *data++ = ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6);
+    if (delay || delta) {
+        // Graphic control extension: leave the frame in place, transparency
+        write_data(self, (uint8_t []) {'!', 0xF9, 0x04, delta ? 0x05 : 0x04}, 4);
+        write_word(self, delay);
+        write_data(self, (uint8_t []) {delta ? TRANSPARENT_INDEX : 0, 0}, 2); // end
+    }
+
+    write_byte(self, 0x2C);
+    write_word(self, x1);
+    write_word(self, y1);
+    write_word(self, x2 - x1);
+    write_word(self, y2 - y1);
+    write_byte(self, 0x00);
+
+    lzw_start(self);
+    for (int y = y1; y < y2; y++) {
+        uint8_t *row = pixels + y * width;
+        for (int x = x1; x < x2; x++) {
+            uint8_t index = quantize(self, buf, x, y);
+            if (delta && index == row[x]) {
+                lzw_add_pixel(self, TRANSPARENT_INDEX);
+            } else {
+                lzw_add_pixel(self, index);
             }
+            row[x] = index;
         }
     }
+    lzw_finish(self);
 
-    self->cur = data - self->data;
-
-    write_data(self, (uint8_t []) {0x01, 0x81, 0x00}, 3); // end code
-    flush_data(self);
+    self->frame_count++;
     handle_error(self);
 }
 
 void shared_module_gifio_gifwriter_close(gifio_gifwriter_t *self) {
     write_byte(self, ';');
     flush_data(self);
+    self->pixels = NULL;
+    self->lzw_table = NULL;
 
     int error = 0;
     self->file_proto->ioctl(self->file, self->own_file ? MP_STREAM_CLOSE : MP_STREAM_FLUSH, 0, &error);
@@ -10,6 +10,9 @@
 #include "py/stream.h"
 #include "shared-bindings/displayio/__init__.h"
 
+// Open addressed, with room for all 12 bit codes
+#define GIFIO_LZW_TABLE_SIZE (5003)
+
 typedef struct gifio_gifwriter {
     mp_obj_base_t base;
     mp_obj_t *file;
@@ -19,6 +22,16 @@ typedef struct gifio_gifwriter {
     int error;
     uint8_t *data;
     size_t cur, size;
+    uint8_t *pixels; // palette indices of the last frame
+    uint32_t *lzw_table;
+    uint32_t lzw_bits;
+    int lzw_bit_count;
+    int lzw_code_size;
+    int lzw_next_code;
+    int lzw_prefix;
+    int frame_count;
+    uint8_t block[255];
+    uint8_t block_len;
     bool own_file;
     bool byteswap;
     bool dither;
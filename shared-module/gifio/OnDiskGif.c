@@ -52,8 +52,9 @@ static void GIFDraw(GIFDRAW *pDraw) {
     displayio_bitmap_t *bitmap = ondiskgif->bitmap;
     displayio_palette_t *palette = ondiskgif->palette;
 
-    // Update the palette if we have one in RGB888
-    if (palette != NULL) {
+    // Update the palette if we have one in RGB888. It can only change between
+    // frames, so it is only done on the first line.
+    if (palette != NULL && pDraw->y == 0) {
         uint8_t *pPal = pDraw->pPalette24;
         for (int p = 0; p < 256; p++) {
             uint8_t r = *pPal++;
@@ -80,22 +81,27 @@ static void GIFDraw(GIFDRAW *pDraw) {
     int32_t row_start = (pDraw->y + pDraw->iY) * bitmap->stride;
     uint32_t *row = bitmap->data + row_start;
 
-    if (pDraw->ucDisposalMethod == 2) { // restore to background color
-        // Not supported currently. Need to reset the area the previous frame occupied
-        // to the background color before the previous frame was drawn
-        // See: https://github.com/bitbank2/AnimatedGIF/issues/3
-
-        // To workaround clear the gif.bitmap object yourself as required.
-    }
-
     if (palette != NULL) {
         uint8_t *s = pDraw->pPixels;
         uint8_t *d = (uint8_t *)row;
 
         d += pDraw->iX;
-        for (int x = 0; x < iWidth; x++)
-        {
-            *d++ = *s++;
+        if (pDraw->ucHasTransparency == 1) {
+            // Transparent pixels leave the previous frame in place
+            uint8_t c, ucTransparent = pDraw->ucTransparent;
+            for (int x = 0; x < iWidth; x++)
+            {
+                c = *s++;
+                if (c != ucTransparent) {
+                    *d = c;
+                }
+                d++;
+            }
+        } else {
+            for (int x = 0; x < iWidth; x++)
+            {
+                *d++ = *s++;
+            }
         }
     } else {
         // No palette writing RGB565_SWAPPED right to bitmap buffer
@@ -173,6 +179,9 @@ void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_
     common_hal_displayio_bitmap_construct(bitmap, self->gif.iCanvasWidth, self->gif.iCanvasHeight, bpp);
     self->bitmap = bitmap;
 
+    self->dirty_area = (displayio_area_t) {0};
+    self->dispose_area = (displayio_area_t) {0};
+
     GIFINFO info;
     GIF_getInfo(&self->gif, &info);
     self->duration = info.iDuration;
@@ -227,19 +236,73 @@ int32_t common_hal_gifio_ondiskgif_get_max_delay(gifio_ondiskgif_t *self) {
     return self->max_delay;
 }
 
+void common_hal_gifio_ondiskgif_get_dirty_area(gifio_ondiskgif_t *self, displayio_area_t *area) {
+    displayio_area_copy(&self->dirty_area, area);
+}
+
+// Restore the area of the previous frame to the background color, for frames
+// with disposal method 2
+static void ondiskgif_dispose(gifio_ondiskgif_t *self) {
+    displayio_area_t *area = &self->dispose_area;
+    displayio_bitmap_t *bitmap = self->bitmap;
+    for (int y = area->y1; y < area->y2; y++) {
+        uint32_t *row = bitmap->data + y * bitmap->stride;
+        if (self->palette != NULL) {
+            memset((uint8_t *)row + area->x1, self->dispose_value, area->x2 - area->x1);
+        } else {
+            uint16_t *d = (uint16_t *)row;
+            for (int x = area->x1; x < area->x2; x++) {
+                d[x] = self->dispose_value;
+            }
+        }
+    }
+}
+
 uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool setDirty) {
     int nextDelay = 0;
     int result = 0;
+
+    // Only the frame's rectangle and what the last frame disposed of change
+    displayio_area_t dirty_area = self->dispose_area;
+    if (!displayio_area_empty(&self->dispose_area)) {
+        ondiskgif_dispose(self);
+        self->dispose_area.x2 = self->dispose_area.x1;
+    }
+
     result = GIF_playFrame(&self->gif, &nextDelay, self);
 
-    if ((result >= 0) && (setDirty)) {
-        displayio_area_t dirty_area = {
+    if (result >= 0) {
+        GIFIMAGE *gif = &self->gif;
+        displayio_area_t frame_area = {
+            .x1 = gif->iX,
+            .y1 = gif->iY,
+            .x2 = gif->iX + gif->iWidth,
+            .y2 = gif->iY + gif->iHeight,
+        };
+        displayio_area_t bitmap_area = {
             .x1 = 0,
             .y1 = 0,
             .x2 = self->bitmap->width,
             .y2 = self->bitmap->height,
         };
+        if (!displayio_area_compute_overlap(&frame_area, &bitmap_area, &frame_area)) {
+            frame_area.x2 = frame_area.x1;
+        }
+        displayio_area_union(&dirty_area, &frame_area, &dirty_area);
+
+        if ((gif->ucGIFBits & 0x1c) >> 2 == 2) { // restore to background color
+            self->dispose_area = frame_area;
+            if (self->palette != NULL) {
+                // Let whatever is below the bitmap show through when possible
+                self->dispose_value = (gif->ucGIFBits & 1) ? gif->ucTransparent : gif->ucBackground;
+            } else {
+                self->dispose_value = gif->pPalette[gif->ucBackground];
+            }
+        }
+    }
 
+    self->dirty_area = dirty_area;
+    if (setDirty && !displayio_area_empty(&dirty_area)) {
         displayio_bitmap_set_dirty_area(self->bitmap, &dirty_area);
     }
 
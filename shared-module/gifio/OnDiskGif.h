@@ -14,6 +14,7 @@
 #include "lib/AnimatedGIF/AnimatedGIF_circuitpy.h"
 #include "shared-module/displayio/Bitmap.h"
 #include "shared-module/displayio/Palette.h"
+#include "shared-module/displayio/area.h"
 
 #include "extmod/vfs_fat.h"
 
@@ -27,4 +28,7 @@ typedef struct {
     int32_t frame_count;
     int32_t min_delay;
     int32_t max_delay;
+    displayio_area_t dirty_area; // changed by the last frame
+    displayio_area_t dispose_area; // to restore to the background before the next frame
+    uint16_t dispose_value;
 } gifio_ondiskgif_t;
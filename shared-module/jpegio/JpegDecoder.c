@@ -4,10 +4,13 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "py/runtime.h"
 
 #include "shared-bindings/jpegio/JpegDecoder.h"
 #include "shared-bindings/bitmaptools/__init__.h"
+#include "shared-bindings/displayio/Bitmap.h"
 #include "shared-module/jpegio/JpegDecoder.h"
 
 typedef size_t (*input_func)(JDEC *jd, uint8_t *dest, size_t len);
@@ -54,6 +57,15 @@ static void check_jresult(JRESULT j) {
 
 void common_hal_jpegio_jpegdecoder_construct(jpegio_jpegdecoder_obj_t *self) {
     self->data_obj = MP_OBJ_NULL;
+    self->rows_callback = MP_OBJ_NULL;
+}
+
+// The decoder can't be used again from inside its own rows_ready callback,
+// because the JDEC is in the middle of a decode
+static void check_not_busy(jpegio_jpegdecoder_obj_t *self) {
+    if (self->rows_callback != MP_OBJ_NULL) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q in use"), MP_QSTR_JpegDecoder);
+    }
 }
 
 void common_hal_jpegio_jpegdecoder_close(jpegio_jpegdecoder_obj_t *self) {
@@ -101,6 +113,7 @@ static size_t file_input(JDEC *jd, uint8_t *dest, size_t len) {
 }
 
 mp_obj_t common_hal_jpegio_jpegdecoder_set_source_file(jpegio_jpegdecoder_obj_t *self, mp_obj_t file_obj) {
+    check_not_busy(self);
     self->data_obj = file_obj;
     return common_hal_jpegio_jpegdecoder_decode_common(self, file_input);
 }
@@ -118,6 +131,7 @@ static size_t buffer_input(JDEC *jd, uint8_t *dest, size_t len) {
 }
 
 mp_obj_t common_hal_jpegio_jpegdecoder_set_source_buffer(jpegio_jpegdecoder_obj_t *self, mp_obj_t buffer_obj) {
+    check_not_busy(self);
     self->data_obj = buffer_obj;
     mp_get_buffer_raise(buffer_obj, &self->bufinfo, MP_BUFFER_READ);
     return common_hal_jpegio_jpegdecoder_decode_common(self, buffer_input);
@@ -125,64 +139,174 @@ mp_obj_t common_hal_jpegio_jpegdecoder_set_source_buffer(jpegio_jpegdecoder_obj_
 
 #define DECODER_CONTINUE (1)
 #define DECODER_INTERRUPT (0)
+
+static void check_open(jpegio_jpegdecoder_obj_t *self) {
+    check_not_busy(self);
+    if (self->data_obj == MP_OBJ_NULL) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q() without %q()"), MP_QSTR_decode, MP_QSTR_open);
+    }
+}
+
+uint16_t common_hal_jpegio_jpegdecoder_get_width(jpegio_jpegdecoder_obj_t *self) {
+    check_open(self);
+    return self->decoder.width;
+}
+
+uint16_t common_hal_jpegio_jpegdecoder_get_height(jpegio_jpegdecoder_obj_t *self) {
+    check_open(self);
+    return self->decoder.height;
+}
+
+// Copy the pixels x1..x2, y1..y2 (exclusive) of the decoded rectangle `rect`
+// to the destination bitmap, with (x1, y1) placed at (x, y).
+static void copy_pixels(jpegio_jpegdecoder_obj_t *self, const uint8_t *data, const JRECT *rect,
+    int x1, int y1, int x2, int y2, int x, int y) {
+    displayio_bitmap_t *dest = self->dest;
+    x2 = MIN(x2, x1 + dest->width - x);
+    y2 = MIN(y2, y1 + dest->height - y);
+    if (x1 >= x2 || y1 >= y2) {
+        return;
+    }
+
+    // Decoded pixels are packed, one byte of luma or two of RGB565 each
+    size_t bytes_per_pixel = self->decoder.gray ? 1 : 2;
+    size_t src_stride = (rect->right - rect->left + 1) * bytes_per_pixel;
+    const uint8_t *src = data + (y1 - rect->top) * src_stride + (x1 - rect->left) * bytes_per_pixel;
+    int width = x2 - x1;
+    int height = y2 - y1;
+
+    if (dest->bits_per_value == bytes_per_pixel * 8 && self->skip_source_index_none && self->skip_dest_index_none) {
+        // Already in the bitmap's format, copy whole rows, or for a tiled
+        // bitmap the pieces of rows in each tile
+        for (int j = 0; j < height; j++) {
+            for (int i = 0, n; i < width; i += n) {
+                n = MIN(width - i, displayio_bitmap_row_run(dest, x + i));
+                uint8_t *row = (uint8_t *)dest->data + displayio_bitmap_byte_offset(dest, x + i, y + j);
+                memcpy(row, src + j * src_stride + i * bytes_per_pixel, n * bytes_per_pixel);
+            }
+        }
+    } else {
+        for (int j = 0; j < height; j++) {
+            const uint8_t *src_row = src + j * src_stride;
+            for (int i = 0; i < width; i++) {
+                uint32_t value = bytes_per_pixel == 1 ? src_row[i] : ((const uint16_t *)(const void *)src_row)[i];
+                if (!self->skip_source_index_none && value == self->skip_source_index) {
+                    continue;
+                }
+                if (!self->skip_dest_index_none &&
+                    common_hal_displayio_bitmap_get_pixel(dest, x + i, y + j) == self->skip_dest_index) {
+                    continue;
+                }
+                displayio_bitmap_write_pixel(dest, x + i, y + j, value);
+            }
+        }
+    }
+
+    displayio_area_t area = { x, y, x + width, y + height, NULL };
+    displayio_bitmap_set_dirty_area(dest, &area);
+}
+
 static int bitmap_output(JDEC *jd, void *data, JRECT *rect) {
     jpegio_jpegdecoder_obj_t *self = CONTAINER_OF(jd, jpegio_jpegdecoder_obj_t, decoder);
-    int src_width = rect->right - rect->left + 1, src_pixel_stride = src_width /* in units of pixels! */, src_height = rect->bottom - rect->top + 1;
-
-    displayio_bitmap_t src = {
-        .width = src_width,
-        .height = src_height,
-        .data = data,
-        .stride = src_pixel_stride / 2, /* in units of uint32_t */
-        .bits_per_value = 16,
-        .x_shift = 1,
-        .x_mask = 1,
-        .bitmask = 0xffff,
-    };
-
-    int x = self->x;
-    int y = self->y;
-    int x1 = self->lim.x1 - rect->left;
-    int x2 = self->lim.x2 - rect->left;
-    int y1 = self->lim.y1 - rect->top;
-    int y2 = self->lim.y2 - rect->top;
+    bitmaptools_rect_t *lim = &self->lim;
 
-    if (y2 < y1) {
+    if (rect->top >= lim->y2) {
         // The last row in the source image to copy FROM is above of this, so
         // no more pixels on any rows
         return DECODER_INTERRUPT;
     }
 
-    y2 = MIN(y2, src_height);
-    if (x2 < x1) {
-        // The last column in the source image to copy FROM is left of this, so
-        // no more pixels on this row but could be on subsequent rows
+    int x1 = MAX(lim->x1, rect->left);
+    int y1 = MAX(lim->y1, rect->top);
+    int x2 = MIN(lim->x2, rect->right + 1);
+    int y2 = MIN(lim->y2, rect->bottom + 1);
+    copy_pixels(self, data, rect, x1, y1, x2, y2, self->x + x1 - lim->x1, self->y + y1 - lim->y1);
+    return DECODER_CONTINUE;
+}
+
+// Pass the rows decoded so far to the callback, so the band bitmap can be reused
+static void rows_flush(jpegio_jpegdecoder_obj_t *self) {
+    if (self->band_rows == 0) {
+        return;
+    }
+    mp_int_t y = self->y - self->lim.y1;
+    mp_int_t rows = self->band_rows;
+    self->band_rows = 0;
+    mp_call_function_2(self->rows_callback, MP_OBJ_NEW_SMALL_INT(y), MP_OBJ_NEW_SMALL_INT(rows));
+}
+
+static int rows_output(JDEC *jd, void *data, JRECT *rect) {
+    jpegio_jpegdecoder_obj_t *self = CONTAINER_OF(jd, jpegio_jpegdecoder_obj_t, decoder);
+    bitmaptools_rect_t *lim = &self->lim;
+
+    if (rect->top >= lim->y2) {
+        return DECODER_INTERRUPT;
+    }
+
+    int x1 = MAX(lim->x1, rect->left);
+    int y1 = MAX(lim->y1, rect->top);
+    int x2 = MIN(lim->x2, rect->right + 1);
+    int y2 = MIN(lim->y2, rect->bottom + 1);
+    if (x1 >= x2 || y1 >= y2) {
         return DECODER_CONTINUE;
     }
-    x2 = MIN(x2, src_width);
 
-    // The first column in the source image to copy FROM is left of this, so copy starting with
-    // *local source* x1 equal to 0, and *target* x adjusted right by the same amount
-    if (x1 < 0) {
-        x += -x1;
-        x1 = 0;
+    // Here self->y is the first image row held in the band bitmap
+    if (y2 - self->y > self->dest->height) {
+        // A new row of MCUs that doesn't fit below the ones already decoded
+        rows_flush(self);
+        self->y = y1;
     }
+    copy_pixels(self, data, rect, x1, y1, x2, y2, x1 - lim->x1, y1 - self->y);
+    self->band_rows = MAX(self->band_rows, y2 - self->y);
+    return DECODER_CONTINUE;
+}
 
-    // the same, but for Y coordinates
-    if (y1 < 0) {
-        y += -y1;
-        y1 = 0;
+static JRESULT decode_common(jpegio_jpegdecoder_obj_t *self, displayio_bitmap_t *bitmap, int scale,
+    int (*outfunc)(JDEC *, void *, JRECT *)) {
+    if (bitmap->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
     }
+    self->dest = bitmap;
+    // Luma is decoded straight into 8 bit bitmaps instead of RGB565
+    self->decoder.gray = bitmap->bits_per_value == 8;
 
-    // blit takes care of x, y out of range
-    assert(x1 >= 0);
-    assert(y1 >= 0);
-    // blit takes care of x1 >= x2 and y1 >= y2 cases
-    assert(x2 <= src_width);
-    assert(y2 <= src_height);
+    bitmaptools_rect_t *lim = &self->lim;
+    if (lim->x1 >= lim->x2 || lim->y1 >= lim->y2) {
+        return JDR_OK;
+    }
+    // MCUs outside of the region aren't transformed, and decoding stops below it
+    JRECT roi = {
+        .left = lim->x1,
+        .right = lim->x2 - 1,
+        .top = lim->y1,
+        .bottom = lim->y2 - 1,
+    };
+    return jd_decomp_rect(&self->decoder, outfunc, scale, &roi);
+}
 
-    common_hal_bitmaptools_blit(self->dest, &src, x, y, x1, y1, x2, y2, self->skip_source_index, self->skip_source_index_none, self->skip_dest_index, self->skip_dest_index_none);
-    return 1;
+// Decode, then close the decoder whether or not decoding, reading the stream
+// or the rows_ready callback raised
+static void decode_and_close(jpegio_jpegdecoder_obj_t *self, displayio_bitmap_t *bitmap, int scale,
+    int (*outfunc)(JDEC *, void *, JRECT *)) {
+    JRESULT result;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        result = decode_common(self, bitmap, scale, outfunc);
+        if (outfunc == rows_output && (result == JDR_OK || result == JDR_INTR)) {
+            rows_flush(self);
+        }
+        nlr_pop();
+    } else {
+        self->rows_callback = MP_OBJ_NULL;
+        common_hal_jpegio_jpegdecoder_close(self);
+        nlr_raise(MP_OBJ_FROM_PTR(nlr.ret_val));
+    }
+    self->rows_callback = MP_OBJ_NULL;
+    common_hal_jpegio_jpegdecoder_close(self);
+    if (result != JDR_INTR) {
+        check_jresult(result);
+    }
 }
 
 void common_hal_jpegio_jpegdecoder_decode_into(
@@ -191,22 +315,40 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     bitmaptools_rect_t *lim,
     uint32_t skip_source_index, bool skip_source_index_none,
     uint32_t skip_dest_index, bool skip_dest_index_none) {
-    if (self->data_obj == MP_OBJ_NULL) {
-        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q() without %q()"), MP_QSTR_decode, MP_QSTR_open);
-    }
+    check_open(self);
 
     self->x = x;
     self->y = y;
     self->lim = *lim;
+    // Pixels that would land outside of the bitmap don't need decoding
+    self->lim.x2 = MIN(self->lim.x2, self->lim.x1 + bitmap->width - x);
+    self->lim.y2 = MIN(self->lim.y2, self->lim.y1 + bitmap->height - y);
     self->skip_source_index = skip_source_index;
     self->skip_source_index_none = skip_source_index_none;
     self->skip_dest_index = skip_dest_index;
     self->skip_dest_index_none = skip_dest_index_none;
 
-    self->dest = bitmap;
-    JRESULT result = jd_decomp(&self->decoder, bitmap_output, scale);
-    common_hal_jpegio_jpegdecoder_close(self);
-    if (result != JDR_INTR) {
-        check_jresult(result);
-    }
+    decode_and_close(self, bitmap, scale, bitmap_output);
+}
+
+void common_hal_jpegio_jpegdecoder_decode_rows(
+    jpegio_jpegdecoder_obj_t *self,
+    displayio_bitmap_t *bitmap, int scale,
+    bitmaptools_rect_t *lim, mp_obj_t callback) {
+    check_open(self);
+
+    // The bitmap has to hold at least one row of MCUs of the region
+    int mcu_height = (self->decoder.msy * 8) >> scale;
+    mp_arg_validate_int_min(bitmap->width, lim->x2 - lim->x1, MP_QSTR_width);
+    mp_arg_validate_int_min(bitmap->height, MIN(mcu_height, lim->y2 - lim->y1), MP_QSTR_height);
+
+    self->lim = *lim;
+    self->x = 0;
+    self->y = lim->y1;
+    self->band_rows = 0;
+    self->rows_callback = callback;
+    self->skip_source_index_none = true;
+    self->skip_dest_index_none = true;
+
+    decode_and_close(self, bitmap, scale, rows_output);
 }
@@ -24,4 +24,6 @@ typedef struct jpegio_jpegdecoder_obj {
     uint32_t skip_source_index, skip_dest_index;
     bool skip_source_index_none, skip_dest_index_none;
     uint8_t scale;
+    mp_obj_t rows_callback;
+    uint16_t band_rows;
 } jpegio_jpegdecoder_obj_t;
@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <limits.h>
 #include <string.h>
 
 #include "py/gc.h"
@@ -12,36 +13,92 @@
 #include "shared-bindings/qrio/QRInfo.h"
 #include "shared-module/qrio/QRDecoder.h"
 
-void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *self, int width, int height) {
+// Size quirc's image to a region of interest. If quirc can't allocate it, it
+// keeps its old image, so raise before anything that depends on the size changes.
+static void qrdecoder_resize(qrdecoder_qrdecoder_obj_t *self, int x1, int y1, int x2, int y2) {
+    int width = (x2 - x1) / self->scale;
+    int height = (y2 - y1) / self->scale;
+    int quirc_width, quirc_height;
+    quirc_begin(self->quirc, &quirc_width, &quirc_height);
+    if ((width != quirc_width || height != quirc_height) &&
+        quirc_resize(self->quirc, width, height) < 0) {
+        m_malloc_fail(width * height);
+    }
+}
+
+static uint16_t *qrdecoder_alloc_row_sums(qrdecoder_qrdecoder_obj_t *self, int width) {
+    return m_malloc_without_collect(MAX(1, width / self->scale) * sizeof(uint16_t));
+}
+
+void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *self, int width, int height, int scale, bool binarize) {
+    self->width = width;
+    self->height = height;
+    self->scale = scale;
+    self->binarize = binarize;
+    self->track = false;
+    self->row_sums = qrdecoder_alloc_row_sums(self, width);
     self->quirc = quirc_new();
-    quirc_resize(self->quirc, width, height);
+    shared_module_qrio_qrdecoder_reset_roi(self);
 }
 
 int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *self) {
-    int height;
-    quirc_begin(self->quirc, NULL, &height);
-    return height;
+    return self->height;
 }
 
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *self) {
-    int width;
-    quirc_begin(self->quirc, &width, NULL);
-    return width;
+    return self->width;
 }
+
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *self, int height) {
-    if (height != shared_module_qrio_qrdecoder_get_height(self)) {
-        int width = shared_module_qrio_qrdecoder_get_width(self);
-        quirc_resize(self->quirc, width, height);
+    if (height != self->height) {
+        shared_module_qrio_qrdecoder_set_roi(self, 0, 0, self->width, height);
+        self->height = height;
     }
 }
 
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *self, int width) {
-    if (width != shared_module_qrio_qrdecoder_get_width(self)) {
-        int height = shared_module_qrio_qrdecoder_get_height(self);
-        quirc_resize(self->quirc, width, height);
+    if (width != self->width) {
+        uint16_t *row_sums = qrdecoder_alloc_row_sums(self, width);
+        shared_module_qrio_qrdecoder_set_roi(self, 0, 0, width, self->height);
+        self->width = width;
+        self->row_sums = row_sums;
     }
 }
 
+int shared_module_qrio_qrdecoder_get_scale(qrdecoder_qrdecoder_obj_t *self) {
+    return self->scale;
+}
+
+mp_obj_t shared_module_qrio_qrdecoder_get_roi(qrdecoder_qrdecoder_obj_t *self) {
+    mp_obj_t elems[4] = {
+        mp_obj_new_int(self->roi_x1),
+        mp_obj_new_int(self->roi_y1),
+        mp_obj_new_int(self->roi_x2),
+        mp_obj_new_int(self->roi_y2),
+    };
+    return mp_obj_new_tuple(4, elems);
+}
+
+void shared_module_qrio_qrdecoder_set_roi(qrdecoder_qrdecoder_obj_t *self, int x1, int y1, int x2, int y2) {
+    qrdecoder_resize(self, x1, y1, x2, y2);
+    self->roi_x1 = x1;
+    self->roi_y1 = y1;
+    self->roi_x2 = x2;
+    self->roi_y2 = y2;
+}
+
+void shared_module_qrio_qrdecoder_reset_roi(qrdecoder_qrdecoder_obj_t *self) {
+    shared_module_qrio_qrdecoder_set_roi(self, 0, 0, self->width, self->height);
+}
+
+bool shared_module_qrio_qrdecoder_get_track(qrdecoder_qrdecoder_obj_t *self) {
+    return self->track;
+}
+
+void shared_module_qrio_qrdecoder_set_track(qrdecoder_qrdecoder_obj_t *self, bool track) {
+    self->track = track;
+}
+
 static mp_obj_t data_type(int type) {
     switch (type) {
         case QUIRC_ECI_ISO_8859_1:
@@ -78,50 +135,190 @@ static mp_obj_t data_type(int type) {
     return mp_obj_new_int(type);
 }
 
-static void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_pixel_policy_t policy) {
-    int width, height;
-    uint8_t *framebuffer = quirc_begin(self->quirc, &width, &height);
-    uint8_t *src = buf;
+// Add `scale` source pixels at a time into each column sum of the scaled row.
+// `value` reads the pixel at `src`, which steps by `step` elements.
+#define ADD_ROW(type, step, value) do { \
+        const type *src = (const type *)row; \
+        for (int x = 0; x < width; x++) { \
+            uint32_t sum = 0; \
+            for (int k = 0; k < scale; k++, src += (step)) { \
+                sum += (value); \
+            } \
+            sums[x] += sum; \
+        } \
+} while (0)
 
+static void add_row(uint16_t *sums, const uint8_t *row, int width, int scale, qrio_pixel_policy_t policy) {
     switch (policy) {
-        case QRIO_RGB565: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (src16[i] >> 3) & 0xfc;
-            }
+        case QRIO_RGB565:
+            ADD_ROW(uint16_t, 1, (*src >> 3) & 0xfc);
             break;
-        }
-        case QRIO_RGB565_SWAPPED: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
-            }
+        case QRIO_RGB565_SWAPPED:
+            ADD_ROW(uint16_t, 1, (__builtin_bswap16(*src) >> 3) & 0xfc);
             break;
-        }
         case QRIO_EVERY_BYTE:
-            memcpy(framebuffer, src, width * height);
+            ADD_ROW(uint8_t, 1, *src);
             break;
-
         case QRIO_ODD_BYTES:
-            src++;
+            row++;
             MP_FALLTHROUGH;
-
         case QRIO_EVEN_BYTES:
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = src[2 * i];
-            }
+            ADD_ROW(uint8_t, 2, *src);
             break;
     }
+}
+
+// Whether the runs, ending with a black one, look like a slice through the
+// middle of a finder pattern: black, white, black, white, black in the ratio
+// 1:1:3:1:1
+static bool finder_runs(const uint16_t runs[5]) {
+    int total = runs[0] + runs[1] + runs[2] + runs[3] + runs[4];
+    for (int i = 0; i < 5; i++) {
+        // Each unit run is 0.5 to 1.5 modules, and the middle 1.5 to 4.5
+        int r = runs[i] * 14;
+        int unit = i == 2 ? 3 : 1;
+        if (r < total * unit || r > 3 * total * unit) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Threshold a row of the scaled image against the average of the pixels
+// around each one, as quirc itself does, writing black as 0 and white as 255.
+// Returns whether the row crosses anything like a finder pattern.
+static bool binarize_row(uint8_t *out, const uint16_t *grey, int width) {
+    int half = MAX(1, width / 16);
+    uint32_t sum = 0;
+    int n = 0;
+    for (int x = 0; x < MIN(half, width); x++) {
+        sum += grey[x];
+        n++;
+    }
+    uint16_t runs[5] = { 0 };
+    int run = 0;
+    bool black = false;
+    bool finder = false;
+    for (int x = 0; x < width; x++) {
+        if (x + half < width) {
+            sum += grey[x + half];
+            n++;
+        }
+        if (x - half - 1 >= 0) {
+            sum -= grey[x - half - 1];
+            n--;
+        }
+        bool b = grey[x] * (uint32_t)n * 16 < sum * 15;
+        out[x] = b ? 0 : 255;
+        if (b == black) {
+            run++;
+            continue;
+        }
+        memmove(runs, runs + 1, 4 * sizeof(uint16_t));
+        runs[4] = run;
+        if (black && finder_runs(runs)) {
+            finder = true;
+        }
+        black = b;
+        run = 1;
+    }
+    return finder;
+}
+
+// Convert the region of interest of `buf` to quirc's image in one pass,
+// averaging each scale×scale block of pixels and, if binarizing, thresholding
+// it. Returns false if binarizing found nothing like a finder pattern, so
+// there is no code for quirc to find.
+static bool quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_pixel_policy_t policy) {
+    int width, height;
+    uint8_t *framebuffer = quirc_begin(self->quirc, &width, &height);
+    int scale = self->scale;
+    int bytes_per_pixel = policy == QRIO_EVERY_BYTE ? 1 : 2;
+    size_t stride = self->width * bytes_per_pixel;
+    const uint8_t *src = (const uint8_t *)buf + self->roi_y1 * stride + self->roi_x1 * bytes_per_pixel;
+    uint16_t *sums = self->row_sums;
+    // Dividing by scale² as a multiply and shift
+    uint32_t reciprocal = 65536 / (scale * scale);
+    bool finder = false;
+
+    for (int y = 0; y < height; y++) {
+        memset(sums, 0, width * sizeof(uint16_t));
+        for (int k = 0; k < scale; k++, src += stride) {
+            add_row(sums, src, width, scale, policy);
+        }
+        uint8_t *out = framebuffer + y * width;
+        if (!self->binarize) {
+            for (int x = 0; x < width; x++) {
+                out[x] = MIN(255, (sums[x] * reciprocal + 32768) >> 16);
+            }
+            continue;
+        }
+        for (int x = 0; x < width; x++) {
+            sums[x] = MIN(255, (sums[x] * reciprocal + 32768) >> 16);
+        }
+        if (binarize_row(out, sums, width)) {
+            finder = true;
+        }
+    }
+    return finder || !self->binarize;
+}
+
+// Fill quirc's image and find the codes in it. Returns the number found.
+static int qrdecoder_identify(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
+    if (!quirc_fill_buffer(self, bufinfo->buf, policy)) {
+        // quirc_begin has already forgotten the last frame's codes
+        return 0;
+    }
     quirc_end(self->quirc);
+    return quirc_count(self->quirc);
 }
 
+typedef struct {
+    int x1, y1, x2, y2;
+} qrdecoder_bounds_t;
+
+// Convert the corners of self->code to image pixels and add them to `bounds`
+static void qrdecoder_code_corners(qrdecoder_qrdecoder_obj_t *self, qrdecoder_bounds_t *bounds) {
+    for (int i = 0; i < 4; i++) {
+        struct quirc_point *p = &self->code.corners[i];
+        p->x = self->roi_x1 + p->x * self->scale;
+        p->y = self->roi_y1 + p->y * self->scale;
+        bounds->x1 = MIN(bounds->x1, p->x);
+        bounds->y1 = MIN(bounds->y1, p->y);
+        bounds->x2 = MAX(bounds->x2, p->x);
+        bounds->y2 = MAX(bounds->y2, p->y);
+    }
+}
+
+// When tracking, search the area around the codes found in this frame next
+// time, or the whole image again if none were found
+static void qrdecoder_track(qrdecoder_qrdecoder_obj_t *self, const qrdecoder_bounds_t *bounds) {
+    if (!self->track) {
+        return;
+    }
+    if (bounds->x1 > bounds->x2) {
+        shared_module_qrio_qrdecoder_reset_roi(self);
+        return;
+    }
+    // Leave room for the code to move, and round to a coarse grid so that
+    // quirc's image is seldom resized
+    int margin = MAX(bounds->x2 - bounds->x1, bounds->y2 - bounds->y1) / 2;
+    int grid = 8 * self->scale;
+    int x1 = MAX(0, (bounds->x1 - margin) / grid * grid);
+    int y1 = MAX(0, (bounds->y1 - margin) / grid * grid);
+    int x2 = MIN(self->width, (bounds->x2 + margin + grid - 1) / grid * grid);
+    int y2 = MIN(self->height, (bounds->y2 + margin + grid - 1) / grid * grid);
+    shared_module_qrio_qrdecoder_set_roi(self, x1, y1, x2, y2);
+}
 
 mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
-    int count = quirc_count(self->quirc);
+    int count = qrdecoder_identify(self, bufinfo, policy);
+    qrdecoder_bounds_t bounds = { INT_MAX, INT_MAX, INT_MIN, INT_MIN };
     mp_obj_t result = mp_obj_new_list(0, NULL);
     for (int i = 0; i < count; i++) {
         quirc_extract(self->quirc, i, &self->code);
+        // Codes that fail to decode are still followed, as the next frame may be clearer
+        qrdecoder_code_corners(self, &bounds);
         mp_obj_t code_obj;
         if (quirc_decode(&self->code, &self->data) != QUIRC_SUCCESS) {
             continue;
@@ -133,16 +330,18 @@ mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, co
         code_obj = namedtuple_make_new((const mp_obj_type_t *)&qrio_qrinfo_type_obj, 2, 0, elems);
         mp_obj_list_append(result, code_obj);
     }
+    qrdecoder_track(self, &bounds);
     return result;
 }
 
 
 mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
-    int count = quirc_count(self->quirc);
+    int count = qrdecoder_identify(self, bufinfo, policy);
+    qrdecoder_bounds_t bounds = { INT_MAX, INT_MAX, INT_MIN, INT_MIN };
     mp_obj_t result = mp_obj_new_list(0, NULL);
     for (int i = 0; i < count; i++) {
         quirc_extract(self->quirc, i, &self->code);
+        qrdecoder_code_corners(self, &bounds);
         mp_obj_t code_obj;
         mp_obj_t elems[9] = {
             mp_obj_new_int(self->code.corners[0].x),
@@ -158,5 +357,6 @@ mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, cons
         code_obj = namedtuple_make_new((const mp_obj_type_t *)&qrio_qrposition_type_obj, 9, 0, elems);
         mp_obj_list_append(result, code_obj);
     }
+    qrdecoder_track(self, &bounds);
     return result;
 }
@@ -15,12 +15,26 @@ typedef struct qrio_qrdecoder_obj {
     struct quirc *quirc;
     struct quirc_code code;
     struct quirc_data data;
+    // One sum per column of the scaled image, used while filling it
+    uint16_t *row_sums;
+    int width, height;
+    // The part of the image that is searched, in image pixels
+    int roi_x1, roi_y1, roi_x2, roi_y2;
+    uint8_t scale;
+    bool binarize;
+    bool track;
 } qrdecoder_qrdecoder_obj_t;
 
-void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *, int width, int height);
+void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *, int width, int height, int scale, bool binarize);
 int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *);
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *);
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *, int height);
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *, int width);
+int shared_module_qrio_qrdecoder_get_scale(qrdecoder_qrdecoder_obj_t *);
+mp_obj_t shared_module_qrio_qrdecoder_get_roi(qrdecoder_qrdecoder_obj_t *);
+void shared_module_qrio_qrdecoder_set_roi(qrdecoder_qrdecoder_obj_t *, int x1, int y1, int x2, int y2);
+void shared_module_qrio_qrdecoder_reset_roi(qrdecoder_qrdecoder_obj_t *);
+bool shared_module_qrio_qrdecoder_get_track(qrdecoder_qrdecoder_obj_t *);
+void shared_module_qrio_qrdecoder_set_track(qrdecoder_qrdecoder_obj_t *, bool track);
 mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
 mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
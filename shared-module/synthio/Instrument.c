@@ -0,0 +1,141 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <string.h>
+
+#include "py/binary.h"
+#include "py/runtime.h"
+#include "shared-bindings/synthio/Instrument.h"
+#include "shared-bindings/synthio/__init__.h"
+#include "shared-module/synthio/Instrument.h"
+
+enum { ZONE_LOW_KEY, ZONE_HIGH_KEY, ZONE_ROOT_KEY, ZONE_START, ZONE_LOOP_START, ZONE_LOOP_END, ZONE_FIELDS };
+
+static void parse_samples(synthio_instrument_obj_t *self, mp_obj_t samples) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(samples, &bufinfo, MP_BUFFER_READ);
+    // Raw bytes are accepted too, so that sample data can be used where it
+    // is stored, such as in flash, without first copying it into an array.
+    bool is_bytes = bufinfo.typecode == 'B' || bufinfo.typecode == 'b' || bufinfo.typecode == BYTEARRAY_TYPECODE;
+    if (bufinfo.typecode != 'h' &&
+        !(is_bytes && (bufinfo.len % 2) == 0 && ((uintptr_t)bufinfo.buf % 2) == 0)) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'h'"), MP_QSTR_samples);
+    }
+    self->samples_obj = samples;
+    self->samples = bufinfo.buf;
+    self->sample_count = bufinfo.len / 2;
+}
+
+static void parse_zone(synthio_instrument_obj_t *self, size_t index, mp_obj_t zone_in) {
+    mp_obj_t *fields;
+    size_t len;
+    mp_obj_get_array(zone_in, &len, &fields);
+    mp_arg_validate_length(len, ZONE_FIELDS, MP_QSTR_zones);
+
+    mp_int_t low_key = mp_arg_validate_int_range(mp_obj_get_int(fields[ZONE_LOW_KEY]), 0, SYNTHIO_MIDI_NOTE_COUNT - 1, MP_QSTR_low_key);
+    mp_int_t high_key = mp_arg_validate_int_range(mp_obj_get_int(fields[ZONE_HIGH_KEY]), low_key, SYNTHIO_MIDI_NOTE_COUNT - 1, MP_QSTR_high_key);
+    mp_float_t root_key = mp_obj_get_float(fields[ZONE_ROOT_KEY]);
+    // Written so that NaN fails too
+    if (!(root_key >= 0 && root_key <= SYNTHIO_MIDI_NOTE_COUNT - 1)) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be %d-%d"), MP_QSTR_root_key, 0, SYNTHIO_MIDI_NOTE_COUNT - 1);
+    }
+    mp_float_t root_frequency = common_hal_synthio_midi_to_hz_float(root_key);
+    uint32_t start = mp_arg_validate_int_range(mp_obj_get_int(fields[ZONE_START]), 0, self->sample_count - 1, MP_QSTR_start);
+    uint32_t loop_end = mp_arg_validate_int_range(mp_obj_get_int(fields[ZONE_LOOP_END]), start + 1,
+        MIN(self->sample_count, start + SYNTHIO_INSTRUMENT_MAX_ZONE_LENGTH), MP_QSTR_loop_end);
+    uint32_t loop_start = mp_arg_validate_int_range(mp_obj_get_int(fields[ZONE_LOOP_START]), start, loop_end - 1, MP_QSTR_loop_start);
+
+    synthio_zone_t *zone = &self->zones[index];
+    zone->start = start;
+    zone->loop_start = loop_start - start;
+    zone->loop_end = loop_end - start;
+    zone->cycle_scaled = (uint32_t)MICROPY_FLOAT_C_FUN(ldexp)(self->sample_rate / root_frequency, 8);
+
+    // Where zones overlap, the first one listed plays
+    for (mp_int_t key = low_key; key <= high_key; key++) {
+        if (self->key_zone[key] == SYNTHIO_INSTRUMENT_NO_ZONE) {
+            self->key_zone[key] = index;
+        }
+    }
+}
+
+void common_hal_synthio_instrument_construct(synthio_instrument_obj_t *self,
+    mp_obj_t samples, mp_obj_t zones, uint32_t sample_rate, mp_obj_t envelope) {
+    parse_samples(self, samples);
+    mp_arg_validate_length_min(self->sample_count, 2, MP_QSTR_samples);
+    self->sample_rate = sample_rate;
+
+    mp_obj_t *zone_objs;
+    size_t zone_count;
+    mp_obj_get_array(zones, &zone_count, &zone_objs);
+    mp_arg_validate_length_range(zone_count, 1, SYNTHIO_INSTRUMENT_MAX_ZONES, MP_QSTR_zones);
+
+    // Only the zone table and key map are kept, however many notes play the instrument
+    self->zones = m_malloc_without_collect(zone_count * sizeof(synthio_zone_t));
+    self->zone_count = zone_count;
+    memset(self->key_zone, SYNTHIO_INSTRUMENT_NO_ZONE, sizeof(self->key_zone));
+    for (size_t i = 0; i < zone_count; i++) {
+        parse_zone(self, i, zone_objs[i]);
+    }
+
+    self->envelope_sample_rate = 0;
+    common_hal_synthio_instrument_set_envelope(self, envelope);
+}
+
+mp_obj_t common_hal_synthio_instrument_get_samples(synthio_instrument_obj_t *self) {
+    return self->samples_obj;
+}
+
+uint32_t common_hal_synthio_instrument_get_sample_rate(synthio_instrument_obj_t *self) {
+    return self->sample_rate;
+}
+
+mp_int_t common_hal_synthio_instrument_get_zone_count(synthio_instrument_obj_t *self) {
+    return self->zone_count;
+}
+
+mp_obj_t common_hal_synthio_instrument_zone_for_key(synthio_instrument_obj_t *self, mp_int_t key) {
+    if (key < 0 || key >= SYNTHIO_MIDI_NOTE_COUNT || self->key_zone[key] == SYNTHIO_INSTRUMENT_NO_ZONE) {
+        return mp_const_none;
+    }
+    return MP_OBJ_NEW_SMALL_INT(self->key_zone[key]);
+}
+
+mp_obj_t common_hal_synthio_instrument_get_envelope(synthio_instrument_obj_t *self) {
+    return self->envelope_obj;
+}
+
+void common_hal_synthio_instrument_set_envelope(synthio_instrument_obj_t *self, mp_obj_t envelope) {
+    if (envelope != mp_const_none) {
+        mp_arg_validate_type(envelope, (mp_obj_type_t *)&synthio_envelope_type_obj, MP_QSTR_envelope);
+        if (self->envelope_sample_rate != 0) {
+            synthio_envelope_definition_set(&self->envelope_def, envelope, self->envelope_sample_rate);
+        }
+    }
+    self->envelope_obj = envelope;
+}
+
+void synthio_instrument_recalculate(synthio_instrument_obj_t *self, int32_t sample_rate) {
+    if (sample_rate == self->envelope_sample_rate) {
+        return;
+    }
+    self->envelope_sample_rate = sample_rate;
+    if (self->envelope_obj != mp_const_none) {
+        synthio_envelope_definition_set(&self->envelope_def, self->envelope_obj, sample_rate);
+    }
+}
+
+uint8_t synthio_instrument_find_zone(synthio_instrument_obj_t *self, mp_float_t frequency) {
+    if (frequency <= 0) {
+        return SYNTHIO_INSTRUMENT_NO_ZONE;
+    }
+    // the nearest MIDI key
+    mp_float_t key = 69 + 12 * MICROPY_FLOAT_C_FUN(log)(frequency / 440) / MICROPY_FLOAT_C_FUN(log)(2);
+    mp_int_t k = (mp_int_t)MICROPY_FLOAT_C_FUN(round)(key);
+    k = MIN(SYNTHIO_MIDI_NOTE_COUNT - 1, MAX(0, k));
+    return self->key_zone[k];
+}
@@ -0,0 +1,43 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2025 Adafruit Industries
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/synthio/__init__.h"
+
+#define SYNTHIO_INSTRUMENT_NO_ZONE (0xff)
+#define SYNTHIO_INSTRUMENT_MAX_ZONES (255)
+// Positions within a zone must stay in range of the oscillator's 16.16 phase
+#define SYNTHIO_INSTRUMENT_MAX_ZONE_LENGTH (32767)
+// Keeps the cycle of the lowest root key within cycle_scaled's 24.8 fixed point
+#define SYNTHIO_INSTRUMENT_MAX_SAMPLE_RATE (131072)
+
+typedef struct {
+    uint32_t start;
+    // loop points, relative to start
+    uint16_t loop_start, loop_end;
+    // samples in one cycle of the root note, in 24.8 fixed point
+    uint32_t cycle_scaled;
+} synthio_zone_t;
+
+typedef struct synthio_instrument_obj {
+    mp_obj_base_t base;
+    mp_obj_t samples_obj, envelope_obj;
+    const int16_t *samples;
+    uint32_t sample_count;
+    uint32_t sample_rate;
+    synthio_zone_t *zones;
+    uint8_t zone_count;
+    // the zone that plays each MIDI key, or SYNTHIO_INSTRUMENT_NO_ZONE
+    uint8_t key_zone[SYNTHIO_MIDI_NOTE_COUNT];
+    synthio_envelope_definition_t envelope_def;
+    int32_t envelope_sample_rate;
+} synthio_instrument_obj_t;
+
+void synthio_instrument_recalculate(synthio_instrument_obj_t *self, int32_t sample_rate);
+uint8_t synthio_instrument_find_zone(synthio_instrument_obj_t *self, mp_float_t frequency);
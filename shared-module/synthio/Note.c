@@ -6,7 +6,9 @@
 
 #include <math.h>
 #include "py/runtime.h"
+#include "shared-module/synthio/Instrument.h"
 #include "shared-module/synthio/Note.h"
+#include "shared-bindings/synthio/Instrument.h"
 #include "shared-bindings/synthio/Note.h"
 #include "shared-bindings/synthio/__init__.h"
 
@@ -33,6 +35,14 @@ void common_hal_synthio_note_set_filter(synthio_note_obj_t *self, mp_obj_t filte
     self->filter_obj = filter_in;
 }
 
+synthio_interpolation_t common_hal_synthio_note_get_interpolation(synthio_note_obj_t *self) {
+    return self->interpolation;
+}
+
+void common_hal_synthio_note_set_interpolation(synthio_note_obj_t *self, synthio_interpolation_t value) {
+    self->interpolation = value;
+}
+
 mp_float_t common_hal_synthio_note_get_ring_frequency(synthio_note_obj_t *self) {
     return self->ring_frequency;
 }
@@ -89,6 +99,18 @@ void common_hal_synthio_note_set_envelope(synthio_note_obj_t *self, mp_obj_t env
     self->envelope_obj = envelope_in;
 }
 
+mp_obj_t common_hal_synthio_note_get_instrument_obj(synthio_note_obj_t *self) {
+    return self->instrument_obj;
+}
+
+void common_hal_synthio_note_set_instrument(synthio_note_obj_t *self, mp_obj_t instrument_in) {
+    if (instrument_in != mp_const_none) {
+        mp_arg_validate_type(instrument_in, &synthio_instrument_type, MP_QSTR_instrument);
+        self->zone = synthio_instrument_find_zone(MP_OBJ_TO_PTR(instrument_in), self->frequency);
+    }
+    self->instrument_obj = instrument_in;
+}
+
 mp_obj_t common_hal_synthio_note_get_waveform_obj(synthio_note_obj_t *self) {
     return self->waveform_obj;
 }
@@ -164,6 +186,11 @@ void synthio_note_recalculate(synthio_note_obj_t *self, int32_t sample_rate) {
 
 void synthio_note_start(synthio_note_obj_t *self, int32_t sample_rate) {
     synthio_note_recalculate(self, sample_rate);
+    if (self->instrument_obj != mp_const_none) {
+        synthio_instrument_obj_t *instrument = MP_OBJ_TO_PTR(self->instrument_obj);
+        synthio_instrument_recalculate(instrument, sample_rate);
+        self->zone = synthio_instrument_find_zone(instrument, self->frequency);
+    }
     synthio_biquad_filter_reset(&self->filter_state);
 }
 
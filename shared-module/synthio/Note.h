@@ -10,6 +10,7 @@
 #include "shared-module/synthio/Biquad.h"
 #include "shared-module/synthio/LFO.h"
 #include "shared-bindings/synthio/__init__.h"
+#include "shared-bindings/synthio/Note.h"
 
 typedef struct synthio_note_obj {
     mp_obj_base_t base;
@@ -19,6 +20,7 @@ typedef struct synthio_note_obj {
     mp_float_t frequency, ring_frequency;
     mp_obj_t waveform_obj, envelope_obj, ring_waveform_obj;
     mp_obj_t filter_obj;
+    mp_obj_t instrument_obj;
 
     biquad_filter_state filter_state;
 
@@ -32,6 +34,14 @@ typedef struct synthio_note_obj {
     mp_buffer_info_t ring_waveform_buf;
     synthio_block_slot_t ring_waveform_loop_start, ring_waveform_loop_end;
     synthio_envelope_definition_t envelope_def;
+    synthio_interpolation_t interpolation;
+    // the instrument zone chosen for the note's frequency when it started
+    uint8_t zone;
+
+    // The synthesizer and voice that most recently started this note; used
+    // to find the note's voice without scanning. Verified before use.
+    synthio_synth_t *voice_synth;
+    uint8_t voice;
 } synthio_note_obj_t;
 
 void synthio_note_recalculate(synthio_note_obj_t *self, int32_t sample_rate);
@@ -4,6 +4,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "py/runtime.h"
 #include "shared-bindings/synthio/LFO.h"
 #include "shared-bindings/synthio/Note.h"
@@ -15,14 +17,19 @@
 
 void common_hal_synthio_synthesizer_construct(synthio_synthesizer_obj_t *self,
     uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj,
-    mp_obj_t envelope_obj) {
+    mp_obj_t envelope_obj, int polyphony) {
 
-    synthio_synth_init(&self->synth, sample_rate, channel_count, waveform_obj, envelope_obj);
+    synthio_synth_init(&self->synth, sample_rate, channel_count, waveform_obj, envelope_obj, polyphony);
     self->blocks = mp_obj_new_list(0, NULL);
+    self->sample_time = 0;
+    self->events = NULL;
+    self->event_count = 0;
 }
 
 void common_hal_synthio_synthesizer_deinit(synthio_synthesizer_obj_t *self) {
     synthio_synth_deinit(&self->synth);
+    self->events = NULL;
+    self->event_count = 0;
 }
 
 void synthio_synthesizer_reset_buffer(synthio_synthesizer_obj_t *self,
@@ -30,16 +37,67 @@ void synthio_synthesizer_reset_buffer(synthio_synthesizer_obj_t *self,
     synthio_synth_reset_buffer(&self->synth, single_channel_output, channel);
 }
 
+static void apply_event(synthio_synthesizer_obj_t *self, synthio_event_t *event) {
+    switch (event->kind) {
+        case SYNTHIO_EVENT_PRESS:
+            if (!mp_obj_is_small_int(event->target)) {
+                synthio_note_start(MP_OBJ_TO_PTR(event->target), self->synth.base.sample_rate);
+            }
+            synthio_span_change_note(&self->synth, SYNTHIO_SILENCE, event->target);
+            break;
+        case SYNTHIO_EVENT_RELEASE:
+            synthio_span_change_note(&self->synth, event->target, SYNTHIO_SILENCE);
+            break;
+        case SYNTHIO_EVENT_SET: {
+            // errors cannot be raised from the background task, so an invalid value is dropped
+            nlr_buf_t nlr;
+            if (nlr_push(&nlr) == 0) {
+                mp_store_attr(event->target, event->attr, event->value);
+                nlr_pop();
+            }
+            break;
+        }
+    }
+}
+
+// Apply the events that are due, and return the number of samples until the next one
+static uint32_t apply_due_events(synthio_synthesizer_obj_t *self) {
+    size_t i = 0;
+    while (i < self->event_count && (int32_t)(self->events[i].time - self->sample_time) <= 0) {
+        apply_event(self, &self->events[i]);
+        i++;
+    }
+    if (i) {
+        self->event_count -= i;
+        memmove(self->events, self->events + i, self->event_count * sizeof(synthio_event_t));
+        // don't keep applied notes and values alive
+        memset(self->events + self->event_count, 0, i * sizeof(synthio_event_t));
+    }
+    if (self->event_count == 0) {
+        return SYNTHIO_MAX_DUR;
+    }
+    return MIN(SYNTHIO_MAX_DUR, self->events[0].time - self->sample_time);
+}
+
 audioio_get_buffer_result_t synthio_synthesizer_get_buffer(synthio_synthesizer_obj_t *self,
     bool single_channel_output, uint8_t channel, uint8_t **buffer, uint32_t *buffer_length) {
     if (audiosample_deinited(&self->synth.base)) {
         *buffer_length = 0;
         return GET_BUFFER_ERROR;
     }
-    self->synth.span.dur = SYNTHIO_MAX_DUR;
+    if (single_channel_output && channel == self->synth.other_channel) {
+        // the other channel of the buffer that was just made
+        synthio_synth_synthesize(&self->synth, buffer, buffer_length, channel);
+        return GET_BUFFER_MORE_DATA;
+    }
 
+    // End the buffer where the next event is due, so that it takes effect on
+    // exactly the right sample.
+    self->synth.span.dur = apply_due_events(self);
+    uint16_t dur = self->synth.span.dur;
 
     synthio_synth_synthesize(&self->synth, buffer, buffer_length, single_channel_output ? channel : 0);
+    self->sample_time += dur - self->synth.span.dur;
 
     // free-running LFOs
     mp_obj_iter_buf_t iter_buf;
@@ -56,13 +114,48 @@ audioio_get_buffer_result_t synthio_synthesizer_get_buffer(synthio_synthesizer_o
 }
 
 void common_hal_synthio_synthesizer_release_all(synthio_synthesizer_obj_t *self) {
-    for (size_t i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
+    for (size_t i = 0; i < self->synth.voice_count; i++) {
         if (self->synth.span.note_obj[i] != SYNTHIO_SILENCE) {
             synthio_span_change_note(&self->synth, self->synth.span.note_obj[i], SYNTHIO_SILENCE);
         }
     }
 }
 
+static void schedule_event(synthio_synthesizer_obj_t *self, synthio_event_t *event) {
+    if (self->events == NULL) {
+        self->events = m_malloc(SYNTHIO_EVENT_QUEUE_SIZE * sizeof(synthio_event_t));
+    }
+    if (self->event_count == SYNTHIO_EVENT_QUEUE_SIZE) {
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("schedule queue full"));
+    }
+    // Times are compared relative to now so that the sample counter can wrap.
+    // Events at the same time keep the order they were scheduled in.
+    int32_t delay = event->time - self->sample_time;
+    size_t i = self->event_count;
+    while (i > 0 && (int32_t)(self->events[i - 1].time - self->sample_time) > delay) {
+        i--;
+    }
+    memmove(self->events + i + 1, self->events + i, (self->event_count - i) * sizeof(synthio_event_t));
+    self->events[i] = *event;
+    self->event_count++;
+}
+
+void common_hal_synthio_synthesizer_cancel_events(synthio_synthesizer_obj_t *self) {
+    if (self->events) {
+        memset(self->events, 0, self->event_count * sizeof(synthio_event_t));
+    }
+    self->event_count = 0;
+}
+
+uint32_t common_hal_synthio_synthesizer_get_sample_time(synthio_synthesizer_obj_t *self) {
+    return self->sample_time;
+}
+
+void common_hal_synthio_synthesizer_set_at(synthio_synthesizer_obj_t *self, mp_obj_t target, qstr attr, mp_obj_t value, uint32_t time) {
+    synthio_event_t event = { .time = time, .kind = SYNTHIO_EVENT_SET, .attr = attr, .target = target, .value = value };
+    schedule_event(self, &event);
+}
+
 static bool is_note(mp_obj_t note_in) {
     return mp_obj_is_small_int(note_in) || mp_obj_is_type(note_in, &synthio_note_type);
 }
@@ -93,6 +186,16 @@ void common_hal_synthio_synthesizer_release(synthio_synthesizer_obj_t *self, mp_
     }
 }
 
+void common_hal_synthio_synthesizer_press_at(synthio_synthesizer_obj_t *self, mp_obj_t note, uint32_t time) {
+    synthio_event_t event = { .time = time, .kind = SYNTHIO_EVENT_PRESS, .target = validate_note(note) };
+    schedule_event(self, &event);
+}
+
+void common_hal_synthio_synthesizer_release_at(synthio_synthesizer_obj_t *self, mp_obj_t note, uint32_t time) {
+    synthio_event_t event = { .time = time, .kind = SYNTHIO_EVENT_RELEASE, .target = validate_note(note) };
+    schedule_event(self, &event);
+}
+
 void common_hal_synthio_synthesizer_press(synthio_synthesizer_obj_t *self, mp_obj_t to_press) {
     if (is_note(to_press)) {
         if (!mp_obj_is_small_int(to_press)) {
@@ -134,13 +237,13 @@ void common_hal_synthio_synthesizer_retrigger(synthio_synthesizer_obj_t *self, m
 
 mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_obj_t *self) {
     int count = 0;
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (int chan = 0; chan < self->synth.voice_count; chan++) {
         if (self->synth.span.note_obj[chan] != SYNTHIO_SILENCE && SYNTHIO_NOTE_IS_PLAYING(&self->synth, chan)) {
             count += 1;
         }
     }
     mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(count, NULL));
-    for (size_t chan = 0, j = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (size_t chan = 0, j = 0; chan < self->synth.voice_count; chan++) {
         if (self->synth.span.note_obj[chan] != SYNTHIO_SILENCE && SYNTHIO_NOTE_IS_PLAYING(&self->synth, chan)) {
             result->items[j++] = self->synth.span.note_obj[chan];
         }
@@ -149,15 +252,26 @@ mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_ob
 }
 
 envelope_state_e common_hal_synthio_synthesizer_note_info(synthio_synthesizer_obj_t *self, mp_obj_t note, mp_float_t *vol_out) {
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
-        if (self->synth.span.note_obj[chan] == note) {
-            *vol_out = self->synth.envelope_state[chan].level / 32767.;
-            return self->synth.envelope_state[chan].state;
-        }
+    int chan = synthio_span_find_voice(&self->synth, note);
+    if (chan == -1) {
+        return (envelope_state_e) - 1;
     }
-    return (envelope_state_e) - 1;
+    *vol_out = self->synth.envelope_state[chan].level / 32767.;
+    return self->synth.envelope_state[chan].state;
+}
+
+
+mp_int_t common_hal_synthio_synthesizer_get_polyphony(synthio_synthesizer_obj_t *self) {
+    return self->synth.voice_count;
+}
+
+mp_float_t common_hal_synthio_synthesizer_get_cpu_budget(synthio_synthesizer_obj_t *self) {
+    return self->synth.cpu_budget / MICROPY_FLOAT_CONST(65535.);
 }
 
+void common_hal_synthio_synthesizer_set_cpu_budget(synthio_synthesizer_obj_t *self, mp_float_t value) {
+    self->synth.cpu_budget = (uint16_t)(value * 65535);
+}
 
 mp_obj_t common_hal_synthio_synthesizer_get_blocks(synthio_synthesizer_obj_t *self) {
     return self->blocks;
@@ -11,9 +11,29 @@
 
 #include "shared-module/synthio/__init__.h"
 
+// The number of events that can wait to be applied at a given sample
+#define SYNTHIO_EVENT_QUEUE_SIZE (64)
+
+typedef enum {
+    SYNTHIO_EVENT_PRESS, SYNTHIO_EVENT_RELEASE, SYNTHIO_EVENT_SET
+} synthio_event_kind_t;
+
+typedef struct {
+    uint32_t time;
+    synthio_event_kind_t kind;
+    qstr attr; // for SYNTHIO_EVENT_SET
+    mp_obj_t target; // the note, or the object to set an attribute of
+    mp_obj_t value;
+} synthio_event_t;
+
 typedef struct {
     synthio_synth_t synth;
     mp_obj_t blocks;
+    // the number of samples produced so far; events are scheduled against it
+    uint32_t sample_time;
+    // pending events, in time order; allocated on first use
+    synthio_event_t *events;
+    uint8_t event_count;
 } synthio_synthesizer_obj_t;
 
 
@@ -9,8 +9,14 @@
 #include "shared-bindings/audiocore/__init__.h"
 #include "shared-bindings/synthio/__init__.h"
 #include "shared-module/synthio/Biquad.h"
+#include "shared-module/synthio/Instrument.h"
 #include "shared-module/synthio/Note.h"
 #include "py/runtime.h"
+#if defined(MICROPY_UNIX_COVERAGE)
+#include "py/mphal.h"
+#else
+#include "supervisor/port.h"
+#endif
 #include <math.h>
 #include <stdlib.h>
 
@@ -143,6 +149,11 @@ static synthio_envelope_definition_t *synthio_synth_get_note_envelope(synthio_sy
         synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
         if (note->envelope_obj != mp_const_none) {
             def = &note->envelope_def;
+        } else if (note->instrument_obj != mp_const_none) {
+            synthio_instrument_obj_t *instrument = MP_OBJ_TO_PTR(note->instrument_obj);
+            if (instrument->envelope_obj != mp_const_none) {
+                def = &instrument->envelope_def;
+            }
         }
     }
     return def;
@@ -171,7 +182,124 @@ int16_t synthio_mix_down_sample(int32_t sample, int32_t scale) {
     return sample;
 }
 
-static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur, int16_t loudness[2]) {
+// State of one wavetable oscillator while a buffer is synthesized.
+typedef struct {
+    const int16_t *waveform;
+    uint32_t start, length; // loop points, in samples
+    uint32_t offset, lim; // loop points, in DDS units
+    uint32_t dds_rate;
+    uint32_t accum;
+} synthio_oscillator_t;
+
+static inline __attribute__((always_inline)) int32_t synthio_oscillator_next(synthio_oscillator_t *osc, const synthio_interpolation_t interpolation) {
+    uint32_t accum = osc->accum + osc->dds_rate;
+    // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+    if (accum > osc->lim) {
+        accum = accum - osc->lim + osc->offset;
+    }
+    osc->accum = accum;
+
+    if (interpolation == SYNTHIO_INTERPOLATION_NONE) {
+        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
+        return osc->waveform[idx];
+    }
+
+    uint32_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
+    if (idx >= osc->length) {
+        idx = osc->start;
+    }
+    uint32_t idx1 = idx + 1 < osc->length ? idx + 1 : osc->start;
+    // 15 bit fraction of the way from idx to idx1
+    int32_t frac = (accum >> (SYNTHIO_FREQUENCY_SHIFT - 15)) & 0x7fff;
+    int32_t w0 = osc->waveform[idx];
+    int32_t w1 = osc->waveform[idx1];
+
+    if (interpolation == SYNTHIO_INTERPOLATION_LINEAR) {
+        return w0 + (((w1 - w0) * frac) >> 15);
+    }
+
+    // Catmull-Rom cubic through the two samples on either side
+    uint32_t idx_1 = idx > osc->start ? idx - 1 : osc->length - 1;
+    uint32_t idx2 = idx1 + 1 < osc->length ? idx1 + 1 : osc->start;
+    int32_t w_1 = osc->waveform[idx_1];
+    int32_t w2 = osc->waveform[idx2];
+    int32_t c1 = (w1 - w_1) / 2;
+    int32_t c2 = w_1 - (5 * w0) / 2 + 2 * w1 - w2 / 2;
+    int32_t c3 = (w2 - w_1) / 2 + (3 * (w0 - w1)) / 2;
+    int64_t result = ((int64_t)c3 * frac) >> 15;
+    result = ((result + c2) * frac) >> 15;
+    result = ((result + c1) * frac) >> 15;
+    result += w0;
+    return MIN(32767, MAX(-32768, result));
+}
+
+// Synthesize one voice, with the oscillator, ring modulation, and loudness in a single pass.
+// When loudness is NULL the raw samples are stored for further processing, otherwise they are
+// scaled and added to the (possibly stereo) output.
+static inline __attribute__((always_inline)) void synth_voice_kernel(synthio_oscillator_t *osc_in, synthio_oscillator_t *ring_in, int32_t *out_buffer32, uint16_t dur, const int16_t *loudness, uint8_t channel_count, const bool ring, const synthio_interpolation_t interpolation) {
+    synthio_oscillator_t osc = *osc_in;
+    synthio_oscillator_t ring_osc;
+    if (ring) {
+        ring_osc = *ring_in;
+    }
+    for (uint16_t i = 0; i < dur; i++) {
+        int32_t sample = synthio_oscillator_next(&osc, interpolation);
+        if (ring) {
+            int16_t wi = (synthio_oscillator_next(&ring_osc, interpolation) * sample) / 32768; // consider for synthio_sat16 but had a weird artificat
+            sample = wi;
+        }
+        if (loudness == NULL) {
+            out_buffer32[i] = sample;
+        } else if (channel_count == 1) {
+            *out_buffer32++ += synthio_sat16((sample * loudness[0]), 16);
+        } else {
+            *out_buffer32++ += synthio_sat16((sample * loudness[0]), 16);
+            *out_buffer32++ += synthio_sat16((sample * loudness[1]), 16);
+        }
+    }
+    osc_in->accum = osc.accum;
+    if (ring) {
+        ring_in->accum = ring_osc.accum;
+    }
+}
+
+typedef void (*synth_voice_kernel_fun)(synthio_oscillator_t *osc, synthio_oscillator_t *ring, int32_t *out_buffer32, uint16_t dur, const int16_t *loudness, uint8_t channel_count);
+
+#define SYNTH_VOICE_KERNEL(name, ring, interpolation) \
+    static void name(synthio_oscillator_t *osc, synthio_oscillator_t *ring_osc, int32_t *out_buffer32, uint16_t dur, const int16_t *loudness, uint8_t channel_count) { \
+        synth_voice_kernel(osc, ring_osc, out_buffer32, dur, loudness, channel_count, ring, interpolation); \
+    }
+
+SYNTH_VOICE_KERNEL(synth_voice_plain, false, SYNTHIO_INTERPOLATION_NONE)
+SYNTH_VOICE_KERNEL(synth_voice_linear, false, SYNTHIO_INTERPOLATION_LINEAR)
+SYNTH_VOICE_KERNEL(synth_voice_cubic, false, SYNTHIO_INTERPOLATION_CUBIC)
+SYNTH_VOICE_KERNEL(synth_voice_ring_plain, true, SYNTHIO_INTERPOLATION_NONE)
+SYNTH_VOICE_KERNEL(synth_voice_ring_linear, true, SYNTHIO_INTERPOLATION_LINEAR)
+SYNTH_VOICE_KERNEL(synth_voice_ring_cubic, true, SYNTHIO_INTERPOLATION_CUBIC)
+
+// Indexed by [ring][interpolation]
+static const synth_voice_kernel_fun synth_voice_kernels[2][3] = {
+    { synth_voice_plain, synth_voice_linear, synth_voice_cubic },
+    { synth_voice_ring_plain, synth_voice_ring_linear, synth_voice_ring_cubic },
+};
+
+static void synthio_oscillator_init(synthio_oscillator_t *osc, const int16_t *waveform, uint32_t start, uint32_t length, uint32_t dds_rate, uint32_t accum) {
+    osc->waveform = waveform;
+    osc->start = start;
+    osc->length = length;
+    osc->offset = start << SYNTHIO_FREQUENCY_SHIFT;
+    osc->lim = length << SYNTHIO_FREQUENCY_SHIFT;
+    osc->dds_rate = dds_rate;
+    // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
+    if (accum > osc->lim) {
+        accum = accum % osc->lim + osc->offset;
+    }
+    osc->accum = accum;
+}
+
+// Synthesize a note into out_buffer32. If loudness_out is true, the note is scaled by its loudness
+// and added to out_buffer32, otherwise the unscaled samples are stored in out_buffer32.
+static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur, int16_t loudness[2], bool loudness_out) {
     mp_obj_t note_obj = synth->span.note_obj[chan];
 
     int32_t sample_rate = synth->base.sample_rate;
@@ -186,6 +314,7 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     const int16_t *ring_waveform = NULL;
     uint32_t ring_waveform_start = 0;
     uint32_t ring_waveform_length = 0;
+    synthio_interpolation_t interpolation = SYNTHIO_INTERPOLATION_NONE;
 
     if (mp_obj_is_small_int(note_obj)) {
         uint8_t note = mp_obj_get_int(note_obj);
@@ -200,13 +329,27 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     } else {
         synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
         int32_t frequency_scaled = synthio_note_step(note, sample_rate, dur, loudness);
-        if (note->waveform_buf.buf) {
-            waveform = note->waveform_buf.buf;
-            waveform_length = note->waveform_buf.len;
-            waveform_start = (uint32_t)synthio_block_slot_get_limited(&note->waveform_loop_start, 0, waveform_length - 1);
-            waveform_length = (uint32_t)synthio_block_slot_get_limited(&note->waveform_loop_end, waveform_start + 1, waveform_length);
+        interpolation = note->interpolation;
+        if (note->instrument_obj != mp_const_none) {
+            // play the zone's samples, at the pitch of its root key times the frequency ratio
+            synthio_instrument_obj_t *instrument = MP_OBJ_TO_PTR(note->instrument_obj);
+            if (note->zone >= instrument->zone_count) {
+                return false;
+            }
+            const synthio_zone_t *zone = &instrument->zones[note->zone];
+            waveform = instrument->samples + zone->start;
+            waveform_start = zone->loop_start;
+            waveform_length = zone->loop_end;
+            dds_rate = synthio_frequency_convert_scaled_to_dds(((uint64_t)frequency_scaled * zone->cycle_scaled) >> 8, sample_rate);
+        } else {
+            if (note->waveform_buf.buf) {
+                waveform = note->waveform_buf.buf;
+                waveform_length = note->waveform_buf.len;
+                waveform_start = (uint32_t)synthio_block_slot_get_limited(&note->waveform_loop_start, 0, waveform_length - 1);
+                waveform_length = (uint32_t)synthio_block_slot_get_limited(&note->waveform_loop_end, waveform_start + 1, waveform_length);
+            }
+            dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)frequency_scaled * (waveform_length - waveform_start), sample_rate);
         }
-        dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)frequency_scaled * (waveform_length - waveform_start), sample_rate);
         if (note->ring_frequency_scaled != 0 && note->ring_waveform_buf.buf) {
             ring_waveform = note->ring_waveform_buf.buf;
             ring_waveform_length = note->ring_waveform_buf.len;
@@ -220,60 +363,26 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         }
     }
 
-    uint32_t offset = waveform_start << SYNTHIO_FREQUENCY_SHIFT;
-    uint32_t lim = waveform_length << SYNTHIO_FREQUENCY_SHIFT;
-    uint32_t accum = synth->accum[chan];
+    synthio_oscillator_t osc;
+    synthio_oscillator_init(&osc, waveform, waveform_start, waveform_length, dds_rate, synth->accum[chan]);
 
-    if (dds_rate > lim / 2) {
+    if (dds_rate > osc.lim / 2) {
         // beyond nyquist, can't play note
         return false;
     }
 
-    // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-    if (accum > lim) {
-        accum = accum % lim + offset;
-    }
-
-    // first, fill with waveform
-    for (uint16_t i = 0; i < dur; i++) {
-        accum += dds_rate;
-        // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-        if (accum > lim) {
-            accum = accum - lim + offset;
-        }
-        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-        out_buffer32[i] = waveform[idx];
+    // beyond nyquist (of the main waveform), can't play ring but still synth the main sound
+    bool ring = ring_dds_rate && ring_dds_rate <= osc.lim / 2;
+    synthio_oscillator_t ring_osc;
+    if (ring) {
+        synthio_oscillator_init(&ring_osc, ring_waveform, ring_waveform_start, ring_waveform_length, ring_dds_rate, synth->ring_accum[chan]);
     }
-    synth->accum[chan] = accum;
-
-    if (ring_dds_rate) {
-        if (ring_dds_rate > lim / 2) {
-            // beyond nyquist, can't play ring (but did synth main sound so
-            // return true)
-            return true;
-        }
-
-        // now modulate by ring and accumulate
-        accum = synth->ring_accum[chan];
-        offset = ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT;
-        lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
 
-        // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-        if (accum > lim) {
-            accum = accum % lim + offset;
-        }
+    synth_voice_kernels[ring][interpolation](&osc, &ring_osc, out_buffer32, dur, loudness_out ? loudness : NULL, synth->base.channel_count);
 
-        for (uint16_t i = 0; i < dur; i++) {
-            accum += ring_dds_rate;
-            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-            if (accum > lim) {
-                accum = accum - lim + offset;
-            }
-            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-            int16_t wi = (ring_waveform[idx] * out_buffer32[i]) / 32768; // consider for synthio_sat16 but had a weird artificat
-            out_buffer32[i] = wi;
-        }
-        synth->ring_accum[chan] = accum;
+    synth->accum[chan] = osc.accum;
+    if (ring) {
+        synth->ring_accum[chan] = ring_osc.accum;
     }
     return true;
 }
@@ -302,6 +411,76 @@ static void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int1
     }
 }
 
+#if defined(MICROPY_UNIX_COVERAGE)
+#define SYNTHIO_TICKS_PER_SECOND (1000000)
+static uint32_t synthio_ticks(void) {
+    return mp_hal_ticks_us();
+}
+#else
+// port ticks are 1/1024s, each divided into 32 subticks
+#define SYNTHIO_TICKS_PER_SECOND (32768)
+static uint32_t synthio_ticks(void) {
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return (uint32_t)(ticks * 32 + subticks);
+}
+#endif
+
+static void synthio_voice_set_free(synthio_synth_t *synth, int voice) {
+    synth->span.note_obj[voice] = SYNTHIO_SILENCE;
+    synth->free_voices[voice / 32] |= 1u << (voice % 32);
+}
+
+static void synthio_voice_set_busy(synthio_synth_t *synth, int voice) {
+    synth->free_voices[voice / 32] &= ~(1u << (voice % 32));
+}
+
+static int synthio_voice_find_free(synthio_synth_t *synth) {
+    for (size_t i = 0; i < (synth->voice_count + 31u) / 32; i++) {
+        uint32_t word = synth->free_voices[i];
+        if (word) {
+            return i * 32 + mp_ctz(word);
+        }
+    }
+    return -1;
+}
+
+// Choose the voice to give up when a new note needs one or the synthesizer
+// is over its CPU budget. Released voices go first, then the quietest voice,
+// and among equally loud voices the one that started longest ago.
+static int synthio_voice_find_victim(synthio_synth_t *synth) {
+    int result = -1;
+    bool result_playing = true;
+    int16_t result_level = 0;
+    uint32_t result_serial = 0;
+    for (int chan = 0; chan < synth->voice_count; chan++) {
+        if (synth->span.note_obj[chan] == SYNTHIO_SILENCE) {
+            continue;
+        }
+        bool playing = SYNTHIO_NOTE_IS_PLAYING(synth, chan);
+        int16_t level = synth->envelope_state[chan].level;
+        uint32_t serial = synth->voice_serial[chan];
+        if (result != -1) {
+            if (playing != result_playing) {
+                if (playing) {
+                    continue;
+                }
+            } else if (level != result_level) {
+                if (level > result_level) {
+                    continue;
+                }
+            } else if ((int32_t)(serial - result_serial) >= 0) {
+                continue;
+            }
+        }
+        result = chan;
+        result_playing = playing;
+        result_level = level;
+        result_serial = serial;
+    }
+    return result;
+}
+
 void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t *buffer_length, uint8_t channel) {
 
     if (channel == synth->other_channel) {
@@ -310,20 +489,24 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
         return;
     }
 
-    shared_bindings_synthio_lfo_tick(synth->base.sample_rate, SYNTHIO_MAX_DUR);
+    uint32_t start_ticks = synth->cpu_budget ? synthio_ticks() : 0;
+
+    uint16_t dur = MIN(SYNTHIO_MAX_DUR, synth->span.dur);
+    synth->span.dur -= dur;
+
+    // LFOs advance by the length of this buffer, which is shorter than usual
+    // when it ends at a scheduled event
+    shared_bindings_synthio_lfo_tick(synth->base.sample_rate, dur);
 
     synth->buffer_index = !synth->buffer_index;
     synth->other_channel = 1 - channel;
     synth->other_buffer_index = synth->buffer_index;
 
-    uint16_t dur = MIN(SYNTHIO_MAX_DUR, synth->span.dur);
-    synth->span.dur -= dur;
-
     int32_t out_buffer32[SYNTHIO_MAX_DUR * synth->base.channel_count];
     int32_t tmp_buffer32[SYNTHIO_MAX_DUR];
     memset(out_buffer32, 0, synth->base.channel_count * dur * sizeof(int32_t));
 
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (int chan = 0; chan < synth->voice_count; chan++) {
         mp_obj_t note_obj = synth->span.note_obj[chan];
         if (note_obj == SYNTHIO_SILENCE) {
             continue;
@@ -331,24 +514,28 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
 
         if (synth->envelope_state[chan].level == 0) {
             // note is truly finished, but we only just noticed
-            synth->span.note_obj[chan] = SYNTHIO_SILENCE;
+            synthio_voice_set_free(synth, chan);
             continue;
         }
 
         int16_t loudness[2] = {synth->envelope_state[chan].level, synth->envelope_state[chan].level};
 
-        if (!synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness)) {
+        mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
+        if (filter_obj == mp_const_none) {
+            // Without a filter the note goes straight into the output, adjusted by its envelope.
+            synth_note_into_buffer(synth, chan, out_buffer32, dur, loudness, true);
+            continue;
+        }
+
+        if (!synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness, false)) {
             // for some other reason, such as being above nyquist, note
             // couldn't be synthed, so don't filter or sum it in
             continue;
         }
 
-        mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
-        if (filter_obj != mp_const_none) {
-            synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
-            common_hal_synthio_biquad_tick(filter_obj);
-            synthio_biquad_filter_samples(filter_obj, &note->filter_state, tmp_buffer32, dur);
-        }
+        synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
+        common_hal_synthio_biquad_tick(filter_obj);
+        synthio_biquad_filter_samples(filter_obj, &note->filter_state, tmp_buffer32, dur);
 
         // adjust loudness by envelope
         sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->base.channel_count);
@@ -363,7 +550,7 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
     }
 
     // advance envelope states
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (int chan = 0; chan < synth->voice_count; chan++) {
         mp_obj_t note_obj = synth->span.note_obj[chan];
         if (note_obj == SYNTHIO_SILENCE) {
             continue;
@@ -371,6 +558,19 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
         synthio_envelope_state_step(&synth->envelope_state[chan], synthio_synth_get_note_envelope(synth, note_obj), dur);
     }
 
+    if (synth->cpu_budget) {
+        // If rendering this buffer took more than the allowed fraction of
+        // its playback time, stop one voice so the next buffer is cheaper.
+        uint32_t elapsed = synthio_ticks() - start_ticks;
+        uint32_t budget = (uint64_t)dur * SYNTHIO_TICKS_PER_SECOND * synth->cpu_budget / 65536 / synth->base.sample_rate;
+        if (elapsed > budget) {
+            int victim = synthio_voice_find_victim(synth);
+            if (victim != -1) {
+                synthio_voice_set_free(synth, victim);
+            }
+        }
+    }
+
     *buffer_length = synth->last_buffer_length = dur * SYNTHIO_BYTES_PER_SAMPLE * synth->base.channel_count;
     *bufptr = (uint8_t *)out_buffer16;
 }
@@ -385,6 +585,12 @@ void synthio_synth_reset_buffer(synthio_synth_t *synth, bool single_channel_outp
 void synthio_synth_deinit(synthio_synth_t *synth) {
     synth->buffers[0] = NULL;
     synth->buffers[1] = NULL;
+    synth->voice_count = 0;
+    synth->span.note_obj = NULL;
+    synth->accum = NULL;
+    synth->ring_accum = NULL;
+    synth->voice_serial = NULL;
+    synth->envelope_state = NULL;
     audiosample_mark_deinit(&synth->base);
 }
 
@@ -397,9 +603,10 @@ mp_obj_t synthio_synth_envelope_get(synthio_synth_t *synth) {
     return synth->envelope_obj;
 }
 
-void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope_obj) {
+void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope_obj, int voice_count) {
     synthio_synth_parse_waveform(&synth->waveform_bufinfo, waveform_obj);
     mp_arg_validate_int_range(channel_count, 1, 2, MP_QSTR_channel_count);
+    mp_arg_validate_int_range(voice_count, 1, SYNTHIO_MAX_VOICES, MP_QSTR_polyphony);
     synth->buffer_length = SYNTHIO_MAX_DUR * SYNTHIO_BYTES_PER_SAMPLE * channel_count;
     synth->buffers[0] = m_malloc_without_collect(synth->buffer_length);
     synth->buffers[1] = m_malloc_without_collect(synth->buffer_length);
@@ -413,8 +620,22 @@ void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channe
     synth->base.max_buffer_length = synth->buffer_length;
     synthio_synth_envelope_set(synth, envelope_obj);
 
-    for (size_t i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
-        synth->span.note_obj[i] = SYNTHIO_SILENCE;
+    synth->voice_count = voice_count;
+    synth->span.note_obj = m_malloc(voice_count * sizeof(mp_obj_t));
+    synth->accum = m_malloc_without_collect(voice_count * sizeof(uint32_t));
+    synth->ring_accum = m_malloc_without_collect(voice_count * sizeof(uint32_t));
+    synth->voice_serial = m_malloc_without_collect(voice_count * sizeof(uint32_t));
+    synth->envelope_state = m_malloc_without_collect(voice_count * sizeof(synthio_envelope_state_t));
+    memset(synth->accum, 0, voice_count * sizeof(uint32_t));
+    memset(synth->ring_accum, 0, voice_count * sizeof(uint32_t));
+    memset(synth->voice_serial, 0, voice_count * sizeof(uint32_t));
+    memset(synth->envelope_state, 0, voice_count * sizeof(synthio_envelope_state_t));
+    synth->next_serial = 0;
+    synth->cpu_budget = 0;
+    memset(synth->free_voices, 0, sizeof(synth->free_voices));
+    memset(synth->midi_voice, 0, sizeof(synth->midi_voice));
+    for (int i = 0; i < voice_count; i++) {
+        synthio_voice_set_free(synth, i);
     }
 }
 
@@ -434,26 +655,62 @@ void synthio_synth_parse_waveform(mp_buffer_info_t *bufinfo_waveform, mp_obj_t w
     parse_common(bufinfo_waveform, waveform_obj, MP_QSTR_waveform, SYNTHIO_WAVEFORM_SIZE);
 }
 
-static int find_channel_with_note(synthio_synth_t *synth, mp_obj_t note) {
-    for (int i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
+static int find_channel_with_note_scan(synthio_synth_t *synth, mp_obj_t note) {
+    for (int i = 0; i < synth->voice_count; i++) {
         if (synth->span.note_obj[i] == note) {
             return i;
         }
     }
-    int result = -1;
+    return -1;
+}
+
+int synthio_span_find_voice(synthio_synth_t *synth, mp_obj_t note) {
     if (note == SYNTHIO_SILENCE) {
-        // replace the releasing note with lowest volume level
-        int level = 32768;
-        for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
-            if (!SYNTHIO_NOTE_IS_PLAYING(synth, chan)) {
-                synthio_envelope_state_t *state = &synth->envelope_state[chan];
-                if (state->level < level) {
-                    result = chan;
-                    level = state->level;
-                }
-            }
+        return -1;
+    }
+    if (mp_obj_is_small_int(note)) {
+        // an integer note only ever occupies the voice recorded for it
+        mp_int_t midi_note = MP_OBJ_SMALL_INT_VALUE(note);
+        if (midi_note < 0 || midi_note >= SYNTHIO_MIDI_NOTE_COUNT) {
+            return -1;
+        }
+        int voice = synth->midi_voice[midi_note];
+        return (voice < synth->voice_count && synth->span.note_obj[voice] == note) ? voice : -1;
+    }
+    if (mp_obj_is_type(note, &synthio_note_type)) {
+        synthio_note_obj_t *note_obj = MP_OBJ_TO_PTR(note);
+        if (note_obj->voice_synth == synth) {
+            // this synthesizer was the last to start the note, so the
+            // recorded voice is the only one that can hold it
+            int voice = note_obj->voice;
+            return (voice < synth->voice_count && synth->span.note_obj[voice] == note) ? voice : -1;
         }
     }
+    return find_channel_with_note_scan(synth, note);
+}
+
+static void synthio_voice_assign(synthio_synth_t *synth, int voice, mp_obj_t note) {
+    synth->span.note_obj[voice] = note;
+    synth->voice_serial[voice] = synth->next_serial++;
+    synthio_voice_set_busy(synth, voice);
+    if (mp_obj_is_small_int(note)) {
+        synth->midi_voice[MP_OBJ_SMALL_INT_VALUE(note)] = voice;
+    } else {
+        synthio_note_obj_t *note_obj = MP_OBJ_TO_PTR(note);
+        note_obj->voice_synth = synth;
+        note_obj->voice = voice;
+    }
+}
+
+static int find_channel_with_note(synthio_synth_t *synth, mp_obj_t note) {
+    if (note != SYNTHIO_SILENCE) {
+        return synthio_span_find_voice(synth, note);
+    }
+    int result = synthio_voice_find_free(synth);
+    if (result == -1) {
+        // all voices are in use, so steal one
+        result = synthio_voice_find_victim(synth);
+    }
     return result;
 }
 
@@ -469,7 +726,7 @@ bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_
         if (new_note == SYNTHIO_SILENCE) {
             synthio_envelope_state_release(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, old_note));
         } else {
-            synth->span.note_obj[channel] = new_note;
+            synthio_voice_assign(synth, channel, new_note);
             synthio_envelope_state_init(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, new_note));
             synth->accum[channel] = 0;
         }
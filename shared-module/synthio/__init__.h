@@ -13,6 +13,8 @@
 #define SYNTHIO_NOTE_IS_SIMPLE(note) (mp_obj_is_small_int(note))
 #define SYNTHIO_NOTE_IS_PLAYING(synth, i) ((synth)->envelope_state[(i)].state != SYNTHIO_ENVELOPE_STATE_RELEASE)
 #define SYNTHIO_FREQUENCY_SHIFT (16)
+#define SYNTHIO_MAX_VOICES (255)
+#define SYNTHIO_MIDI_NOTE_COUNT (128)
 
 #define SYNTHIO_MIX_DOWN_RANGE_LOW (-28000)
 #define SYNTHIO_MIX_DOWN_RANGE_HIGH (28000)
@@ -24,7 +26,7 @@
 
 typedef struct {
     uint16_t dur;
-    mp_obj_t note_obj[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    mp_obj_t *note_obj;
 } synthio_midi_span_t;
 
 typedef struct {
@@ -52,9 +54,20 @@ typedef struct synthio_synth {
     synthio_envelope_definition_t global_envelope_definition;
     mp_obj_t waveform_obj, filter_obj, envelope_obj;
     synthio_midi_span_t span;
-    uint32_t accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
-    uint32_t ring_accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
-    synthio_envelope_state_t envelope_state[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    // Per-voice state, allocated at construction time with voice_count entries
+    uint32_t *accum;
+    uint32_t *ring_accum;
+    uint32_t *voice_serial;
+    synthio_envelope_state_t *envelope_state;
+    uint32_t next_serial;
+    // bit set for each voice whose note_obj is SYNTHIO_SILENCE
+    uint32_t free_voices[(SYNTHIO_MAX_VOICES + 31) / 32];
+    // the voice most recently assigned to each integer (MIDI) note
+    uint8_t midi_voice[SYNTHIO_MIDI_NOTE_COUNT];
+    uint8_t voice_count;
+    // fraction of real time (0..65535 = 0..1) that one synthesize call may
+    // take before a voice is shed; 0 disables the guard
+    uint16_t cpu_budget;
 } synthio_synth_t;
 
 typedef struct {
@@ -70,13 +83,14 @@ typedef struct {
 void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **buffer, uint32_t *buffer_length, uint8_t channel);
 void synthio_synth_deinit(synthio_synth_t *synth);
 bool synthio_synth_deinited(synthio_synth_t *synth);
-void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope);
+void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope, int voice_count);
 void synthio_synth_reset_buffer(synthio_synth_t *synth, bool single_channel_output, uint8_t channel);
 void synthio_synth_parse_waveform(mp_buffer_info_t *bufinfo_waveform, mp_obj_t waveform_obj);
 void synthio_synth_parse_filter(mp_buffer_info_t *bufinfo_filter, mp_obj_t filter_obj);
 void synthio_synth_parse_envelope(uint16_t *envelope_sustain_index, mp_buffer_info_t *bufinfo_envelope, mp_obj_t envelope_obj, mp_obj_t envelope_hold_obj);
 
 bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_t new_note);
+int synthio_span_find_voice(synthio_synth_t *synth, mp_obj_t note);
 
 void synthio_envelope_step(synthio_envelope_definition_t *definition, synthio_envelope_state_t *state, int n_samples);
 void synthio_envelope_definition_set(synthio_envelope_definition_t *envelope, mp_obj_t obj, uint32_t sample_rate);
@@ -44,6 +44,40 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
     return pythagorasSmallerThanRadius ? self->color_index : 0;
 }
 
+// The largest root with root * root <= n
+static uint32_t isqrt(uint32_t n) {
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > n) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (n >= root + bit) {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+uint16_t common_hal_vectorio_circle_get_spans(void *obj, int16_t y, const int16_t **out_spans) {
+    vectorio_circle_t *self = obj;
+    int32_t radius = self->radius;
+    int32_t abs_y = abs(y);
+    if (abs_y > radius) {
+        return 0;
+    }
+    // Same coverage as get_pixel: x * x + y * y <= radius * radius
+    int16_t half_width = isqrt((uint32_t)radius * radius - (uint32_t)abs_y * abs_y);
+    self->span[0] = -half_width;
+    self->span[1] = half_width + 1;
+    *out_spans = self->span;
+    return 1;
+}
+
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
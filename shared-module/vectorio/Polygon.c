@@ -19,6 +19,61 @@
 // #define VECTORIO_POLYGON_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
 
+// Builds the edge table used to find the spans of each row. Horizontal edges
+// never cross a row, so they are left out.
+static void _build_edge_table(vectorio_polygon_t *self) {
+    uint16_t point_count = self->len / 2;
+    vectorio_polygon_edge_t *edges = gc_realloc(self->edges, point_count * sizeof(vectorio_polygon_edge_t), true);
+    self->edges = edges;
+    self->crossings = gc_realloc(self->crossings, point_count * sizeof(vectorio_polygon_crossing_t), true);
+    self->spans = gc_realloc(self->spans, point_count * sizeof(int16_t), true);
+
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < point_count; ++i) {
+        int16_t x1 = self->points_list[2 * i];
+        int16_t y1 = self->points_list[2 * i + 1];
+        int16_t x2 = self->points_list[(2 * i + 2) % self->len];
+        int16_t y2 = self->points_list[(2 * i + 3) % self->len];
+        if (y1 == y2) {
+            continue;
+        }
+        vectorio_polygon_edge_t edge;
+        edge.winding = y1 < y2 ? 1 : -1;
+        if (y1 > y2) {
+            int16_t swap = x1;
+            x1 = x2;
+            x2 = swap;
+            swap = y1;
+            y1 = y2;
+            y2 = swap;
+        }
+        int32_t dx = x2 - x1;
+        int32_t dy = y2 - y1;
+        int32_t step = dx / dy;
+        int32_t step_remainder = dx % dy;
+        if (step_remainder < 0) {
+            step -= 1;
+            step_remainder += dy;
+        }
+        edge.step = step;
+        edge.step_remainder = step_remainder;
+        edge.x = x1;
+        edge.y_top = y1;
+        edge.y_bottom = y2;
+
+        // Insert in order of y_top
+        uint16_t j = count++;
+        while (j > 0 && edges[j - 1].y_top > edge.y_top) {
+            edges[j] = edges[j - 1];
+            --j;
+        }
+        edges[j] = edge;
+    }
+    self->edge_count = count;
+    self->crossing_count = 0;
+    self->scan_valid = false;
+}
+
 // Converts a list of points tuples to a flat list of ints for speedier internal use.
 // Also validates the points. If this fails due to invalid types or values, the
 // number of points is 0 and the points_list is NULL.
@@ -38,6 +93,8 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
     // In case the validation calls below fail, set these values temporarily
     self->points_list = NULL;
     self->len = 0;
+    self->edge_count = 0;
+    self->scan_valid = false;
 
     for (uint16_t i = 0; i < len; ++i) {
         size_t tuple_len = 0;
@@ -57,6 +114,7 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
 
     self->points_list = points_list;
     self->len = 2 * len;
+    _build_edge_table(self);
 }
 
 
@@ -65,6 +123,11 @@ void common_hal_vectorio_polygon_construct(vectorio_polygon_t *self, mp_obj_t po
     VECTORIO_POLYGON_DEBUG("%p polygon_construct: ", self);
     self->points_list = NULL;
     self->len = 0;
+    self->edges = NULL;
+    self->crossings = NULL;
+    self->spans = NULL;
+    self->edge_count = 0;
+    self->scan_valid = false;
     self->on_dirty.obj = NULL;
     self->color_index = color_index + 1;
     _clobber_points_list(self, points_list);
@@ -185,6 +248,99 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     return winding_number == 0 ? 0 : self->color_index;
 }
 
+// Start a crossing for an edge on row y
+static void _start_crossing(vectorio_polygon_crossing_t *crossing, const vectorio_polygon_edge_t *edge, uint16_t edge_index, int16_t y) {
+    int32_t dy = edge->y_bottom - edge->y_top;
+    int64_t offset = (int64_t)(y - edge->y_top) * (edge->step * dy + edge->step_remainder);
+    int32_t whole = offset / dy;
+    int32_t remainder = offset % dy;
+    if (remainder < 0) {
+        whole -= 1;
+        remainder += dy;
+    }
+    crossing->x = edge->x + whole;
+    crossing->remainder = remainder;
+    crossing->edge = edge_index;
+}
+
+// The first pixel that is not left of the crossing
+static inline int32_t _crossing_pixel(const vectorio_polygon_crossing_t *crossing) {
+    return crossing->x + (crossing->remainder != 0);
+}
+
+// Scanline version of get_pixel. Each edge crossing row y counts for the
+// pixels left of it, so walking the crossings from left to right gives the
+// winding number of every pixel on the row. The crossings are kept from one
+// row to the next and stepped, so rows asked for in order only cost a sort of
+// a nearly sorted list.
+uint16_t common_hal_vectorio_polygon_get_spans(void *obj, int16_t y, const int16_t **out_spans) {
+    vectorio_polygon_t *self = obj;
+    vectorio_polygon_crossing_t *crossings = self->crossings;
+    const vectorio_polygon_edge_t *edges = self->edges;
+
+    if (!self->scan_valid || y != self->scan_y + 1) {
+        self->crossing_count = 0;
+        self->next_edge = 0;
+    } else {
+        // Step the edges still crossing on to this row
+        uint16_t kept = 0;
+        for (uint16_t i = 0; i < self->crossing_count; ++i) {
+            vectorio_polygon_crossing_t crossing = crossings[i];
+            const vectorio_polygon_edge_t *edge = &edges[crossing.edge];
+            if (edge->y_bottom <= y) {
+                continue;
+            }
+            int32_t dy = edge->y_bottom - edge->y_top;
+            crossing.x += edge->step;
+            int32_t remainder = crossing.remainder + edge->step_remainder;
+            if (remainder >= dy) {
+                remainder -= dy;
+                crossing.x += 1;
+            }
+            crossing.remainder = remainder;
+            crossings[kept++] = crossing;
+        }
+        self->crossing_count = kept;
+    }
+    while (self->next_edge < self->edge_count && edges[self->next_edge].y_top <= y) {
+        if (edges[self->next_edge].y_bottom > y) {
+            _start_crossing(&crossings[self->crossing_count++], &edges[self->next_edge], self->next_edge, y);
+        }
+        self->next_edge++;
+    }
+    self->scan_y = y;
+    self->scan_valid = true;
+
+    for (uint16_t i = 1; i < self->crossing_count; ++i) {
+        vectorio_polygon_crossing_t crossing = crossings[i];
+        int32_t pixel = _crossing_pixel(&crossing);
+        uint16_t j = i;
+        while (j > 0 && _crossing_pixel(&crossings[j - 1]) > pixel) {
+            crossings[j] = crossings[j - 1];
+            --j;
+        }
+        crossings[j] = crossing;
+    }
+
+    uint16_t span_count = 0;
+    int16_t winding_number = 0;
+    int32_t start = 0;
+    for (uint16_t i = 0; i < self->crossing_count; ++i) {
+        int32_t pixel = _crossing_pixel(&crossings[i]);
+        int16_t before = winding_number;
+        winding_number -= edges[crossings[i].edge].winding;
+        if (before == 0) {
+            start = pixel;
+        } else if (winding_number == 0 && pixel > start) {
+            self->spans[2 * span_count] = start;
+            self->spans[2 * span_count + 1] = pixel;
+            span_count++;
+        }
+    }
+    *out_spans = self->spans;
+    return span_count;
+}
+
 mp_obj_t common_hal_vectorio_polygon_get_draw_protocol(void *polygon) {
     vectorio_polygon_t *self = polygon;
     return self->draw_protocol_instance;
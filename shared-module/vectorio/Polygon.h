@@ -11,6 +11,23 @@
 #include "py/obj.h"
 #include "shared-module/vectorio/__init__.h"
 
+// An edge that crosses at least one row, as seen from its top end.
+typedef struct {
+    int32_t step; // Whole pixels x moves per row
+    uint16_t step_remainder; // and the fraction of a pixel, in 1/(y_bottom - y_top)
+    int16_t x; // x at y_top
+    int16_t y_top; // First row the edge crosses
+    int16_t y_bottom; // First row below the edge
+    int8_t winding; // 1 if the points run towards larger y, else -1
+} vectorio_polygon_edge_t;
+
+// Where an edge crosses the current row: x + remainder / (y_bottom - y_top)
+typedef struct {
+    int32_t x;
+    uint16_t remainder;
+    uint16_t edge;
+} vectorio_polygon_crossing_t;
+
 typedef struct {
     mp_obj_base_t base;
     // An int array[ x, y, ... ]
@@ -19,4 +36,14 @@ typedef struct {
     uint16_t color_index;
     vectorio_event_t on_dirty;
     mp_obj_t draw_protocol_instance;
+    // Scanline state. The edges are sorted by y_top. The crossings are the
+    // active edges at scan_y, and edges from next_edge on have not been reached.
+    vectorio_polygon_edge_t *edges;
+    vectorio_polygon_crossing_t *crossings;
+    int16_t *spans;
+    uint16_t edge_count;
+    uint16_t crossing_count;
+    uint16_t next_edge;
+    int16_t scan_y;
+    bool scan_valid;
 } vectorio_polygon_t;
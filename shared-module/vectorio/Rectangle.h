@@ -18,4 +18,5 @@ typedef struct {
     uint16_t color_index;
     vectorio_event_t on_dirty;
     mp_obj_t draw_protocol_instance;
+    int16_t span[2];
 } vectorio_rectangle_t;
@@ -326,6 +326,89 @@ void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
+// Maps a screen coordinate on one axis to a shape coordinate: coordinate - origin,
+// or origin - 1 - coordinate when the axis is mirrored.
+typedef struct {
+    int32_t origin;
+    bool mirrored;
+} axis_mapping_t;
+
+// Shape y comes from screen y, or from screen x when the transform transposes.
+// This matches screen_to_shape_coordinates.
+static void get_axis_mappings(vectorio_vector_shape_t *self, axis_mapping_t *shape_x, axis_mapping_t *shape_y) {
+    displayio_buffer_transform_t *transform = self->absolute_transform;
+    if (transform->transpose_xy) {
+        shape_x->origin = transform->y + transform->dy * self->x;
+        shape_x->mirrored = transform->dy < 1;
+        shape_y->origin = transform->x + transform->dx * self->y;
+        shape_y->mirrored = transform->dx < 1;
+    } else {
+        shape_x->origin = transform->x + transform->dx * self->x;
+        shape_x->mirrored = transform->dx < 1;
+        shape_y->origin = transform->y + transform->dy * self->y;
+        shape_y->mirrored = transform->dy < 1;
+    }
+}
+
+// Shades and stores one covered pixel. Returns false if the pixel shader made it transparent.
+static bool draw_pixel(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, displayio_input_pixel_t *input_pixel,
+    uint32_t pixel_index, uint16_t linestride_px, uint32_t *mask, uint32_t *buffer) {
+    // Check the mask first to see if the pixel has already been set.
+    uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
+    uint8_t mask_bit = pixel_index % 32;
+    VECTORIO_SHAPE_PIXEL_DEBUG("\n%p pixel_index: %5u mask_bit: %2u mask: "U32_TO_BINARY_FMT, self, pixel_index, mask_bit, U32_TO_BINARY(*mask_doubleword));
+    if ((*mask_doubleword & (1u << mask_bit)) != 0) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" masked");
+        return true;
+    }
+
+    displayio_output_pixel_t output_pixel;
+    output_pixel.pixel = 0;
+    output_pixel.opaque = true;
+
+    if (self->pixel_shader == mp_const_none) {
+        output_pixel.pixel = input_pixel->pixel;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, &output_pixel);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        displayio_colorconverter_convert(self->pixel_shader, colorspace, input_pixel, &output_pixel);
+    }
+
+    *mask_doubleword |= 1u << mask_bit;
+    if (colorspace->depth == 16) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
+        *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
+    } else if (colorspace->depth == 32) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
+        *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
+    } else if (colorspace->depth == 8) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
+        *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
+    } else if (colorspace->depth < 8) {
+        uint8_t pixels_per_byte = 8 / colorspace->depth;
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t row = pixel_index / linestride_px;
+            uint16_t col = pixel_index % linestride_px;
+            pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+        }
+        uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
+        ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
+    }
+
+    // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
+    if (!output_pixel.opaque) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from colorconverter; input area is not fully covered)");
+        return false;
+    }
+    return true;
+}
+
 bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
     //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
@@ -334,7 +417,7 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     //   the shape_area (unshifted) space.
     #ifdef VECTORIO_PERF
     uint64_t start = common_hal_time_monotonic_ns();
-    uint64_t pixel_time = 0;
+    uint64_t span_time = 0;
     #endif
 
     if (self->hidden) {
@@ -354,7 +437,6 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    uint8_t pixels_per_byte = 8 / colorspace->depth;
     VECTORIO_SHAPE_DEBUG(" xy:(%3d %3d) tform:{x:%d y:%d dx:%d dy:%d scl:%d w:%d h:%d mx:%d my:%d tr:%d}",
         self->x, self->y,
         self->absolute_transform->x, self->absolute_transform->y, self->absolute_transform->dx, self->absolute_transform->dy, self->absolute_transform->scale,
@@ -362,111 +444,109 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
         );
 
     uint16_t linestride_px = displayio_area_width(area);
-    uint16_t line_dirty_offset_px = (overlap.y1 - area->y1) * linestride_px;
-    uint16_t column_dirty_offset_px = overlap.x1 - area->x1;
-    VECTORIO_SHAPE_DEBUG(", linestride:%3d line_offset:%3d col_offset:%3d depth:%2d ppb:%2d shape:%s",
-        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, pixels_per_byte, mp_obj_get_type_str(self->ishape.shape));
+    VECTORIO_SHAPE_DEBUG(", linestride:%3d depth:%2d shape:%s",
+        linestride_px, colorspace->depth, mp_obj_get_type_str(self->ishape.shape));
+
+    // The shape is drawn a row of the shape at a time, as the spans the shape
+    // covers on that row. Shape rows are screen rows, or screen columns when the
+    // transform transposes.
+    bool transpose_xy = self->absolute_transform->transpose_xy;
+    axis_mapping_t shape_x_axis, shape_y_axis;
+    get_axis_mappings(self, &shape_x_axis, &shape_y_axis);
+    int16_t row_first = transpose_xy ? overlap.x1 : overlap.y1;
+    int16_t row_last = (transpose_xy ? overlap.x2 : overlap.y2) - 1;
+    int16_t line_start = transpose_xy ? overlap.y1 : overlap.x1;
+    int16_t line_end = transpose_xy ? overlap.y2 : overlap.x2;
+    // Visit the shape rows in increasing order, which shapes can step through quickly
+    int8_t row_step = 1;
+    if (shape_y_axis.mirrored) {
+        int16_t swap = row_first;
+        row_first = row_last;
+        row_last = swap;
+        row_step = -1;
+    }
 
     displayio_input_pixel_t input_pixel;
-    displayio_output_pixel_t output_pixel;
-
-    displayio_area_t shape_area;
-    self->ishape.get_area(self->ishape.shape, &shape_area);
-
-    uint16_t mask_start_px = line_dirty_offset_px;
-    for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
-        mask_start_px += column_dirty_offset_px;
-        for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
-            // Check the mask first to see if the pixel has already been set.
-            uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
-            uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
-            uint8_t mask_bit = pixel_index % 32;
-            VECTORIO_SHAPE_PIXEL_DEBUG("\n%p pixel_index: %5u mask_bit: %2u mask: "U32_TO_BINARY_FMT, self, pixel_index, mask_bit, U32_TO_BINARY(*mask_doubleword));
-            if ((*mask_doubleword & (1u << mask_bit)) != 0) {
-                VECTORIO_SHAPE_PIXEL_DEBUG(" masked");
+    // vectorio shapes use 0 to mean "area is not covered", and the same value everywhere else
+    uint32_t shape_value = 0;
+
+    for (int16_t row = row_first; ; row += row_step) {
+        int16_t shape_y = shape_y_axis.mirrored ? shape_y_axis.origin - 1 - row : row - shape_y_axis.origin;
+        const int16_t *spans;
+        #ifdef VECTORIO_PERF
+        uint64_t pre_spans = common_hal_time_monotonic_ns();
+        #endif
+        uint16_t span_count = self->ishape.get_spans(self->ishape.shape, shape_y, &spans);
+        #ifdef VECTORIO_PERF
+        span_time += common_hal_time_monotonic_ns() - pre_spans;
+        #endif
+
+        int32_t covered = 0;
+        for (uint16_t i = 0; i < span_count; ++i) {
+            int32_t span_start, span_end;
+            if (shape_x_axis.mirrored) {
+                span_start = shape_x_axis.origin - spans[2 * i + 1];
+                span_end = shape_x_axis.origin - spans[2 * i];
+            } else {
+                span_start = shape_x_axis.origin + spans[2 * i];
+                span_end = shape_x_axis.origin + spans[2 * i + 1];
+            }
+            span_start = MAX(span_start, line_start);
+            span_end = MIN(span_end, line_end);
+            if (span_start >= span_end) {
                 continue;
             }
-            output_pixel.pixel = 0;
-
-            // Cast input screen coordinates to shape coordinates to pick the pixel to draw
-            int16_t pixel_to_get_x;
-            int16_t pixel_to_get_y;
-            screen_to_shape_coordinates(self, input_pixel.x, input_pixel.y, &pixel_to_get_x, &pixel_to_get_y);
-
-            VECTORIO_SHAPE_PIXEL_DEBUG(" get_pixel %p (%3d, %3d) -> ( %3d, %3d )", self->ishape.shape, input_pixel.x, input_pixel.y, pixel_to_get_x, pixel_to_get_y);
-            #ifdef VECTORIO_PERF
-            uint64_t pre_pixel = common_hal_time_monotonic_ns();
-            #endif
-            input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
-            #ifdef VECTORIO_PERF
-            uint64_t post_pixel = common_hal_time_monotonic_ns();
-            pixel_time += post_pixel - pre_pixel;
-            #endif
-            VECTORIO_SHAPE_PIXEL_DEBUG(" -> %d", input_pixel.pixel);
-
-            // vectorio shapes use 0 to mean "area is not covered."
-            // We can skip all the rest of the work for this pixel if it's not currently covered by the shape.
-            if (input_pixel.pixel == 0) {
-                VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel; input area is not fully covered)");
-                full_coverage = false;
-            } else {
-                // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
-                input_pixel.pixel -= 1;
-                output_pixel.opaque = true;
-
-                if (self->pixel_shader == mp_const_none) {
-                    output_pixel.pixel = input_pixel.pixel;
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                    displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                    displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+            covered += span_end - span_start;
+
+            if (shape_value == 0) {
+                int16_t shape_x = shape_x_axis.mirrored ? shape_x_axis.origin - 1 - span_start : span_start - shape_x_axis.origin;
+                shape_value = self->ishape.get_pixel(self->ishape.shape, shape_x, shape_y);
+                if (shape_value == 0) {
+                    // Not expected: the span and the pixel disagree
+                    covered -= span_end - span_start;
+                    continue;
                 }
+                // Pull the pixel value index down to 0-base for more error-resistant palettes.
+                input_pixel.pixel = shape_value - 1;
+            }
 
-                // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
-                if (!output_pixel.opaque) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from colorconverter; input area is not fully covered)");
+            for (int32_t line = span_start; line < span_end; ++line) {
+                input_pixel.x = transpose_xy ? row : line;
+                input_pixel.y = transpose_xy ? line : row;
+                uint32_t pixel_index = (input_pixel.y - area->y1) * linestride_px + (input_pixel.x - area->x1);
+                if (!draw_pixel(self, colorspace, &input_pixel, pixel_index, linestride_px, mask, buffer)) {
                     full_coverage = false;
                 }
-
-                *mask_doubleword |= 1u << mask_bit;
-                if (colorspace->depth == 16) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
-                    *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
-                    *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
-                    *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t row = pixel_index / linestride_px;
-                        uint16_t col = pixel_index % linestride_px;
-                        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
-                    }
-                    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
-                    }
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
-                    ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
+            }
+        }
+        if (full_coverage && covered < line_end - line_start) {
+            // Pixels the shape leaves uncovered only matter if nothing above has set them.
+            // The covered ones are all masked by now.
+            for (int32_t line = line_start; line < line_end; ++line) {
+                int16_t x = transpose_xy ? row : line;
+                int16_t y = transpose_xy ? line : row;
+                uint32_t pixel_index = (y - area->y1) * linestride_px + (x - area->x1);
+                if ((mask[pixel_index / 32] & (1u << (pixel_index % 32))) == 0) {
+                    VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel; input area is not fully covered)");
+                    full_coverage = false;
+                    break;
                 }
             }
         }
-        mask_start_px += linestride_px - column_dirty_offset_px;
+        if (row == row_last) {
+            break;
+        }
     }
     #ifdef VECTORIO_PERF
     uint64_t end = common_hal_time_monotonic_ns();
     uint32_t pixels = (overlap.x2 - overlap.x1) * (overlap.y2 - overlap.y1);
-    VECTORIO_PERF("draw %16s -> shape:{%4dpx, %4.1fms,%9.1fpps fill}  shape_pixels:{%6.1fus total, %4.1fus/px}\n",
+    VECTORIO_PERF("draw %16s -> shape:{%4dpx, %4.1fms,%9.1fpps fill}  shape_spans:{%6.1fus total, %4.1fus/px}\n",
         mp_obj_get_type_str(self->ishape.shape),
         (overlap.x2 - overlap.x1) * (overlap.y2 - overlap.y1),
         (double)((end - start) / 1000000.0),
         (double)(MAX(1, pixels * (1000000000.0 / (end - start)))),
-        (double)(pixel_time / 1000.0),
-        (double)(pixel_time / 1000.0 / pixels)
+        (double)(span_time / 1000.0),
+        (double)(span_time / 1000.0 / pixels)
         );
     #endif
     VECTORIO_SHAPE_DEBUG(" -> pixels:%4d\n", (overlap.x2 - overlap.x1) * (overlap.y2 - overlap.y1));
@@ -16,6 +16,11 @@
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Finds the runs of pixels the shape covers on row y, as [start, end) pairs in
+//   increasing order. The pairs are stored in the shape and stay valid until the
+//   next call. Returns the number of pairs. Shapes may be faster when rows are
+//   asked for in increasing order.
+typedef uint16_t get_spans_function(mp_obj_t shape, int16_t y, const int16_t **out_spans);
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -27,6 +32,7 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_spans_function *get_spans;
 } vectorio_ishape_t;
 
 typedef struct {
@@ -0,0 +1,59 @@
+import array
+from audiocore import StreamingSample, get_buffer, get_structure, reset_buffer
+
+
+def show(s):
+    result, buf = get_buffer(s)
+    print(result, list(buf), "fill", s.fill_level, "underruns", s.underruns)
+
+
+# 64 byte ring of 16 bit mono, played 8 samples at a time
+s = StreamingSample(64, sample_rate=8000)
+print(get_structure(s))
+reset_buffer(s)
+show(s)
+
+print(s.write(array.array("h", range(20))))
+print(s.fill_level)
+show(s)
+show(s)
+
+# Only the space not waiting to play can be written
+print(s.write(array.array("h", range(100, 130))))
+show(s)
+show(s)
+show(s)
+show(s)
+show(s)
+
+# Running out of data counts one underrun, however long it lasts
+show(s)
+show(s)
+print(s.write(array.array("h", [7, 8])))
+show(s)
+show(s)
+
+# Data written before playback starts is kept
+s = StreamingSample(32, channel_count=2)
+print(s.write(b"\x01\x00\x02\x00\x03"))
+reset_buffer(s)
+show(s)
+
+s = StreamingSample(16, bits_per_sample=8, samples_signed=False)
+show(s)
+
+try:
+    StreamingSample(bits_per_sample=12)
+except ValueError as e:
+    print(e)
+
+try:
+    StreamingSample(2)
+except ValueError as e:
+    print(e)
+
+s.deinit()
+try:
+    s.write(b"\x00")
+except ValueError as e:
+    print(e)
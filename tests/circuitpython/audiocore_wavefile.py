@@ -0,0 +1,82 @@
+import array
+import os
+import struct
+from audiocore import WaveFile, get_buffer, reset_buffer
+
+
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+bdev = RAMFS(64)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+
+FRAMES = 1000
+data = array.array("h", [(i * 37) % 2000 - 1000 for i in range(FRAMES)])
+with open("/ramdisk/ramp.wav", "wb") as f:
+    f.write(b"RIFF")
+    f.write(struct.pack("<I", 36 + 2 * FRAMES))
+    f.write(b"WAVEfmt ")
+    f.write(struct.pack("<IHHIIHH", 16, 1, 1, 8000, 16000, 2, 16))
+    f.write(b"data")
+    f.write(struct.pack("<I", 2 * FRAMES))
+    f.write(data)
+
+
+def play(wav, passes):
+    out = []
+    results = []
+    for _ in range(passes):
+        reset_buffer(wav)
+        while True:
+            result, buf = get_buffer(wav)
+            out.extend(buf)
+            results.append(len(buf))
+            if result != 1:
+                break
+    return out, results
+
+
+for buffer_count in (2, 3, 8):
+    for buffer in (None, bytearray(100 * buffer_count)):
+        wav = WaveFile("/ramdisk/ramp.wav", buffer, buffer_count=buffer_count)
+        out, results = play(wav, 3)
+        print(buffer_count, buffer is None, len(out), out == list(data) * 3, wav.underruns)
+        print(results[:4], results[-2:])
+
+# Restarting before the end rereads the file from the start
+wav = WaveFile("/ramdisk/ramp.wav", buffer_count=4)
+reset_buffer(wav)
+get_buffer(wav)
+out, results = play(wav, 1)
+print(out == list(data))
+
+for buffer_count in (1, 33):
+    try:
+        WaveFile("/ramdisk/ramp.wav", buffer_count=buffer_count)
+    except ValueError as e:
+        print(e)
+try:
+    WaveFile("/ramdisk/ramp.wav", bytearray(1025), buffer_count=2)
+except ValueError as e:
+    print(e)
+
+os.umount("/ramdisk")
@@ -0,0 +1,30 @@
+import array
+from audiocore import get_buffer, RawSample
+from audiodelays import Chorus, Echo
+from audiofilters import Distortion, Filter
+
+# A pass-through chain must reproduce its input exactly in every sample format
+for bits, signed, typecode in ((16, True, "h"), (16, False, "H"), (8, True, "b"), (8, False, "B")):
+    top = 1 << (bits - 1)
+    offset = 0 if signed else top
+    data = array.array(typecode, [offset + (i * 37) % (2 * top) - top for i in range(64)])
+    sample = RawSample(data, channel_count=2, sample_rate=8000)
+    kw = dict(bits_per_sample=bits, samples_signed=signed, channel_count=2, sample_rate=8000)
+    inner = Distortion(mix=0.0, buffer_size=24, **kw)
+    outer = Filter(filter=None, buffer_size=64 * bits // 8, **kw)
+    inner.play(sample)
+    outer.play(inner)
+    print(bits, signed, list(get_buffer(outer)[1]) == list(data))
+
+# Effects keep producing silence or their tail once the sample has finished
+data = array.array("b", [(i * 13) % 200 - 100 for i in range(32)])
+sample = RawSample(data, sample_rate=8000)
+chorus = Chorus(voices=3.0, bits_per_sample=8, buffer_size=128, sample_rate=8000)
+chorus.play(sample)
+for _ in range(4):
+    result, buf = get_buffer(chorus)
+print(result, len(buf), max(buf), min(buf), chorus.playing)
+
+echo = Echo(delay_ms=5, mix=0.5, bits_per_sample=8, samples_signed=False, buffer_size=64, sample_rate=8000)
+echo.play(RawSample(array.array("B", [255] * 16), sample_rate=8000))
+print([max(get_buffer(echo)[1]) for _ in range(4)], echo.playing)
@@ -0,0 +1,71 @@
+import array
+from audiocore import get_buffer, RawSample
+from audiomixer import Mixer
+
+# Reference for the fixed-point mixing done by Mixer: each voice is scaled by
+# its level, then the voices are added with 16-bit saturation. 8-bit output is
+# mixed in the top byte of 16 bits and truncated after each voice.
+
+
+def sat16(x):
+    return max(-32768, min(32767, x))
+
+
+def levels(level, channel_count):
+    level = int(level * 32768)
+    if channel_count == 2:
+        return (32767 * level) >> 15, (32768 * level) >> 15
+    return level, level
+
+
+def expected(voices, channel_count, frames, mask):
+    out = [0] * (frames * channel_count)
+    for data, voice_channels, level in voices:
+        lo, hi = levels(level, channel_count)
+        for i in range(len(out)):
+            if voice_channels == channel_count:
+                v = data[i]
+            else:
+                v = data[i // channel_count]
+            out[i] = sat16(out[i] + sat16((v * (hi if i % 2 else lo)) >> 15)) & mask
+    return out
+
+
+FRAMES = 32
+for bits, signed in ((16, True), (16, False), (8, True), (8, False)):
+    typecode = {16: "h", 8: "b"}[bits] if signed else {16: "H", 8: "B"}[bits]
+    shift = 16 - bits
+    top = 1 << (bits - 1)
+    offset = 0 if signed else top
+    for channel_count, voice_channels in ((1, 1), (2, 2), (2, 1)):
+        voices = []
+        for v, level in enumerate((1.0, 0.75, 0.5)):
+            n = FRAMES * voice_channels
+            raw = [((i * (37 + 16 * v) + v * 1000) % (2 * top)) - top for i in range(n)]
+            voices.append((raw, level))
+        mixer = Mixer(
+            voice_count=3,
+            buffer_size=FRAMES * channel_count * bits // 8 * 2,
+            channel_count=channel_count,
+            bits_per_sample=bits,
+            samples_signed=signed,
+            sample_rate=8000,
+        )
+        for v, (raw, level) in enumerate(voices):
+            sample = RawSample(
+                array.array(typecode, [x + offset for x in raw]),
+                channel_count=voice_channels,
+                sample_rate=8000,
+            )
+            mixer.voice[v].level = level
+            mixer.voice[v].play(sample)
+        # Mixing is done at 16 bits, 8-bit samples sit in the top byte
+        want = expected(
+            [([x << shift for x in raw], voice_channels, level) for raw, level in voices],
+            channel_count,
+            FRAMES,
+            -1 << shift,
+        )
+        want = [((x >> shift) + offset) for x in want]
+        got = list(array.array(typecode, get_buffer(mixer)[1]))
+        print(bits, signed, channel_count, voice_channels, got == want)
@@ -0,0 +1,82 @@
+# Checks the frame bookkeeping of MP3Decoder: seeking, looping and gapless
+# trimming. Only lengths, positions and whether decoded frames match each
+# other are printed, so the output doesn't depend on the decoder's exact
+# samples.
+import audiomp3, audiocore
+
+TEST_FILE = (
+    __file__.rsplit("/", 1)[0]
+    + "/../circuitpython-manual/audiocore/jeplayer-splash-44100-stereo.mp3"
+)
+
+# 155 frames of 1152 stereo samples after a LAME Info frame, which records an
+# encoder delay of 576 and padding of 1584. From frame 58 on, each frame's main
+# data starts further back than the previous frame's, so seeking there has to
+# decode several frames before the target.
+FRAME = 1152 * 2
+
+
+def frame_id(buf):
+    return hash(bytes(buf))
+
+
+def play(decoder):
+    frames = []
+    while True:
+        result, buf = audiocore.get_buffer(decoder)
+        frames.append((len(buf), frame_id(buf)))
+        if result != 1:
+            return result, frames
+
+
+# The Info frame plays as a frame of its own when gapless is off
+decoder = audiomp3.MP3Decoder(TEST_FILE)
+result, frames = play(decoder)
+print(result, len(frames), sum(n for n, _ in frames), decoder.samples_decoded)
+
+# Seeking rounds down to a frame, and the frame played next is the same as
+# when the file was played through
+for frame in (10, 3, 150, 0, 2):
+    decoder.seek(frame * FRAME + 100)
+    print(frame, decoder.samples_decoded, decoder.samples_decoded == frame * FRAME)
+    result, buf = audiocore.get_buffer(decoder)
+    print(result, len(buf), frame_id(buf) == frames[frame][1])
+
+# Playing to the end and resetting loops back to the first frame
+decoder.seek(154 * FRAME)
+result, again = play(decoder)
+print(result, again == frames[154:])
+audiocore.reset_buffer(decoder)
+print(decoder.samples_decoded)
+result, again = play(decoder)
+print(result, again == frames)
+
+# Gapless playback leaves out the Info frame, the encoder and decoder delay,
+# and the padding: exactly 4 seconds
+decoder = audiomp3.MP3Decoder(TEST_FILE, gapless=True)
+result, gapless = play(decoder)
+print(result, len(gapless), sum(n for n, _ in gapless), decoder.samples_decoded)
+print(gapless[0][0], gapless[1:-1] == frames[2:-1], gapless[-1][0])
+
+decoder.seek(44100 * 2)
+print(decoder.samples_decoded)
+result, buf = audiocore.get_buffer(decoder)
+print(result, len(buf), frame_id(buf) == frames[40][1])
+decoder.seek(0)
+print(decoder.samples_decoded)
+result, buf = audiocore.get_buffer(decoder)
+print(result, len(buf))
+
+decoder.seek(0)
+result, again = play(decoder)
+print(result, again == gapless)
+
+# Frames from the cache are the same as those decoded the first time. With
+# 200ms cached, the frame after the cache starts further back in the bit
+# reservoir than the frame before it holds.
+for cache_ms in (100, 200):
+    decoder = audiomp3.MP3Decoder(TEST_FILE, cache_ms=cache_ms)
+    result, first = play(decoder)
+    audiocore.reset_buffer(decoder)
+    result, second = play(decoder)
+    print(result, first == frames, second == frames)
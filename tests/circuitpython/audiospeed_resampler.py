@@ -0,0 +1,83 @@
+import array
+from audiocore import get_buffer, RawSample
+from audiomixer import Mixer
+from audiospeed import Quality, Resampler
+
+
+def render(sample, sample_rate, channel_count=1, bits_per_sample=16, samples_signed=True):
+    mixer = Mixer(
+        voice_count=1,
+        sample_rate=sample_rate,
+        channel_count=channel_count,
+        bits_per_sample=bits_per_sample,
+        samples_signed=samples_signed,
+        buffer_size=256,
+    )
+    mixer.voice[0].play(sample)
+    out = []
+    while mixer.voice[0].playing:
+        out.extend(get_buffer(mixer)[1])
+    return out
+
+
+QUALITIES = (Quality.NEAREST, Quality.LINEAR, Quality.CUBIC, Quality.SINC)
+
+print(Resampler(RawSample(array.array("h", [0]))).quality)
+
+# Upsampling a ramp by 2: every other output frame is between two source frames
+ramp = array.array("h", [i * 100 for i in range(64)])
+for quality in QUALITIES:
+    resampler = Resampler(RawSample(ramp, sample_rate=8000), quality=quality)
+    out = render(resampler, 16000)
+    print(resampler.quality, resampler.rate, len(out), out[:8], out[60:68])
+
+# A constant stays constant, apart from the edges, for all formats
+for bits, signed, typecode in ((16, True, "h"), (16, False, "H"), (8, True, "b"), (8, False, "B")):
+    top = 1 << (bits - 1)
+    offset = 0 if signed else top
+    for channel_count in (1, 2):
+        values = [offset + top // 2, offset - top // 3][:channel_count]
+        data = array.array(typecode, values * 100)
+        for quality in QUALITIES[1:]:
+            resampler = Resampler(
+                RawSample(data, channel_count=channel_count, sample_rate=11025), quality=quality
+            )
+            out = render(resampler, 8000, channel_count, bits, signed)
+            middle = out[16 * channel_count : 64 * channel_count]
+            print(
+                bits,
+                signed,
+                channel_count,
+                quality,
+                len(out) // channel_count,
+                [sorted(set(middle[c::channel_count])) for c in range(channel_count)],
+            )
+
+# A rate large enough to step past the whole window
+data = array.array("h", [1000] * 5000)
+for quality in QUALITIES[1:]:
+    out = render(Resampler(RawSample(data, sample_rate=800000), quality=quality), 8000)
+    print(quality, len(out), min(out[1:50]), max(out[1:50]))
+
+# Changing quality while playing takes effect with the next resampled buffer
+long_ramp = array.array("h", [i * 100 for i in range(200)])
+resampler = Resampler(RawSample(long_ramp, sample_rate=8000), quality=Quality.NEAREST)
+mixer = Mixer(voice_count=1, sample_rate=16000, channel_count=1, buffer_size=64)
+mixer.voice[0].play(resampler)
+out = list(get_buffer(mixer)[1])
+resampler.quality = Quality.LINEAR
+while len(out) < 300:
+    out.extend(get_buffer(mixer)[1])
+resampler.quality = Quality.NEAREST
+while mixer.voice[0].playing:
+    out.extend(get_buffer(mixer)[1])
+print(len(out), out[124:134], out[252:262], out[380:390])
+
+# A sample at a different rate is resampled automatically
+sample = RawSample(array.array("h", [i * 10 for i in range(100)]), sample_rate=22050)
+out = render(sample, 44100)
+print(len(out), out[:8])
+try:
+    Resampler(sample, quality=3)
+except TypeError as e:
+    print(type(e).__name__)
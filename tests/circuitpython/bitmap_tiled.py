@@ -0,0 +1,112 @@
+# A tiled Bitmap must behave exactly like a row-ordered one
+import bitmaptools
+import displayio
+import array
+
+
+def pattern(bitmap, seed):
+    m = (1 << bitmap.bits_per_value) - 1 if bitmap.bits_per_value < 32 else 0xFFFFFFFF
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            bitmap[x, y] = ((x * 7 + y * 13 + seed) * 2654435761 >> 7) & m
+
+
+def same(a, b):
+    if a.width != b.width or a.height != b.height:
+        return False
+    for y in range(a.height):
+        for x in range(a.width):
+            if a[x, y] != b[x, y]:
+                return False
+    return True
+
+
+def pair(w, h, bits):
+    return displayio.Bitmap(w, h, 1 << bits), displayio.Bitmap(w, h, 1 << bits, tiled=True)
+
+
+print(displayio.Bitmap(4, 4, 2).tiled, displayio.Bitmap(4, 4, 2, tiled=True).tiled)
+
+# get, set and fill
+for bits in (1, 2, 4, 8, 16):
+    a, b = pair(19, 13, bits)
+    pattern(a, 1)
+    pattern(b, 1)
+    r = same(a, b)
+    a.fill(1)
+    b.fill(1)
+    print("pixels", bits, r, same(a, b))
+
+# blit between every mix of layouts, with and without a skip index
+for bits in (1, 4, 8, 16):
+    results = []
+    for skip in (None, 1):
+        ref = None
+        for src_tiled in (False, True):
+            for dst_tiled in (False, True):
+                src = displayio.Bitmap(21, 17, 1 << bits, tiled=src_tiled)
+                dst = displayio.Bitmap(23, 19, 1 << bits, tiled=dst_tiled)
+                pattern(src, 3)
+                pattern(dst, 5)
+                bitmaptools.blit(dst, src, 3, 1, x1=2, y1=1, x2=19, y2=16, skip_source_index=skip)
+                bitmaptools.blit(dst, dst, 0, 2, x1=5, y1=0, x2=20, y2=12)
+                if ref is None:
+                    ref = dst
+                else:
+                    results.append(same(ref, dst))
+    print("blit", bits, results)
+
+# arrayblit
+for bits in (8, 16):
+    a, b = pair(20, 11, bits)
+    data = array.array("B" if bits == 8 else "H", range(72))
+    bitmaptools.arrayblit(a, data, 3, 2, 15, 8)
+    bitmaptools.arrayblit(b, data, 3, 2, 15, 8)
+    print("arrayblit", bits, same(a, b))
+    bitmaptools.arrayblit(a, data, 1, 1, 19, 5, skip_index=5)
+    bitmaptools.arrayblit(b, data, 1, 1, 19, 5, skip_index=5)
+    print("arrayblit skip", bits, same(a, b))
+
+# alphablend
+for cs in (displayio.Colorspace.L8, displayio.Colorspace.RGB565):
+    bits = 8 if cs == displayio.Colorspace.L8 else 16
+    out = []
+    for tiled in (False, True):
+        s1 = displayio.Bitmap(18, 10, 1 << bits, tiled=tiled)
+        s2 = displayio.Bitmap(18, 10, 1 << bits, tiled=tiled)
+        d = displayio.Bitmap(18, 10, 1 << bits, tiled=tiled)
+        pattern(s1, 7)
+        pattern(s2, 9)
+        bitmaptools.alphablend(d, s1, s2, cs, 0.25, 0.75)
+        out.append(d)
+    print("alphablend", bits, same(*out))
+
+# dither
+out = []
+for tiled in (False, True):
+    src = displayio.Bitmap(22, 12, 65536, tiled=tiled)
+    dst = displayio.Bitmap(22, 12, 65536, tiled=tiled)
+    pattern(src, 11)
+    bitmaptools.dither(dst, src, displayio.Colorspace.RGB565)
+    out.append(dst)
+print("dither", same(*out))
+
+# rotozoom
+out = []
+for tiled in (False, True):
+    src = displayio.Bitmap(16, 16, 256, tiled=tiled)
+    dst = displayio.Bitmap(20, 20, 256, tiled=tiled)
+    pattern(src, 13)
+    bitmaptools.rotozoom(dst, src, angle=1.5708)
+    out.append(dst)
+print("rotozoom", same(*out))
+
+# A tiled bitmap stores whole tiles, so the buffer is rounded up to them
+print(len(memoryview(displayio.Bitmap(9, 9, 256, tiled=True))))
+
+try:
+    import bitmapfilter
+
+    bitmapfilter.solarize(displayio.Bitmap(8, 8, 65536, tiled=True))
+except NotImplementedError as e:
+    print("NotImplementedError", e)
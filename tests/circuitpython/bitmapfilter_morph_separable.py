@@ -0,0 +1,61 @@
+# morph picks a different method for box, separable and other kernels. They must all
+# give the same result as convolving directly.
+from displayio import Bitmap
+import bitmapfilter
+import random
+
+random.seed(3)
+
+
+def make_bitmap(w, h):
+    b = Bitmap(w, h, 65536)
+    for y in range(h):
+        for x in range(w):
+            b[x, y] = random.getrandbits(16)
+    return b
+
+
+def swap(p):
+    return ((p >> 8) | (p << 8)) & 0xFFFF
+
+
+def reference(b, weights, mul):
+    n = int(len(weights) ** 0.5)
+    k = n // 2
+    m = round(65536 * mul)
+    r = Bitmap(b.width, b.height, 65536)
+    for y in range(b.height):
+        for x in range(b.width):
+            acc = [0, 0, 0]
+            for j in range(n):
+                for i in range(n):
+                    xx = min(max(x + i - k, 0), b.width - 1)
+                    yy = min(max(y + j - k, 0), b.height - 1)
+                    p = swap(b[xx, yy])
+                    w = weights[j * n + i]
+                    acc[0] += w * (p >> 11)
+                    acc[1] += w * ((p >> 5) & 0x3F)
+                    acc[2] += w * (p & 0x1F)
+            c = [min(max((a * m) >> 16, 0), lim) for a, lim in zip(acc, (31, 63, 31))]
+            r[x, y] = swap((c[0] << 11) | (c[1] << 5) | c[2])
+    return r
+
+
+kernels = (
+    ("box3", [1] * 9),
+    ("box5", [2] * 25),
+    ("gauss5", [a * b for a in (1, 4, 6, 4, 1) for b in (1, 4, 6, 4, 1)]),
+    ("sobel", [-1, 0, 1, -2, 0, 2, -1, 0, 1]),
+    ("sharpen", [-1, -2, -1, -2, 4, -2, -1, -2, -1]),
+    # separable, but a filtered row would not fit in 16 bits
+    ("wide", [a * b for a in (1, 2, 1) for b in (200, 300, 100)]),
+)
+
+for name, weights in kernels:
+    mul = 1 / (sum(weights) or 1)
+    for w, h in ((1, 1), (3, 8), (11, 6)):
+        b = make_bitmap(w, h)
+        expected = reference(b, weights, mul)
+        bitmapfilter.morph(b, weights, mul)
+        same = all(b[x, y] == expected[x, y] for y in range(h) for x in range(w))
+        print(name, w, h, same)
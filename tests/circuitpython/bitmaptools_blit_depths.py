@@ -0,0 +1,83 @@
+import array
+import bitmaptools
+import displayio
+
+
+def pattern(w, h, bits, seed):
+    b = displayio.Bitmap(w, h, 1 << bits)
+    mask = (1 << bits) - 1
+    v = seed
+    for y in range(h):
+        for x in range(w):
+            v = (v * 1103515245 + 12345) & 0x7FFFFFFF
+            b[x, y] = (v >> 8) & mask
+    return b
+
+
+def copy(b):
+    c = displayio.Bitmap(b.width, b.height, 1 << b.bits_per_value)
+    for y in range(b.height):
+        for x in range(b.width):
+            c[x, y] = b[x, y]
+    return c
+
+
+def reference(dest, src, x, y, x1, y1, x2, y2, skip):
+    src = copy(src)
+    for j in range(y2 - y1):
+        for i in range(x2 - x1):
+            if x + i < dest.width and y + j < dest.height:
+                v = src[x1 + i, y1 + j]
+                if v != skip:
+                    dest[x + i, y + j] = v
+
+
+def same(a, b):
+    return all(a[x, y] == b[x, y] for y in range(a.height) for x in range(a.width))
+
+
+for bits in (1, 2, 4, 8, 16):
+    bad = 0
+    cases = 0
+    for x, y, x1, y1, x2, y2 in (
+        (0, 0, 0, 0, 19, 7),
+        (3, 1, 5, 2, 18, 9),
+        (7, 4, 1, 0, 12, 5),
+        (9, 2, 0, 3, 19, 11),
+        (16, 10, 2, 2, 19, 11),
+        (1, 0, 3, 1, 4, 2),
+    ):
+        for skip in (None, 1):
+            src = pattern(19, 11, bits, x + y)
+            dest = pattern(21, 13, bits, x1 + 1)
+            expected = copy(dest)
+            reference(expected, src, x, y, x1, y1, x2, y2, skip)
+            bitmaptools.blit(dest, src, x, y, x1=x1, y1=y1, x2=x2, y2=y2, skip_source_index=skip)
+            cases += 1
+            bad += not same(dest, expected)
+
+            # within one bitmap, the source is read before it is overwritten
+            b = pattern(21, 13, bits, y2)
+            expected = copy(b)
+            reference(expected, b, x, y, x1, y1, x2, y2, skip)
+            bitmaptools.blit(b, b, x, y, x1=x1, y1=y1, x2=x2, y2=y2, skip_source_index=skip)
+            cases += 1
+            bad += not same(b, expected)
+    print(bits, cases, bad)
+
+# a deeper destination still takes the general path
+src = pattern(8, 8, 2, 1)
+dest = displayio.Bitmap(8, 8, 256)
+bitmaptools.blit(dest, src, 0, 0)
+print(same(dest, src))
+
+# arrayblit with elements as wide as the values
+for bits, code in ((8, "B"), (16, "H")):
+    dest = pattern(10, 6, bits, 3)
+    expected = copy(dest)
+    data = array.array(code, [(i * 7) % 5 for i in range(4 * 3)])
+    bitmaptools.arrayblit(dest, data, 3, 2, 7, 5, skip_index=0)
+    for i, v in enumerate(data):
+        if v != 0:
+            expected[3 + i % 4, 2 + i // 4] = v
+    print(bits, same(dest, expected))
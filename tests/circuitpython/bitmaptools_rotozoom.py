@@ -0,0 +1,66 @@
+import bitmaptools
+import displayio
+import math
+
+
+def pattern(w, h, n):
+    b = displayio.Bitmap(w, h, n)
+    for y in range(h):
+        for x in range(w):
+            b[x, y] = (x + y * w + 1) % n
+    return b
+
+
+def show(b):
+    for y in range(b.height):
+        print(" ".join("%2d" % b[x, y] for x in range(b.width)))
+    print()
+
+
+for n in (16, 256, 65536):
+    src = pattern(4, 3, n)
+    # unrotated, unscaled is a plain copy
+    dest = displayio.Bitmap(6, 5, n)
+    bitmaptools.rotozoom(dest, src, ox=3, oy=2, px=2, py=1)
+    show(dest)
+    # quarter turns land exactly on the source pixels
+    dest = displayio.Bitmap(6, 6, n)
+    bitmaptools.rotozoom(dest, src, ox=3, oy=3, px=2, py=1, angle=math.pi / 2)
+    show(dest)
+    dest = displayio.Bitmap(6, 5, n)
+    bitmaptools.rotozoom(dest, src, ox=3, oy=2, px=2, py=1, angle=math.pi, skip_index=6)
+    show(dest)
+
+# scaling, and clipping on both bitmaps
+src = pattern(4, 3, 16)
+dest = displayio.Bitmap(10, 8, 16)
+bitmaptools.rotozoom(dest, src, ox=0, oy=0, px=0, py=0, scale=2, source_clip1=(3, 3), dest_clip1=(9, 5))
+show(dest)
+# a rotation that leaves most of the destination uncovered
+dest = displayio.Bitmap(12, 12, 16)
+bitmaptools.rotozoom(dest, src, ox=6, oy=6, angle=0.6, scale=2.5)
+show(dest)
+# zero scale draws nothing
+dest = displayio.Bitmap(4, 4, 16)
+bitmaptools.rotozoom(dest, src, scale=0)
+show(dest)
+
+# bilinear blends RGB565 neighbours
+src = displayio.Bitmap(2, 1, 65536)
+src[0, 0] = 0x0000
+src[1, 0] = 0xFFFF
+dest = displayio.Bitmap(8, 1, 65536)
+bitmaptools.rotozoom(dest, src, ox=0, oy=0, px=0, py=0, scale=4, bilinear=True)
+print(["%04x" % dest[x, 0] for x in range(8)])
+src[0, 0] = 0xF800
+src[1, 0] = 0x001F
+bitmaptools.rotozoom(dest, src, ox=0, oy=0, px=0, py=0, scale=4, bilinear=True)
+print(["%04x" % dest[x, 0] for x in range(8)])
+# next to the skip index, the nearest pixel is used
+dest = displayio.Bitmap(8, 1, 65536)
+bitmaptools.rotozoom(dest, src, ox=0, oy=0, px=0, py=0, scale=4, bilinear=True, skip_index=0x001F)
+print(["%04x" % dest[x, 0] for x in range(8)])
+try:
+    bitmaptools.rotozoom(displayio.Bitmap(8, 8, 256), pattern(4, 4, 256), bilinear=True)
+except ValueError as e:
+    print(e)
@@ -0,0 +1,35 @@
+import array
+import displayio
+
+for colorspace in (
+    displayio.Colorspace.RGB888,
+    displayio.Colorspace.RGB565,
+    displayio.Colorspace.RGB565_SWAPPED,
+    displayio.Colorspace.BGR555,
+    displayio.Colorspace.L8,
+):
+    source = array.array("I" if colorspace == displayio.Colorspace.RGB888 else "H")
+    for i in range(70):
+        source.append((i * 0x1234567) & (0xFFFFFF if colorspace == displayio.Colorspace.RGB888 else 0xFFFF))
+    for dither in (False, True):
+        converter = displayio.ColorConverter(input_colorspace=colorspace, dither=dither)
+        dest = array.array("H", [0] * len(source))
+        converter.convert_row(source, dest, x=3, y=5)
+        print(colorspace, dither, ["%04x" % c for c in dest[:8]])
+        if not dither:
+            print("matches convert", list(dest) == [converter.convert(c) for c in source])
+
+converter = displayio.ColorConverter(input_colorspace=displayio.Colorspace.L8)
+dest = array.array("H", [0] * 4)
+converter.convert_row(b"\x00\x40\x80\xff", dest)
+print(["%04x" % c for c in dest])
+
+try:
+    converter.convert_row(b"\x00\x40\x80\xff", array.array("H", [0] * 3))
+except ValueError as e:
+    print("ValueError", e)
+
+try:
+    converter.convert_row(b"\x00\x40", bytearray(4))
+except ValueError as e:
+    print("ValueError", e)
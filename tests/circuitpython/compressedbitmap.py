@@ -0,0 +1,76 @@
+# CompressedBitmap must return the values of the Bitmap it was made from
+import displayio
+
+
+def check(bitmap):
+    data = displayio.CompressedBitmap.compress(bitmap)
+    compressed = displayio.CompressedBitmap(data)
+    ok = (compressed.width, compressed.height, compressed.bits_per_value) == (
+        bitmap.width,
+        bitmap.height,
+        bitmap.bits_per_value,
+    )
+    # Along rows, backwards and down columns, to use the row index and restart within a row
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            ok = ok and compressed[x, y] == bitmap[x, y]
+        for x in range(bitmap.width - 1, -1, -1):
+            ok = ok and compressed[x, y] == bitmap[x, y]
+    for x in range(bitmap.width):
+        for y in range(bitmap.height):
+            ok = ok and compressed[x, y] == bitmap[x, y]
+    ok = ok and compressed[bitmap.width * bitmap.height - 1] == bitmap[bitmap.width - 1, bitmap.height - 1]
+    return ok, len(data)
+
+
+for bits in (1, 2, 4, 8, 16):
+    bitmap = displayio.Bitmap(300, 7, 1 << bits)
+    mask = (1 << bits) - 1
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            if y == 0:
+                v = 0
+            elif y == 1:
+                v = x * 2654435761 >> 5
+            elif y == 2:
+                v = x // 3
+            elif y == 3:
+                v = x // 2
+            else:
+                v = (x // 40 + y) * 0x01234567
+            bitmap[x, y] = v & mask
+    print(bits, *check(bitmap))
+
+# A flat background of a 320x240 RGB565 screen with some bars
+background = displayio.Bitmap(320, 240, 65536, tiled=True)
+background.fill(0x1234)
+for y in range(20, 220, 40):
+    for x in range(320):
+        background[x, y] = 0xFFFF
+        background[x, y + 1] = x // 10
+print(*check(background))
+
+try:
+    displayio.CompressedBitmap(b"RLEB")
+except ValueError as e:
+    print("ValueError", e)
+data = bytearray(displayio.CompressedBitmap.compress(background))
+data[15] = 0xFF
+try:
+    displayio.CompressedBitmap(data)
+except ValueError as e:
+    print("ValueError", e)
+try:
+    displayio.CompressedBitmap(displayio.CompressedBitmap.compress(background))[0, 0] = 1
+except RuntimeError as e:
+    print("RuntimeError", e)
+
+# Data that can be changed is copied, so changing it afterwards doesn't matter
+data = bytearray(displayio.CompressedBitmap.compress(background))
+compressed = displayio.CompressedBitmap(data)
+for i in range(12, len(data)):
+    data[i] = 0xFF
+data.extend(bytes(1000))
+print(compressed[0, 0] == background[0, 0], compressed[319, 239] == background[319, 239])
+compressed = displayio.CompressedBitmap(memoryview(bytes(displayio.CompressedBitmap.compress(background))))
+print(compressed[5, 21] == background[5, 21])
@@ -0,0 +1,72 @@
+import array
+import os
+import random
+
+import displayio
+import gifio
+
+
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+bdev = RAMFS(200)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+
+
+def quantize_rgb565(pixel):
+    return ((pixel >> 14) & 3) << 5 | ((pixel >> 8) & 7) << 2 | ((pixel >> 3) & 3)
+
+
+# Write the frames, then check that OnDiskGif reads back the same palette
+# indices for every frame
+def check(name, width, height, colorspace, frames, quantize):
+    with gifio.GifWriter(name, width, height, colorspace) as g:
+        for frame in frames:
+            g.add_frame(frame, 0.1)
+    print(name, os.stat(name)[6])
+
+    odg = gifio.OnDiskGif(name, use_palette=True)
+    b = odg.bitmap
+    for frame in frames:
+        odg.next_frame()
+        same = all(b[i] == quantize(frame[i]) for i in range(width * height))
+        print(odg.dirty_area, same)
+    odg.deinit()
+
+
+random.seed(1)
+width, height = 40, 30
+frames = []
+frame = array.array("H", [0] * (width * height))
+for i in range(width * height):
+    frame[i] = (i // 7) * 0x0841 & 0xFFFF
+frames.append(array.array("H", frame))
+for k in range(4):
+    for j in range(k * 5):
+        frame[random.randrange(width * height)] = random.getrandbits(16)
+    frames.append(array.array("H", frame))
+check("/ramdisk/color.gif", width, height, displayio.Colorspace.RGB565, frames, quantize_rgb565)
+
+# Noise doesn't compress, so the code table fills up and is cleared
+width, height = 100, 60
+frame = bytearray(random.getrandbits(8) for i in range(width * height))
+check("/ramdisk/gray.gif", width, height, displayio.Colorspace.L8, [frame], lambda v: v >> 1)
@@ -0,0 +1,42 @@
+import binascii
+import os
+import gifio
+
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+bdev = RAMFS(50)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+# 8x6, a red frame, a green 3x2 frame at (2, 1) that is restored to the
+# background afterwards, then a blue 2x2 frame at (5, 4) with a transparent pixel
+with open("/ramdisk/a.gif", "wb") as f:
+    f.write(binascii.a2b_base64(b"R0lGODlhCAAGAIEAAAAAAP8AAAD/AAAA/yH/C05FVFNDQVBFMi4wAwEAAAAh+QQECgAAACwAAAAACAAGAAACHEyYMGHChAkTJkyYMGHChAkTJkyYMGHChAkTJgUAIfkECAoAAAAsAgABAAMAAgAAAgSUKFEqACH5BAUKAAAALAUABAACAAIAAAIDHLgVADs="))
+
+for use_palette in (False, True):
+    odg = gifio.OnDiskGif("/ramdisk/a.gif", use_palette=use_palette)
+    print(odg.width, odg.height, odg.frame_count)
+    b = odg.bitmap
+    for i in range(4):
+        delay = odg.next_frame()
+        print(round(delay, 3), odg.dirty_area)
+        for y in range(b.height):
+            print(" ".join("%04x" % b[x, y] for x in range(b.width)))
+    odg.deinit()
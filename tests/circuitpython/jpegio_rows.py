@@ -0,0 +1,158 @@
+from displayio import Bitmap
+import binascii
+import jpegio
+import bitmaptools
+
+content = binascii.a2b_base64(
+    b"""
+/9j/4AAQSkZJRgABAQAAAQABAAD/2wBDACEXGR0ZFSEdGx0lIyEoMlM2Mi4uMmZJTTxTeWp/fXdq
+dHKFlr+ihY21kHJ0puOotcbM1tjWgaDr/OnQ+r/S1s7/2wBDASMlJTIsMmI2NmLOiXSJzs7Ozs7O
+zs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7Ozs7/wAARCADwAPADASIA
+AhEBAxEB/8QAGgABAAMBAQEAAAAAAAAAAAAAAAIDBAEFBv/EACsQAAICAQMDAwMEAwAAAAAAAAAB
+AgMREiExBEFREyJhMkJSBTNxgRRikf/EABgBAQEBAQEAAAAAAAAAAAAAAAACAQME/8QAIxEBAQAC
+AgICAgMBAAAAAAAAAAECEQMSITFBURMiMmFxof/aAAwDAQACEQMRAD8A8oAAAAAAAAAAAAAB2MXJ
+7FsafLNktbpSC/0oh0rsb0pqqATlU1xuQJs0wAAAAAAAAAAAAAAAAAAAAAAAAAAADDfY6oSfYDh2
+MXJ4RONLfOxbGKitipjflshFKKwW1U23vFUHL57EY1+rZCHlnrz6qrooKuCSx3LtvqGWXV58+g6q
+EdTgmvgzJ7tNYa5TPo6+ohKmM3JPPg839Y6eMdN8FjLw/kmZX5Jk88hOCkvkmDpZtbI1h4YLbo/c
+VHGzVRQAGMAAAAAAAAAAAAAAAAAAAC5AA0rSltgOcU8ZK61GSw+STqWcnWW68LWAAtqdE9F0ZeGV
+9e5O7PZ8HQ9+dybNoyx3ZVXT2ThNNuWnwbuo66V9Cq9NYXdmYGdfGm9JvaEYNfcTAKk0pGxZgzMa
+pfSzKc805AAISAAAAAAAAAAAAAAAAAAAAABZCU2ttytLLwXWPRFQj/Zs8KxnzXVOX4ndUvxM+X5Z
+JWSXcqZG161PnY6lgpVsu5ZCxS/kqZStlTABbQAARseIMzF9zxAoOWftGQACGAAAAAAAAAAAAAAA
+AAAAAACyiOZanwiE3qk2S9RqGldyAVbNSQAASHYvDTOCKy0BrXAC4B3dAAGim97pFRKx5myJwyu6
+igAMYAAAAAAAAAAAAAAAAAAAAAAAAAAAWUxzLPgrNtENMF5ZuPt048O9RBKfJE7NymroIzeItkim
+6XCMyuomqgAcUAAAAAAAAAAAAAAAAAAAAAAAAAAAAAC3p4KdizwjelAz9PDTDPdljeEdMfD1Y8Ws
+d70XqOVjkqAOjhJqBlm9Umy+2WImc5Z34ZkAAhIAAAAAAAAAAAAAAAAAAAAAAAAAABZRW7LEvBWb
+OmjohnuzZ7Xhhcr4XaWuxG2LUcktT8lc7HLbsdZp25byTUutIAHG8LJrkpulmWPBWG8tsHG3dc6A
+AwAdUW+w0S8DQ4BjAAAAAAAAAAAAAAAAAAAAAAtyz09McyNk2I1R1zSN6WFgp6SKjFya5NOYeCsZ
+4enitwn8ark8RKjRZKGjHcznSTSMuS53zNBXc8Rx5LCmfvsS7GZekVUEm+EaFXFdiSSXCI6M6qY1
+N87Fsa4rsSBcxkboACWTWoygpLdFFkHB78HowUfTxjcz9UloRGchMe0yt8aZAd0vwcObmAAAAAAA
+AAAAAAABOENX8CTY7RhXRzwW9R7rFFdyEqsLMeUT6eLstcpPgvVnhcmM9r4rTFI6S0Pyjqrb7lar
+13n45PbPJ5Zw7JYk0cKea3fkI0VuyUpITeIMt6RqNL3WTL7Rlv4QaaZOEHOWOCeU+6Oxa1LdDbvl
+xaxt2rnW4yxycUGWzktT3RB2QX3Iy5Kw48esuVW4j6fBBJIrfUwUGllsqd05fTHAuW0cdw49/wCt
+OuME3J4MspO6f+qCrcnmbyTSSWw1b7Rllcrb9ukZQUlwSJ11ufBWtptkm6xSi4vDOF/VQ0teSg42
+aqbNUABjAAAAAAAAA21U5gsGI9DpZ6obdkXh7VP43XtTb7E0yXTRxXnyc6rheWyyCxBI23deniws
+y8pHJScVszpGxPHBs9unLrrdq3uAC3kV3P2nFVtyxd2Rak8Ea3Wa3VfpP8mPSf5MvhXKfBBpp4N6
+w8W6V+l5bCqiWYJyqko5HWF1PapQiuxI7h+CdVep+41t/WbVhLLwiyVeJNJ7HYxUXkbXjx5ZTcQd
+clyi2paWSsfBltu+2HPky3VMcZ+LeXuo3P1b8dkcdUTsI6V8kzJj9uevtnnU47rdEDWZ7YaXlcMn
+LHXmMsQABCQAAAAll4Asqrzu+CaU65aq3/RNLSkjp1mM0vU0qlZKc4qSxubVJY+kxz/ciajJ4rtx
+4TPdyT1R/E5OxaMY5IkLOxUreXhx67QABTirt+qP8mpcIy3cJhTtx5Od9unHnMLdttbxkg92Z1fb
+H7UPXs/EbbjnhM7l9tBOTehGT15/iHfa1jSJTPPDK436aCUPqRk9S5/BzFr5lgTas+WZY2RpnOKb
+y0VS6iK+lZZX6S7tskopcI3VqPy5a1HJTsue+yOxgokgbI5SAAKaHLIZplLwdFvtpfyTl6Otynhk
+ABxcwAACVbxZF/JEkoSxqEGyxNvJDDZOqanBeS6vCT2O0u3fkw649sWK3ZxfybIxzFNNFF1eYto7
+RLVWvgnxtWGOcy1vS/Q/KDrTjuyAecM2WLz4+TLHXZS+QAW86NizBnKnmOPBMp/bs+GTfF2yrgOQ
+U0Aaa5QAAJN8IAACTrko6sbBlsiIO4fgnXD3e7gxVl1vSslBZks8Fs4RUtkcMt06cfH3x3U5qKw0
+jF1U8tRXY0dRaoQS7mBtt5ZGdcplMePpAAEOYAAB3U33OACUJuDyjXV1MM+7YxA2XSu111b3ODz7
+kUVSULnHOzM4G3S81uv6elhnCqjqm0oz5L9fwi5qu2PJnlNyf9VOuTeUiBpVj8FEovLZe443HPdt
+nhEjKKksMkAlXCfpvTNbeTTXpypLcpaTWGV4lU8xlt4J8xUykmrPDbalJor0IqXVZfvRZG2EuJGd
+tuvDMOki6rCTWCtxTfBODWHuiOTbfBhhj3yrmleC1vNZXleTrsiq95ISt5ccf1/1w6uUUy6iC43K
+pdTL7VgncVny4ya212NJ7vBms6hLaH/SiU5TeZPJEy5beb8tmMxjrbk8t5OAEuQAAAAAAAAAAAAA
+E4XThw9iADZbPTTHqvKJf5EPkyA3ddZzZxqd1bIO6PZMoBvapvJasdrfGxW23ywDLbXPYADB1Sa4
+bGuXlnADbup+WcAAAAAAAAAAAAD/2Q=="""
+)
+
+decoder = jpegio.JpegDecoder()
+
+
+def full(scale, bits=16):
+    w, h = decoder.open(content)
+    b = Bitmap(w >> scale, h >> scale, 1 << bits)
+    decoder.decode(b, scale=scale)
+    return b
+
+
+def test_crop(scale, x=0, y=0, **crop):
+    ref = full(scale)
+    w, h = ref.width, ref.height
+    expected = Bitmap(w, h, 65536)
+    bitmaptools.blit(expected, ref, x, y, **crop)
+    b = Bitmap(w, h, 65536)
+    decoder.open(content)
+    decoder.decode(b, scale=scale, x=x, y=y, **crop)
+    print("crop", scale, x, y, memoryview(b) == memoryview(expected))
+
+
+def test_rows(scale, band_height, bits=16, **crop):
+    ref = full(scale, bits)
+    w, h = ref.width, ref.height
+    x1 = crop.get("x1", 0)
+    y1 = crop.get("y1", 0)
+    x2 = crop.get("x2", w)
+    y2 = crop.get("y2", h)
+    expected = Bitmap(x2 - x1, y2 - y1, 1 << bits)
+    bitmaptools.blit(expected, ref, 0, 0, x1=x1, y1=y1, x2=x2, y2=y2)
+
+    band = Bitmap(x2 - x1, band_height, 1 << bits)
+    result = Bitmap(x2 - x1, y2 - y1, 1 << bits)
+    calls = []
+
+    def rows_ready(y, height):
+        calls.append((y, height))
+        bitmaptools.blit(result, band, 0, y, x2=band.width, y2=height)
+
+    decoder.open(content)
+    decoder.decode_rows(band, rows_ready, scale, **crop)
+    print("rows", scale, band_height, bits, memoryview(result) == memoryview(expected))
+    print(calls)
+
+
+print("crop")
+test_crop(0, x1=13, y1=21, x2=100, y2=77)
+test_crop(1, x=5, y=7, x1=3, y1=9, x2=61, y2=60)
+test_crop(0, x=200, y=230)
+test_crop(2, x1=17, y1=17, x2=18, y2=18)
+
+print("grayscale")
+gray = full(0, 8)
+color = full(0)
+print(gray.width, gray.height)
+for x, y in ((0, 0), (60, 60), (120, 200), (239, 239)):
+    c = color[x, y]
+    c = (c >> 8) | ((c & 0xFF) << 8)
+    luma = (((c >> 11) << 3) * 77 + (((c >> 5) & 0x3F) << 2) * 150 + ((c & 0x1F) << 3) * 29) >> 8
+    print(abs(gray[x, y] - luma) < 8)
+gray3 = full(3, 8)
+print(sum(gray3[i] for i in range(gray3.width * gray3.height)))
+
+print("rows")
+test_rows(0, 16)
+test_rows(0, 40)
+test_rows(1, 8, x1=10, y1=5, x2=90, y2=100)
+test_rows(3, 2, bits=8)
+test_rows(2, 4, y1=3, y2=4)
+
+try:
+    decoder.open(content)
+    decoder.decode_rows(Bitmap(240, 8, 65536), print)
+except ValueError as e:
+    print(e)
+try:
+    decoder.open(content)
+    decoder.decode_rows(Bitmap(100, 16, 65536), print)
+except ValueError as e:
+    print(e)
+
+print("callback errors")
+
+
+def rows_raise(y, height):
+    raise KeyError(y)
+
+
+def rows_reenter(y, height):
+    decoder.open(content)
+
+
+band = Bitmap(240, 16, 65536)
+for rows_ready in (rows_raise, rows_reenter):
+    decoder.open(content)
+    try:
+        decoder.decode_rows(band, rows_ready)
+    except Exception as e:
+        print(type(e).__name__, e)
+    # The decoder was closed, and can be used again
+    try:
+        decoder.decode(band)
+    except RuntimeError as e:
+        print(e)
+    print(decoder.open(content))
+    print("rows", memoryview(full(0)) == memoryview(color))
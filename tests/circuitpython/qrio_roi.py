@@ -0,0 +1,119 @@
+# Checks where QRDecoder searches and how it reports positions: roi, track,
+# scale and the binarize pre-check. Positions are compared with a tolerance
+# so the output doesn't depend on exactly how quirc fits the corners.
+import qrio
+
+W, H = 240, 180
+
+# "CircuitPython" as a version 1 code, one int per row of 21 modules
+CODE = (
+    0x1FCB7F, 0x104E41, 0x175B5D, 0x174A5D, 0x17455D, 0x104141, 0x1FD57F,
+    0x001B00, 0x1DFEC4, 0x0DBE8F, 0x03D17F, 0x079B21, 0x0EDEB9, 0x0017DA,
+    0x1FDFF3, 0x105D00, 0x175E82, 0x17433A, 0x175779, 0x105602, 0x1FD83B,
+)
+MODULE = 4
+SIZE = 21 * MODULE
+
+
+def frame(x0=None, y0=None):
+    img = bytearray([200]) * (W * H)
+    if x0 is not None:
+        for j, row in enumerate(CODE):
+            for i in range(21):
+                if row & (1 << (20 - i)):
+                    for y in range(y0 + j * MODULE, y0 + (j + 1) * MODULE):
+                        start = y * W + x0 + i * MODULE
+                        img[start : start + MODULE] = b"\x14" * MODULE
+    return img
+
+
+def near(found, x0, y0, tolerance):
+    expected = ((x0, y0), (x0 + SIZE, y0), (x0 + SIZE, y0 + SIZE), (x0, y0 + SIZE))
+    return [
+        abs(found[2 * i] - x) <= tolerance and abs(found[2 * i + 1] - y) <= tolerance
+        for i, (x, y) in enumerate(expected)
+    ]
+
+
+def show(decoder, img, x0, y0):
+    found = decoder.find(img)
+    print(len(found), [(near(p, x0, y0, 2 * decoder.scale), p.size) for p in found])
+
+
+def contains(roi, x0, y0):
+    return roi[0] <= x0 and roi[1] <= y0 and roi[2] >= x0 + SIZE and roi[3] >= y0 + SIZE
+
+
+# Positions are in image pixels whatever the scale and roi
+for scale in (1, 2):
+    decoder = qrio.QRDecoder(W, H, scale=scale)
+    print(decoder.scale, decoder.roi)
+    show(decoder, frame(96, 48), 96, 48)
+    decoder.roi = (64, 32, 216, 168)
+    print(decoder.roi)
+    show(decoder, frame(96, 48), 96, 48)
+    # Nothing of the code is inside the roi
+    decoder.roi = (200, 0, 240, 180)
+    show(decoder, frame(96, 48), 96, 48)
+
+# roi must lie inside the image and hold at least one scaled pixel
+decoder = qrio.QRDecoder(W, H, scale=2)
+for roi in (
+    (0, 0, 1, 10),
+    (0, 0, 241, 10),
+    (-1, 0, 10, 10),
+    (0, 179, 10, 180),
+    (10, 10, 11, 12),
+    (1, 2, 3),
+):
+    try:
+        decoder.roi = roi
+    except (ValueError, TypeError) as e:
+        print(type(e).__name__, e)
+print(decoder.roi)
+decoder.roi = (2, 2, 4, 4)
+print(decoder.roi)
+decoder.roi = None
+print(decoder.roi)
+decoder.roi = (2, 2, 40, 40)
+decoder.width = 100
+print(decoder.roi)
+try:
+    qrio.QRDecoder(W, H, scale=9)
+except ValueError as e:
+    print(e)
+
+# track moves roi to the code, follows it, and goes back to the whole image
+# when nothing is seen
+decoder = qrio.QRDecoder(W, H, binarize=True)
+decoder.track = True
+print(decoder.track, len(decoder.decode(frame(96, 48))))
+roi = decoder.roi
+print(contains(roi, 96, 48), roi != (0, 0, W, H))
+print(len(decoder.decode(frame(104, 56))), contains(decoder.roi, 104, 56))
+show(decoder, frame(104, 56), 104, 56)
+print(decoder.decode(frame()), decoder.roi)
+decoder.track = False
+print(len(decoder.decode(frame(96, 48))), decoder.roi)
+
+# With binarize, a frame with nothing like a finder pattern is rejected
+# without a search, but a code is still found
+for binarize in (False, True):
+    decoder = qrio.QRDecoder(W, H, binarize=binarize)
+    show(decoder, frame(96, 48), 96, 48)
+    print(decoder.find(frame()))
+img = frame()
+for y in range(20, 60):
+    img[y * W + 30 : y * W + 90] = b"\x0a" * 60
+print(qrio.QRDecoder(W, H, binarize=True).find(img))
+
+# If quirc can't allocate an image the size of the new roi, the decoder keeps
+# its old size and roi and still works
+decoder = qrio.QRDecoder(W, H)
+decoder.roi = (40, 20, 200, 100)
+try:
+    decoder.width = 1 << 24
+except MemoryError:
+    print("MemoryError")
+print(decoder.width, decoder.roi)
+show(decoder, frame(96, 48), 96, 48)
@@ -0,0 +1,28 @@
+import array
+from audiocore import get_buffer
+from synthio import Envelope, Interpolation, Note, Synthesizer
+
+triangle = array.array("h", [0, 32767, 0, -32767])
+envelope = Envelope(attack_time=0, decay_time=0, release_time=0, attack_level=1, sustain_level=1)
+
+
+def render(**kw):
+    synth = Synthesizer(sample_rate=8000, envelope=envelope)
+    synth.press(Note(frequency=250, waveform=triangle, **kw))
+    samples = array.array("h", get_buffer(synth)[1])
+    return list(samples[:16])
+
+
+for interpolation in (Interpolation.NONE, Interpolation.LINEAR, Interpolation.CUBIC):
+    print(interpolation)
+    print(render(interpolation=interpolation))
+    print(render(interpolation=interpolation, ring_waveform=triangle, ring_frequency=125))
+
+n = Note(frequency=250)
+print(n.interpolation)
+n.interpolation = Interpolation.CUBIC
+print(n.interpolation)
+try:
+    n.interpolation = 1
+except TypeError as e:
+    print("TypeError")
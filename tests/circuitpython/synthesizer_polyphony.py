@@ -0,0 +1,44 @@
+import synthio
+import audiocore
+
+envelope = synthio.Envelope(attack_time=0, decay_time=0, release_time=0.5, sustain_level=1)
+s = synthio.Synthesizer(sample_rate=8000, envelope=envelope, polyphony=3)
+print(s.polyphony, s.max_polyphony >= 1)
+
+# With every voice busy, the oldest of equally loud notes is replaced
+s.press((60, 62, 64))
+audiocore.get_buffer(s)
+print(s.pressed)
+s.press(65)
+print(s.pressed)
+
+# A released note is replaced before any playing note
+s.release(62)
+audiocore.get_buffer(s)
+s.press(67)
+print(s.pressed)
+print(s.note_info(62))
+
+# Note objects are found again after being started
+n = synthio.Note(440)
+s.press(n)
+print(n in s.pressed, s.note_info(n)[0])
+s.release(n)
+print(n in s.pressed, s.note_info(n)[0])
+
+s.release_all()
+print(s.pressed)
+
+for polyphony in (0, 256):
+    try:
+        synthio.Synthesizer(polyphony=polyphony)
+    except ValueError as e:
+        print("ValueError", e)
+
+print(s.cpu_budget)
+s.cpu_budget = 0.5
+print(s.cpu_budget > 0.49)
+try:
+    s.cpu_budget = 2
+except ValueError as e:
+    print("ValueError", e)
@@ -0,0 +1,58 @@
+from audiocore import get_buffer
+import synthio
+
+s = synthio.Synthesizer(sample_rate=8000)
+n = synthio.Note(440, envelope=synthio.Envelope(attack_time=0, release_time=0))
+
+
+def lengths(count):
+    out = []
+    for _ in range(count):
+        result, buf = get_buffer(s)
+        out.append(len(buf))
+    return out
+
+
+print(s.sample_time)
+s.press_at(n, 100)
+s.release_at(n, 300)
+s.press_at(60, 300)
+print(lengths(4), s.sample_time)
+print(s.pressed)
+
+# the note starts on exactly the scheduled sample
+s = synthio.Synthesizer(sample_rate=8000)
+s.press_at(n, 37)
+result, buf = get_buffer(s)
+print(len(buf), max(abs(v) for v in buf))
+result, buf = get_buffer(s)
+print(buf[0] != 0 or buf[1] != 0)
+
+# property changes
+lfo = synthio.LFO(rate=1)
+s.set_at(lfo, "rate", 5, s.sample_time + 10)
+lengths(2)
+print(lfo.rate)
+
+# times that have passed apply at once, times keep their order
+s.set_at(lfo, "rate", 7, s.sample_time - 1000)
+s.set_at(lfo, "rate", 8, s.sample_time - 1000)
+lengths(1)
+print(lfo.rate)
+
+# cancel
+s.press_at(70, s.sample_time + 10)
+s.cancel_events()
+print(lengths(2), len(s.pressed))
+
+try:
+    s.set_at(3, "rate", 1, 0)
+except TypeError as e:
+    print(e)
+
+s.release_all()
+try:
+    for i in range(100):
+        s.press_at(60, s.sample_time + 1000 + i)
+except RuntimeError as e:
+    print(e, i)
@@ -0,0 +1,56 @@
+from audiocore import get_buffer
+import array
+import synthio
+
+samples = array.array("h", [i * 100 for i in range(64)])
+instrument = synthio.Instrument(
+    samples,
+    [(0, 59, 60, 0, 4, 12), (60, 72, 60, 32, 40, 48), (70, 80, 72, 0, 4, 8)],
+    sample_rate=8000,
+    envelope=synthio.Envelope(attack_time=0, decay_time=0, sustain_level=1, release_time=0),
+)
+print(instrument.zone_count, instrument.sample_rate, instrument.samples is samples)
+print([instrument.zone_for_key(k) for k in (0, 59, 60, 70, 72, 80, 81)])
+
+
+def play(note):
+    s = synthio.Synthesizer(sample_rate=8000)
+    s.press(note)
+    result, buf = get_buffer(s)
+    return [round(v / 100) for v in buf[:24]]
+
+
+# at the root key, the zone plays at its recorded speed, then loops
+print(play(synthio.Note(synthio.midi_to_hz(60), instrument=instrument)))
+# an octave down it plays at half speed, an octave up at twice the speed
+print(play(synthio.Note(synthio.midi_to_hz(48), instrument=instrument)))
+print(play(synthio.Note(synthio.midi_to_hz(72), instrument=instrument)))
+# no zone covers the key
+print(play(synthio.Note(synthio.midi_to_hz(100), instrument=instrument)))
+
+# notes share the instrument
+notes = [synthio.Note(synthio.midi_to_hz(k), instrument=instrument) for k in range(60, 64)]
+print(all(n.instrument is instrument for n in notes))
+
+# raw bytes are accepted as little-endian samples
+raw = bytes(samples)
+print(synthio.Instrument(raw, [(0, 127, 60, 0, 0, 64)], sample_rate=8000).zone_count)
+
+for zones in ([(0, 127, 60, 0, 10, 10)], [(0, 127, 60, 0, 0, 65)], [(10, 5, 60, 0, 0, 10)], [(0, 1, 2)], []):
+    try:
+        synthio.Instrument(samples, zones, sample_rate=8000)
+    except ValueError as e:
+        print(e)
+try:
+    synthio.Instrument(array.array("i", [1, 2]), [(0, 127, 60, 0, 0, 1)], sample_rate=8000)
+except ValueError as e:
+    print(e)
+for root_key in (-1, 128, float("nan"), float("inf")):
+    try:
+        synthio.Instrument(samples, [(0, 127, root_key, 0, 0, 64)], sample_rate=8000)
+    except ValueError as e:
+        print(e)
+try:
+    synthio.Instrument(samples, [(0, 127, 0, 0, 0, 64)], sample_rate=1 << 20)
+except ValueError as e:
+    print(e)
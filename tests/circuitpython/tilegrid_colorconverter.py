@@ -0,0 +1,58 @@
+# A TileGrid converts runs of pixels through an undithered ColorConverter at once. It must
+# give the same pixels, and the same transparency, as a Palette of the same colors, which
+# converts them one at a time.
+import displayio
+
+# Colors that RGB565 holds exactly
+colors = (0x000000, 0xF8FCF8, 0xF80000, 0x00FC00, 0x0000F8, 0x808080, 0x103458, 0xF8DCB8)
+W, H = 40, 3
+
+
+def rgb565(c):
+    return (c >> 19) << 11 | ((c >> 10) & 0x3F) << 5 | (c >> 3) & 0x1F
+
+
+rgb = displayio.Bitmap(W, H, 65536)
+indices = displayio.Bitmap(W, H, len(colors))
+for y in range(H):
+    for x in range(W):
+        i = (x * 3 + y) % len(colors)
+        rgb[x, y] = rgb565(colors[i])
+        indices[x, y] = i
+
+converter = displayio.ColorConverter(input_colorspace=displayio.Colorspace.RGB565)
+palette = displayio.Palette(len(colors))
+for i, c in enumerate(colors):
+    palette[i] = c
+by_row = displayio.TileGrid(rgb, pixel_shader=converter)
+by_pixel = displayio.TileGrid(indices, pixel_shader=palette)
+
+
+def fill(tilegrid, depth, grayscale):
+    out = displayio.Bitmap(W, H, 1 << depth)
+    out.fill(1)
+    covered = displayio.fill_area(out, tilegrid, 0, 0, W, H, grayscale)
+    return covered, bytes(memoryview(out))
+
+
+def check():
+    for depth, grayscale in (
+        (16, True),
+        (8, True),
+        (8, False),
+        (4, True),
+        (4, False),
+        (2, True),
+        (2, False),
+        (1, True),
+        (1, False),
+    ):
+        a = fill(by_row, depth, grayscale)
+        b = fill(by_pixel, depth, grayscale)
+        print(depth, grayscale, a[0], a == b)
+
+
+check()
+converter.make_transparent(rgb565(colors[2]))
+palette.make_transparent(2)
+check()
@@ -0,0 +1,75 @@
+# A TileGrid keeps up to four dirty areas, so separate changes refresh separately while
+# changes that line up are merged into one area.
+import displayio
+
+palette = displayio.Palette(4)
+for i, c in enumerate((0x000000, 0xF80000, 0x00FC00, 0x0000F8)):
+    palette[i] = c
+
+
+def grid(bitmap, **kwargs):
+    tilegrid = displayio.TileGrid(bitmap, pixel_shader=palette, **kwargs)
+    displayio.refresh_areas(tilegrid)  # The first refresh is always all of it
+    return tilegrid
+
+
+bitmap = displayio.Bitmap(32, 24, 4)
+tilegrid = grid(bitmap)
+print("none", displayio.refresh_areas(tilegrid))
+
+# Two changes in opposite corners stay apart
+bitmap[1, 1] = 1
+bitmap[30, 22] = 2
+print("apart", displayio.refresh_areas(tilegrid))
+
+# Neighbors that line up are merged
+bitmap[4, 4] = 1
+bitmap[5, 4] = 1
+bitmap[6, 4] = 1
+print("row", displayio.refresh_areas(tilegrid))
+# Two overlapping rectangles are covered without refreshing anything else
+for x1, y1, x2, y2 in ((2, 2, 10, 6), (6, 4, 14, 8)):
+    for y in range(y1, y2):
+        for x in range(x1, x2):
+            bitmap[x, y] = 3
+print("overlap", displayio.refresh_areas(tilegrid))
+
+# A fifth area joins whichever area grows the least
+for x, y in ((0, 0), (31, 0), (0, 23), (31, 23), (29, 21)):
+    bitmap[x, y] = 2
+print("full", displayio.refresh_areas(tilegrid))
+
+# The areas follow the TileGrid's position
+tilegrid.x = 100
+tilegrid.y = 50
+displayio.refresh_areas(tilegrid)
+bitmap[1, 1] = 0
+bitmap[30, 22] = 0
+print("moved", displayio.refresh_areas(tilegrid))
+
+# Only the dirty areas need filling to bring the screen up to date
+tilegrid.x = tilegrid.y = 0
+displayio.refresh_areas(tilegrid)
+screen = displayio.Bitmap(32, 24, 65536)
+displayio.fill_area(screen, tilegrid, 0, 0, 32, 24)
+bitmap[3, 20] = 1
+bitmap[28, 2] = 3
+for x1, y1, x2, y2 in displayio.refresh_areas(tilegrid):
+    displayio.fill_area(screen, tilegrid, x1, y1, x2, y2)
+expected = displayio.Bitmap(32, 24, 65536)
+displayio.fill_area(expected, tilegrid, 0, 0, 32, 24)
+print("filled", bytes(memoryview(screen)) == bytes(memoryview(expected)))
+
+# Tiles set in a grid of tiles are tracked the same way
+tiles = displayio.Bitmap(8, 8, 4)
+tilegrid = grid(tiles, width=6, height=4, tile_width=4, tile_height=4)
+tilegrid[0, 0] = 1
+tilegrid[5, 3] = 2
+print("tiles apart", displayio.refresh_areas(tilegrid))
+tilegrid[2, 1] = 3
+tilegrid[3, 1] = 3
+print("tiles row", displayio.refresh_areas(tilegrid))
+
+# A change to the bitmap of a grid of tiles may show in any tile, so all of it refreshes
+tiles[0, 0] = 1
+print("tiles bitmap", displayio.refresh_areas(tilegrid))
@@ -0,0 +1,56 @@
+# A Palette keeps its colors converted for the display's colorspace. Changing a color, its
+# transparency or the colorspace must show the next time a TileGrid is filled.
+import displayio
+
+W, H = 40, 2
+bitmap = displayio.Bitmap(W, H, 4)
+for x in range(W):
+    bitmap[x, 0] = x % 4
+    bitmap[x, 1] = (x // 3) % 4
+
+palette = displayio.Palette(4)
+for i, c in enumerate((0x000000, 0xFF0000, 0x00FF00, 0x0000FF)):
+    palette[i] = c
+tilegrid = displayio.TileGrid(bitmap, pixel_shader=palette)
+
+
+def fill(grid, depth=16):
+    out = displayio.Bitmap(W, H, 1 << depth)
+    out.fill(1)
+    covered = displayio.fill_area(out, grid, 0, 0, W, H)
+    return covered, [out[x, 0] for x in range(4)]
+
+
+# A Palette that has never been used for a colorspace converts every color afresh
+def fresh(depth=16):
+    copy = displayio.Palette(len(palette))
+    for i in range(len(palette)):
+        copy[i] = palette[i]
+        if palette.is_transparent(i):
+            copy.make_transparent(i)
+    return fill(displayio.TileGrid(bitmap, pixel_shader=copy), depth)
+
+
+def check(name, depth=16):
+    displayio.refresh_areas(tilegrid)
+    result = fill(tilegrid, depth)
+    print(name, *result, result == fresh(depth))
+
+
+check("start")
+check("again")
+palette[2] = 0xFFFFFF
+print("refresh", displayio.refresh_areas(tilegrid))
+check("set color")
+palette[2] = 0xFFFFFF
+print("same color refresh", displayio.refresh_areas(tilegrid))
+palette.make_transparent(1)
+print("transparent refresh", displayio.refresh_areas(tilegrid))
+check("transparent")
+palette.make_opaque(1)
+check("opaque")
+palette[1] = 0x808080
+check("set color gray", 8)
+palette[3] = 0x404040
+check("set color gray again", 8)
+check("back to rgb565")
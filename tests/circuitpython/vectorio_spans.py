@@ -0,0 +1,100 @@
+# Checks the span rasterizers of the vectorio shapes against contains(),
+# which tests one pixel at a time. vectorio.draw_area fills part of a bitmap
+# the way a Group does, with the last shape on top.
+import displayio
+import vectorio
+
+W, H = 64, 48
+BACKGROUND = 0x1234
+
+
+def palette(color):
+    p = displayio.Palette(1)
+    p[0] = color
+    return p
+
+
+def rgb565(color):
+    return ((color >> 8) & 0xF800) | ((color >> 5) & 0x07E0) | ((color >> 3) & 0x001F)
+
+
+def model(shapes):
+    b = displayio.Bitmap(W, H, 65536)
+    b.fill(BACKGROUND)
+    for y in range(H):
+        for x in range(W):
+            for shape, color in reversed(shapes):
+                if shape.contains(x, y):
+                    b[x, y] = rgb565(color)
+                    break
+    return b
+
+
+def draw(shapes, tile_w=W, tile_h=H):
+    b = displayio.Bitmap(W, H, 65536)
+    b.fill(BACKGROUND)
+    for y in range(0, H, tile_h):
+        for x in range(0, W, tile_w):
+            vectorio.draw_area(
+                b, [s for s, _ in shapes], x, y, min(W, x + tile_w), min(H, y + tile_h)
+            )
+    return b
+
+
+def same(a, b):
+    return memoryview(a) == memoryview(b)
+
+
+def covered(b):
+    return sum(1 for i in range(W * H) if b[i] != BACKGROUND)
+
+
+def check(name, shapes):
+    expected = model(shapes)
+    results = [same(draw(shapes, w, h), expected) for w, h in ((W, H), (7, 5), (1, H), (W, 1))]
+    print(name, covered(expected), results)
+
+
+def shape(cls, color, **kwargs):
+    return cls(pixel_shader=palette(color), **kwargs), color
+
+
+concave = [(0, 0), (30, 4), (12, 14), (28, 30), (2, 24)]
+star = [(15, 0), (24, 30), (0, 10), (30, 10), (6, 30)]
+bowtie = [(0, 0), (20, 16), (20, 0), (0, 16)]
+
+check("concave", [shape(vectorio.Polygon, 0xFF0000, points=concave, x=10, y=6)])
+check("star", [shape(vectorio.Polygon, 0x00FF00, points=star, x=20, y=10)])
+check("bowtie", [shape(vectorio.Polygon, 0x0000FF, points=bowtie, x=3, y=20)])
+check("circle", [shape(vectorio.Circle, 0xFFFF00, radius=13, x=30, y=22)])
+check("rectangle", [shape(vectorio.Rectangle, 0xFF00FF, width=21, height=9, x=5, y=31)])
+
+# Partly outside of the bitmap on each side
+check("polygon edges", [
+    shape(vectorio.Polygon, 0xFF0000, points=concave, x=-12, y=-9),
+    shape(vectorio.Polygon, 0x00FF00, points=star, x=W - 14, y=H - 17),
+])
+check("circle edges", [
+    shape(vectorio.Circle, 0xFFFF00, radius=17, x=-3, y=H // 2),
+    shape(vectorio.Circle, 0x00FFFF, radius=9, x=W + 4, y=2),
+])
+check("rectangle edges", [
+    shape(vectorio.Rectangle, 0xFF00FF, width=30, height=70, x=-10, y=-11),
+    shape(vectorio.Rectangle, 0x00FFFF, width=20, height=6, x=W - 8, y=H - 3),
+])
+check("off screen", [shape(vectorio.Circle, 0xFFFF00, radius=5, x=-20, y=-20)])
+
+# Overlapping shapes: the last one is on top
+check("stacked", [
+    shape(vectorio.Rectangle, 0xFF00FF, width=40, height=30, x=4, y=4),
+    shape(vectorio.Circle, 0xFFFF00, radius=12, x=30, y=20),
+    shape(vectorio.Polygon, 0x00FF00, points=star, x=18, y=12),
+])
+
+# Moving and changing shapes redraws them from their new spans
+poly, color = shape(vectorio.Polygon, 0xFF0000, points=concave, x=10, y=6)
+circle, circle_color = shape(vectorio.Circle, 0xFFFF00, radius=8, x=50, y=30)
+poly.points = bowtie
+poly.location = (40, -4)
+circle.radius = 15
+check("changed", [(poly, color), (circle, circle_color)])
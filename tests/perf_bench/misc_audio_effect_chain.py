@@ -0,0 +1,46 @@
+# Render 44.1kHz stereo audio through a chain of four audio effects.
+#
+# The reported norm is the number of frames rendered, so the score (norm per
+# second of run time) divided by 44100 is how many copies of the chain this
+# target can run in real time.
+
+try:
+    import array
+    import audiocore
+    import audiodelays
+    import audiofilters
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_RATE = 44100
+BUFFER_SIZE = 1024  # bytes, 256 stereo frames
+
+
+def render(buffers):
+    data = array.array("h", ((i * 997) % 65536 - 32768 for i in range(2 * 441)))
+    sample = audiocore.RawSample(data, channel_count=2, sample_rate=SAMPLE_RATE)
+    kw = dict(buffer_size=BUFFER_SIZE, channel_count=2, sample_rate=SAMPLE_RATE)
+    distortion = audiofilters.Distortion(drive=0.5, mix=1.0, **kw)
+    filt = audiofilters.Filter(mix=1.0, **kw)
+    chorus = audiodelays.Chorus(voices=2.0, max_delay_ms=20, delay_ms=10, **kw)
+    echo = audiodelays.Echo(max_delay_ms=100, delay_ms=50, mix=0.3, **kw)
+    distortion.play(sample, loop=True)
+    filt.play(distortion)
+    chorus.play(filt)
+    echo.play(chorus)
+    for _ in range(buffers):
+        audiocore.get_buffer(echo)
+    return buffers
+
+
+bm_params = {
+    (100, 100): (4,),
+    (1000, 1000): (40,),
+    (5000, 1000): (200,),
+}
+
+
+def bm_setup(ps):
+    (buffers,) = ps
+    return lambda: render(buffers), lambda: (buffers * BUFFER_SIZE // 4, None)
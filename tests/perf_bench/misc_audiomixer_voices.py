@@ -0,0 +1,45 @@
+# Mix several looping voices into 44.1kHz stereo audio with audiomixer.
+#
+# The reported norm is the number of voice-frames mixed, so the score (norm per
+# second of run time) divided by 44100 is the number of voices that this target
+# can mix in real time.
+
+try:
+    import array
+    import audiocore
+    import audiomixer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_RATE = 44100
+BUFFER_SIZE = 2048  # bytes, split in two halves of 256 stereo frames
+
+
+def render(voices, buffers):
+    data = array.array("h", ((i * 997) % 65536 - 32768 for i in range(2 * 441)))
+    sample = audiocore.RawSample(data, channel_count=2, sample_rate=SAMPLE_RATE)
+    mixer = audiomixer.Mixer(
+        voice_count=voices,
+        buffer_size=BUFFER_SIZE,
+        channel_count=2,
+        sample_rate=SAMPLE_RATE,
+    )
+    for v in range(voices):
+        mixer.voice[v].level = 0.25
+        mixer.voice[v].play(sample, loop=True)
+    for _ in range(buffers):
+        audiocore.get_buffer(mixer)
+    return buffers
+
+
+bm_params = {
+    (100, 100): (2, 10),
+    (1000, 1000): (8, 40),
+    (5000, 1000): (8, 200),
+}
+
+
+def bm_setup(ps):
+    voices, buffers = ps
+    return lambda: render(voices, buffers), lambda: (voices * buffers * BUFFER_SIZE // 8, None)
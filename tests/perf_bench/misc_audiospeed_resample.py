@@ -0,0 +1,48 @@
+# Resample a looping 22.05kHz stereo sample into a 44.1kHz mixer with each
+# audiospeed.Resampler quality.
+#
+# The reported norm is the number of output frames, so the score (norm per
+# second of run time) divided by 44100 is the number of voices of this quality
+# that this target can resample in real time.
+
+try:
+    import array
+    import audiocore
+    import audiomixer
+    import audiospeed
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_RATE = 44100
+BUFFER_SIZE = 2048  # bytes, split in two halves of 256 stereo frames
+QUALITIES = ("NEAREST", "LINEAR", "CUBIC", "SINC")
+
+
+def render(buffers):
+    data = array.array("h", ((i * 997) % 65536 - 32768 for i in range(2 * 441)))
+    sample = audiocore.RawSample(data, channel_count=2, sample_rate=SAMPLE_RATE // 2)
+    for name in QUALITIES:
+        resampler = audiospeed.Resampler(sample, quality=getattr(audiospeed.Quality, name))
+        mixer = audiomixer.Mixer(
+            voice_count=1,
+            buffer_size=BUFFER_SIZE,
+            channel_count=2,
+            sample_rate=SAMPLE_RATE,
+        )
+        mixer.voice[0].play(resampler, loop=True)
+        for _ in range(buffers):
+            audiocore.get_buffer(mixer)
+    return buffers
+
+
+bm_params = {
+    (100, 100): (10,),
+    (1000, 1000): (40,),
+    (5000, 1000): (200,),
+}
+
+
+def bm_setup(ps):
+    (buffers,) = ps
+    return lambda: render(buffers), lambda: (len(QUALITIES) * buffers * BUFFER_SIZE // 8, None)
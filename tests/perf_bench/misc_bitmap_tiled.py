@@ -0,0 +1,36 @@
+# Turn a frame a quarter turn with bitmaptools.rotozoom, to compare row and tiled Bitmaps
+
+try:
+    import bitmaptools
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def rotate_frames(n, tiled):
+    # Reading a quarter-turned frame walks the source a column at a time
+    frame = displayio.Bitmap(120, 80, 65536, tiled=tiled)
+    screen = displayio.Bitmap(80, 120, 65536, tiled=tiled)
+    for i in range(80):
+        bitmaptools.draw_line(frame, 0, i, 119, 79 - i, i * 811)
+    for i in range(n):
+        bitmaptools.rotozoom(screen, frame, angle=1.5707963)
+    return screen
+
+
+bm_params = {
+    (100, 100): (2,),
+    (1000, 1000): (20,),
+    (5000, 1000): (100,),
+}
+
+
+def bm_setup(ps):
+    n = ps[0]
+
+    def run():
+        rotate_frames(n, False)
+        rotate_frames(n, True)
+
+    return run, lambda: (n * 2, None)
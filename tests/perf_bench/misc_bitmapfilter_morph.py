@@ -0,0 +1,40 @@
+# Blur a QVGA bitmap with box, separable and general kernels, to test bitmapfilter.morph
+
+try:
+    import bitmapfilter
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+kernels = (
+    [1] * 25,
+    [a * b for a in (1, 4, 6, 4, 1) for b in (1, 4, 6, 4, 1)],
+    [-1, -2, -1, -2, 4, -2, -1, -2, -1],
+)
+
+
+def filter_bitmap(n, bitmap):
+    for i in range(n):
+        for weights in kernels:
+            bitmapfilter.morph(bitmap, weights)
+    return bitmap
+
+
+bm_params = {
+    (100, 100): (1, 40, 30),
+    (1000, 1000): (1, 320, 240),
+    (5000, 1000): (5, 320, 240),
+}
+
+
+def bm_setup(ps):
+    n, w, h = ps
+    bitmap = displayio.Bitmap(w, h, 65536)
+    for y in range(h):
+        bitmap[0, y] = y * 257
+
+    def run():
+        filter_bitmap(n, bitmap)
+
+    return run, lambda: (n * w * h * len(kernels), None)
@@ -0,0 +1,38 @@
+# Blit 64x64 sprites around a screen at each bitmap depth, to test bitmaptools.blit
+
+try:
+    import bitmaptools
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def blit_sprites(n, bits, skip):
+    screen = displayio.Bitmap(320, 240, 1 << bits)
+    sprite = displayio.Bitmap(64, 64, 1 << bits)
+    for i in range(64):
+        bitmaptools.draw_line(sprite, i, 0, 63 - i, 63, i & ((1 << bits) - 1))
+    for i in range(n):
+        x = (i * 37) % (320 - 64)
+        y = (i * 23) % (240 - 64)
+        bitmaptools.blit(screen, sprite, x, y, skip_source_index=skip)
+    return screen
+
+
+bm_params = {
+    (100, 100): (20,),
+    (1000, 1000): (200,),
+    (5000, 1000): (1000,),
+}
+
+
+def bm_setup(ps):
+    n = ps[0]
+
+    def run():
+        for bits in (1, 2, 4, 8, 16):
+            blit_sprites(n, bits, None)
+            blit_sprites(n, bits, 0)
+
+    return run, lambda: (n * 10, None)
@@ -0,0 +1,37 @@
+# Rotate and scale a 64x64 sprite onto a screen, to test bitmaptools.rotozoom
+
+try:
+    import bitmaptools
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def rotate_sprites(n, bilinear):
+    screen = displayio.Bitmap(160, 128, 65536)
+    sprite = displayio.Bitmap(64, 64, 65536)
+    for i in range(64):
+        bitmaptools.draw_line(sprite, i, 0, 63 - i, 63, i * 1031)
+    for i in range(n):
+        bitmaptools.rotozoom(
+            screen, sprite, ox=80, oy=64, angle=i * 0.1, scale=1 + (i % 8) * 0.125, bilinear=bilinear
+        )
+    return screen
+
+
+bm_params = {
+    (100, 100): (4,),
+    (1000, 1000): (40,),
+    (5000, 1000): (200,),
+}
+
+
+def bm_setup(ps):
+    n = ps[0]
+
+    def run():
+        rotate_sprites(n, False)
+        rotate_sprites(n, True)
+
+    return run, lambda: (n * 2, None)
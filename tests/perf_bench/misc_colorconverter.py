@@ -0,0 +1,28 @@
+# Convert an RGB888 frame to RGB565 a row at a time, to test displayio.ColorConverter
+
+try:
+    import array
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def convert_frame(w, h, dither):
+    converter = displayio.ColorConverter(dither=dither)
+    source = array.array("I", ((x * 0x010203) & 0xFFFFFF for x in range(w)))
+    frame = memoryview(array.array("H", bytearray(w * h * 2)))
+    for y in range(h):
+        converter.convert_row(source, frame[y * w : y * w + w], y=y)
+    return frame
+
+
+bm_params = {
+    (100, 100): (320, 8, False),
+    (1000, 1000): (320, 240, False),
+    (5000, 1000): (320, 240, True),
+}
+
+
+def bm_setup(ps):
+    return lambda: convert_frame(ps[0], ps[1], ps[2]), lambda: (ps[0] * ps[1], None)
@@ -0,0 +1,44 @@
+# Compress a background and read it back along its rows, to test displayio.CompressedBitmap
+
+try:
+    import displayio
+
+    displayio.CompressedBitmap
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def make_background(width, height):
+    background = displayio.Bitmap(width, height, 65536)
+    background.fill(0x1234)
+    for y in range(0, height, 8):
+        for x in range(width):
+            background[x, y] = x // 4
+    return background
+
+
+def read_rows(n, width, height):
+    compressed = displayio.CompressedBitmap(displayio.CompressedBitmap.compress(make_background(width, height)))
+    total = 0
+    for i in range(n):
+        for y in range(height):
+            for x in range(width):
+                total += compressed[x, y]
+    return total
+
+
+bm_params = {
+    (100, 100): (1, 40, 20),
+    (1000, 1000): (2, 80, 60),
+    (5000, 1000): (4, 160, 120),
+}
+
+
+def bm_setup(ps):
+    n, width, height = ps
+
+    def run():
+        read_rows(n, width, height)
+
+    return run, lambda: (n * width * height, None)
@@ -0,0 +1,39 @@
+# Record frames that change in a small area to a GIF in memory, to test gifio.GifWriter
+
+try:
+    import io
+
+    import displayio
+    import gifio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def record(n, w, h):
+    frame = displayio.Bitmap(w, h, 65536)
+    for i in range(w * h):
+        frame[i] = (i // 3) & 0xFFFF
+    out = io.BytesIO()
+    with gifio.GifWriter(out, w, h, displayio.Colorspace.RGB565, loop=False) as g:
+        for i in range(n):
+            frame[(i * 97) % (w * h)] = 0xFFFF
+            g.add_frame(frame, 0.1)
+    return len(out.getvalue())
+
+
+bm_params = {
+    (100, 100): (4, 40, 30),
+    (1000, 1000): (4, 160, 120),
+    (5000, 1000): (8, 320, 240),
+}
+
+
+def bm_setup(ps):
+    n, w, h = ps
+    result = [0]
+
+    def run():
+        result[0] = record(n, w, h)
+
+    return run, lambda: (n * w * h, result[0])
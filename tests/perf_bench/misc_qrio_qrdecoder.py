@@ -0,0 +1,55 @@
+# Scan stored camera frames for QR codes, most of them empty, to test qrio.QRDecoder
+
+try:
+    import qrio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def make_frame(w, h, seed, code):
+    # A noisy grey background
+    noise = bytearray(w + 64)
+    for i in range(len(noise)):
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        noise[i] = 150 + (seed >> 16) % 40
+    img = bytearray(w * h)
+    for y in range(h):
+        o = (y * 7) % 64
+        img[y * w : (y + 1) * w] = noise[o : o + w]
+    if code:
+        # Three finder patterns, as in the corners of a QR code
+        m = w // 80
+        x0 = w // 4
+        y0 = h // 4
+        dark = bytes([20]) * m
+        for fx, fy in ((x0, y0), (x0 + 30 * m, y0), (x0, y0 + 30 * m)):
+            for j in range(7 * m):
+                for i in range(7):
+                    if max(abs(i - 3), abs(j // m - 3)) != 2:
+                        p = (fy + j) * w + fx + i * m
+                        img[p : p + m] = dark
+    return img
+
+
+bm_params = {
+    (100, 100): (8, 80, 60, 1),
+    (1000, 1000): (8, 160, 120, 2),
+    (5000, 1000): (16, 320, 240, 2),
+}
+
+
+def bm_setup(ps):
+    n, w, h, scale = ps
+    frames = [make_frame(w, h, i, i % 4 == 3) for i in range(4)]
+    decoder = qrio.QRDecoder(w, h, scale=scale, binarize=True)
+    decoder.track = True
+    result = [0]
+
+    def run():
+        found = 0
+        for i in range(n):
+            found += len(decoder.find(frames[i % 4]))
+        result[0] = found
+
+    return run, lambda: (n * w * h, result[0])
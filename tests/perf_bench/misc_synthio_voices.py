@@ -0,0 +1,43 @@
+# Render one second of 48kHz audio from many simultaneous synthio voices.
+#
+# The reported norm is the number of voice-samples rendered, so the score
+# (norm per second of run time) divided by 48000 is the number of voices that
+# this target can render in real time.
+
+try:
+    import array
+    import audiocore
+    import synthio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+SAMPLE_RATE = 48000
+BUFFER_SAMPLES = 256
+
+
+def render(voices, seconds, interpolation):
+    waveform = array.array("h", (i * 1024 - 32768 for i in range(64)))
+    synth = synthio.Synthesizer(sample_rate=SAMPLE_RATE, waveform=waveform, polyphony=voices)
+    notes = [synthio.Note(110 + 17 * i, waveform=waveform) for i in range(voices)]
+    for note in notes:
+        note.interpolation = interpolation
+    synth.press(notes)
+    for _ in range(seconds * SAMPLE_RATE // BUFFER_SAMPLES):
+        audiocore.get_buffer(synth)
+    return len(synth.pressed)
+
+
+bm_params = {
+    (100, 100): (4, 1, synthio.Interpolation.NONE),
+    (1000, 1000): (64, 1, synthio.Interpolation.NONE),
+    (5000, 1000): (64, 4, synthio.Interpolation.LINEAR),
+}
+
+
+def bm_setup(ps):
+    voices, seconds, interpolation = ps
+    return lambda: render(voices, seconds, interpolation), lambda: (
+        voices * seconds * SAMPLE_RATE,
+        None,
+    )